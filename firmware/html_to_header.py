@@ -1,26 +1,64 @@
 #!/usr/bin/env python3
 """
 Convert HTML file to C++ header file for embedding in firmware
+
+The HTML is minified, gzip-compressed and stored as a binary blob together
+with a strong ETag derived from its SHA-256, so the web server can send it
+with Content-Encoding: gzip and answer If-None-Match with 304.
+
+Runs standalone (python3 html_to_header.py [in.html] [out.h]) or as a
+PlatformIO pre-build script.
 """
 
+import gzip
+import hashlib
 import os
+import re
 import sys
 
-def escape_string(s):
-    """Escape string for C++ string literal"""
-    # Replace backslashes first to avoid double escaping
-    s = s.replace('\\', '\\\\')
-    # Replace quotes
-    s = s.replace('"', '\\"')
-    # Replace newlines with literal \n
-    s = s.replace('\n', '\\n')
-    # Replace carriage returns
-    s = s.replace('\r', '\\r')
-    return s
+try:
+    Import("env")  # noqa: F821 - injected by PlatformIO/SCons
+    PLATFORMIO_ENV = env  # noqa: F821
+except NameError:
+    PLATFORMIO_ENV = None
+
+BYTES_PER_LINE = 16
+
+def minify_html(html):
+    """Conservative minification: strip comments, indentation and blank lines
+
+    Newlines are kept so JavaScript automatic semicolon insertion and
+    single-line // comments behave exactly as in the source file.
+    """
+    # Remove HTML comments
+    html = re.sub(r'<!--.*?-->', '', html, flags=re.DOTALL)
+
+    lines = []
+    for line in html.splitlines():
+        line = line.strip()
+        if not line:
+            continue
+        # Drop full-line JavaScript comments
+        if line.startswith('//'):
+            continue
+        lines.append(line)
+    return '\n'.join(lines) + '\n'
+
+def compress(content):
+    """Gzip with a fixed mtime so identical input gives identical output"""
+    return gzip.compress(content.encode('utf-8'), compresslevel=9, mtime=0)
+
+def format_bytes(data):
+    """Format binary data as a C array initializer"""
+    rows = []
+    for i in range(0, len(data), BYTES_PER_LINE):
+        chunk = data[i:i + BYTES_PER_LINE]
+        rows.append('    ' + ', '.join(f'0x{b:02x}' for b in chunk) + ',')
+    return '\n'.join(rows)
 
 def html_to_header(html_file, header_file):
     """Convert HTML file to C++ header file"""
-    
+
     # Read the HTML file
     try:
         with open(html_file, 'r', encoding='utf-8') as f:
@@ -31,54 +69,83 @@ def html_to_header(html_file, header_file):
     except Exception as e:
         print(f"Error reading HTML file: {e}")
         return False
-    
-    # Escape the content for C++ string literal
-    escaped_content = escape_string(html_content)
-    
+
+    minified = minify_html(html_content)
+    compressed = compress(minified)
+    etag = hashlib.sha256(compressed).hexdigest()[:16]
+
     # Generate header file content
-    header_content = f"""#ifndef WEB_UI_H
+    header_content = f"""// Auto-generated by html_to_header.py from data/index.html
+// DO NOT EDIT - edit data/index.html and rebuild instead
+
+#ifndef WEB_UI_H
 #define WEB_UI_H
 
 #include <Arduino.h>
 
-// HTML content for the web UI (stored in flash memory)
-const char html_index[] PROGMEM = "{escaped_content}";
+// Minified, gzip-compressed HTML for the web UI (stored in flash memory)
+const uint8_t html_index_gz[] PROGMEM = {{
+{format_bytes(compressed)}
+}};
+
+// Size of the compressed blob as sent on the wire
+const size_t html_index_gz_size = {len(compressed)};
+
+// Size of the minified HTML after decompression
+const size_t html_index_size = {len(minified)};
 
-// Size of the HTML content
-const size_t html_index_size = {len(html_content)};
+// Strong ETag: truncated SHA-256 of the compressed blob
+#define HTML_INDEX_ETAG "\\"{etag}\\""
 
 #endif // WEB_UI_H
 """
-    
+
+    # Leave the header untouched when nothing changed to avoid needless rebuilds
+    try:
+        with open(header_file, 'r', encoding='utf-8') as f:
+            if f.read() == header_content:
+                print(f"'{header_file}' is up to date (ETag {etag})")
+                return True
+    except FileNotFoundError:
+        pass
+
     # Write the header file
     try:
         with open(header_file, 'w', encoding='utf-8') as f:
             f.write(header_content)
         print(f"Successfully converted '{html_file}' to '{header_file}'")
-        print(f"HTML size: {len(html_content)} bytes")
+        print(f"HTML size: {len(html_content)} bytes, minified: {len(minified)} bytes, "
+              f"gzip: {len(compressed)} bytes, ETag: {etag}")
         return True
     except Exception as e:
         print(f"Error writing header file: {e}")
         return False
 
+def default_paths(project_dir):
+    return (os.path.join(project_dir, 'data', 'index.html'),
+            os.path.join(project_dir, 'src', 'web_ui.h'))
+
 def main():
     # Default paths
     script_dir = os.path.dirname(os.path.abspath(__file__))
-    html_file = os.path.join(script_dir, 'data', 'index.html')
-    header_file = os.path.join(script_dir, 'src', 'web_ui.h')
-    
+    html_file, header_file = default_paths(script_dir)
+
     # Allow command line arguments to override paths
     if len(sys.argv) >= 2:
         html_file = sys.argv[1]
     if len(sys.argv) >= 3:
         header_file = sys.argv[2]
-    
+
     print(f"Converting HTML to header file...")
     print(f"Input:  {html_file}")
     print(f"Output: {header_file}")
-    
+
     success = html_to_header(html_file, header_file)
     sys.exit(0 if success else 1)
 
-if __name__ == "__main__":
-    main() 
\ No newline at end of file
+if PLATFORMIO_ENV is not None:
+    # Pre-build step: never call sys.exit() inside SCons
+    if not html_to_header(*default_paths(PLATFORMIO_ENV.get("PROJECT_DIR"))):
+        PLATFORMIO_ENV.Exit(1)
+elif __name__ == "__main__":
+    main()
@@ -0,0 +1,50 @@
+#include "alloc_stats.h"
+#include <atomic>
+#include <esp_heap_caps.h>
+
+#ifdef ALLOC_TRACKING
+// Built with -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc (see [env:esp32dev_bench]);
+// every allocation in the image, including operator new and the web server libraries,
+// passes through these wrappers and is counted
+static std::atomic<uint32_t> allocationCount(0);
+
+extern "C" {
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+
+void* __wrap_malloc(size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t count, size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    return __real_calloc(count, size);
+}
+
+void* __wrap_realloc(void* ptr, size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    return __real_realloc(ptr, size);
+}
+}
+#endif
+
+/**
+ * Snapshot heap usage and (when enabled) the allocation counter
+ */
+void getHeapStats(HeapStats& stats) {
+    stats.free_heap = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    stats.min_free_heap = heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL);
+    stats.largest_free_block = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL);
+    stats.free_psram = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+    stats.min_free_psram = heap_caps_get_minimum_free_size(MALLOC_CAP_SPIRAM);
+
+#ifdef ALLOC_TRACKING
+    stats.allocation_tracking = true;
+    stats.allocation_count = allocationCount.load(std::memory_order_relaxed);
+#else
+    stats.allocation_tracking = false;
+    stats.allocation_count = 0;
+#endif
+}
@@ -0,0 +1,20 @@
+#ifndef ALLOC_STATS_H
+#define ALLOC_STATS_H
+
+#include <Arduino.h>
+
+// Heap usage snapshot for /api/diagnostics/heap
+struct HeapStats {
+    uint32_t free_heap;
+    uint32_t min_free_heap;          // Internal heap high-water mark since boot
+    uint32_t largest_free_block;
+    uint32_t free_psram;
+    uint32_t min_free_psram;
+    bool allocation_tracking;        // True when built with ALLOC_TRACKING
+    uint32_t allocation_count;       // malloc/calloc/realloc calls since boot
+};
+
+// Function prototypes
+void getHeapStats(HeapStats& stats);
+
+#endif // ALLOC_STATS_H
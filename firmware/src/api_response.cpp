@@ -0,0 +1,203 @@
+#include "api_response.h"
+#include <new>
+
+// Slots are allocated once at boot (PSRAM when available) and reused forever
+static JsonResponseSlot* jsonSlots = nullptr;
+static bool jsonSlotInUse[JSON_RESPONSE_POOL_SIZE] = {};
+static portMUX_TYPE jsonPoolLock = portMUX_INITIALIZER_UNLOCKED;
+static JsonResponsePoolStats poolStats = {};
+
+/**
+ * Response body served straight out of a pooled slot
+ * The slot goes back to the pool when AsyncWebServer destroys the response
+ */
+class PooledJsonResponse : public AsyncAbstractResponse {
+public:
+    PooledJsonResponse(int code, JsonResponseSlot* slot) : _slot(slot), _offset(0) {
+        _code = code;
+        _contentType = "application/json";
+        _contentLength = slot->length;
+    }
+
+    ~PooledJsonResponse() {
+        releaseJsonSlot(_slot);
+    }
+
+    bool _sourceValid() const override {
+        return _slot != nullptr;
+    }
+
+    size_t _fillBuffer(uint8_t* buf, size_t maxLen) override {
+        size_t remaining = _slot->length - _offset;
+        size_t count = remaining < maxLen ? remaining : maxLen;
+        memcpy(buf, _slot->buffer + _offset, count);
+        _offset += count;
+        return count;
+    }
+
+private:
+    JsonResponseSlot* _slot;
+    size_t _offset;
+};
+
+/**
+ * Allocate the response pool
+ * Called once from setupWebServer() before any route can run
+ */
+void setupJsonResponsePool() {
+    if (jsonSlots) {
+        return;
+    }
+
+    size_t bytes = sizeof(JsonResponseSlot) * JSON_RESPONSE_POOL_SIZE;
+    void* memory = psramFound() ? ps_malloc(bytes) : malloc(bytes);
+    if (!memory) {
+        log_e("Failed to allocate JSON response pool (%u bytes)", bytes);
+        return;
+    }
+
+    jsonSlots = static_cast<JsonResponseSlot*>(memory);
+    for (int i = 0; i < JSON_RESPONSE_POOL_SIZE; i++) {
+        new (&jsonSlots[i]) JsonResponseSlot();
+    }
+
+    log_i("JSON response pool ready: %d x %u bytes", JSON_RESPONSE_POOL_SIZE, sizeof(JsonResponseSlot));
+}
+
+/**
+ * Take a free slot with an empty document, or nullptr if all are in flight
+ */
+JsonResponseSlot* acquireJsonSlot() {
+    JsonResponseSlot* slot = nullptr;
+
+    portENTER_CRITICAL(&jsonPoolLock);
+    if (jsonSlots) {
+        for (int i = 0; i < JSON_RESPONSE_POOL_SIZE; i++) {
+            if (!jsonSlotInUse[i]) {
+                jsonSlotInUse[i] = true;
+                slot = &jsonSlots[i];
+                poolStats.in_use++;
+                if (poolStats.in_use > poolStats.max_in_use) {
+                    poolStats.max_in_use = poolStats.in_use;
+                }
+                break;
+            }
+        }
+    }
+    if (!slot) {
+        poolStats.exhausted++;
+    }
+    portEXIT_CRITICAL(&jsonPoolLock);
+
+    if (slot) {
+        slot->doc.clear();
+        slot->length = 0;
+    }
+    return slot;
+}
+
+/**
+ * Acquire a slot for a handler, answering 503 itself when the pool is exhausted
+ */
+JsonResponseSlot* beginJsonResponse(AsyncWebServerRequest* request) {
+    JsonResponseSlot* slot = acquireJsonSlot();
+    if (!slot) {
+        sendText(request, 503, "Server busy");
+    }
+    return slot;
+}
+
+/**
+ * Return a slot to the pool
+ */
+void releaseJsonSlot(JsonResponseSlot* slot) {
+    if (!slot || !jsonSlots) {
+        return;
+    }
+
+    int index = slot - jsonSlots;
+    if (index < 0 || index >= JSON_RESPONSE_POOL_SIZE) {
+        return;
+    }
+
+    portENTER_CRITICAL(&jsonPoolLock);
+    if (jsonSlotInUse[index]) {
+        jsonSlotInUse[index] = false;
+        poolStats.in_use--;
+    }
+    portEXIT_CRITICAL(&jsonPoolLock);
+}
+
+/**
+ * Serialize the slot's document into its buffer and send it without copying
+ * Ownership of the slot passes to the response
+ */
+void sendJsonSlot(AsyncWebServerRequest* request, JsonResponseSlot* slot, int code) {
+    if (measureJson(slot->doc) >= sizeof(slot->buffer)) {
+        portENTER_CRITICAL(&jsonPoolLock);
+        poolStats.overflows++;
+        portEXIT_CRITICAL(&jsonPoolLock);
+
+        log_e("JSON response too large for pooled buffer: %s", request->url().c_str());
+        releaseJsonSlot(slot);
+        sendText(request, 500, "Response too large");
+        return;
+    }
+
+    slot->length = serializeJson(slot->doc, slot->buffer, sizeof(slot->buffer));
+    request->send(new PooledJsonResponse(code, slot));
+}
+
+/**
+ * Send a static text body (string literal) without copying it into a String
+ */
+void sendText(AsyncWebServerRequest* request, int code, const char* text) {
+    request->send(request->beginResponse(code, "text/plain", (const uint8_t*)text, strlen(text)));
+}
+
+/**
+ * Snapshot pool usage
+ */
+void getJsonResponsePoolStats(JsonResponsePoolStats& stats) {
+    portENTER_CRITICAL(&jsonPoolLock);
+    stats = poolStats;
+    portEXIT_CRITICAL(&jsonPoolLock);
+}
+
+/**
+ * Get a request parameter as a C string owned by the request, or nullptr if missing
+ */
+const char* getParamValue(AsyncWebServerRequest* request, const char* name, bool post) {
+    const AsyncWebParameter* param = request->getParam(name, post);
+    return param ? param->value().c_str() : nullptr;
+}
+
+/**
+ * Parse a request parameter as a base-10 integer
+ * Returns false if the parameter is missing or not a complete number
+ */
+bool getParamInt64(AsyncWebServerRequest* request, const char* name, int64_t& value, bool post) {
+    const char* text = getParamValue(request, name, post);
+    if (!text || !*text) {
+        return false;
+    }
+
+    char* end;
+    long long parsed = strtoll(text, &end, 10);
+    if (*end != '\0') {
+        return false;
+    }
+
+    value = parsed;
+    return true;
+}
+
+bool getParamInt32(AsyncWebServerRequest* request, const char* name, int32_t& value, bool post) {
+    int64_t parsed;
+    if (!getParamInt64(request, name, parsed, post) || parsed < INT32_MIN || parsed > INT32_MAX) {
+        return false;
+    }
+
+    value = (int32_t)parsed;
+    return true;
+}
@@ -0,0 +1,42 @@
+#ifndef API_RESPONSE_H
+#define API_RESPONSE_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <ESPAsyncWebServer.h>
+
+// JSON response pool configuration
+#define JSON_RESPONSE_POOL_SIZE 4          // Responses that may be in flight at once
+#define JSON_RESPONSE_DOC_SIZE 2048        // Large enough for /api/wifi/scan-results
+#define JSON_RESPONSE_BUFFER_SIZE 3072
+
+// A preallocated JSON document and output buffer for one API response
+struct JsonResponseSlot {
+    StaticJsonDocument<JSON_RESPONSE_DOC_SIZE> doc;
+    char buffer[JSON_RESPONSE_BUFFER_SIZE];
+    size_t length;
+};
+
+// Response pool statistics
+struct JsonResponsePoolStats {
+    uint32_t in_use;
+    uint32_t max_in_use;
+    uint32_t exhausted;                   // Requests answered 503 because the pool was empty
+    uint32_t overflows;                   // Documents that did not fit the output buffer
+};
+
+// Function prototypes
+void setupJsonResponsePool();
+JsonResponseSlot* acquireJsonSlot();
+JsonResponseSlot* beginJsonResponse(AsyncWebServerRequest* request);
+void releaseJsonSlot(JsonResponseSlot* slot);
+void sendJsonSlot(AsyncWebServerRequest* request, JsonResponseSlot* slot, int code = 200);
+void sendText(AsyncWebServerRequest* request, int code, const char* text);
+void getJsonResponsePoolStats(JsonResponsePoolStats& stats);
+
+// Request parameter helpers that never copy the value into a String
+const char* getParamValue(AsyncWebServerRequest* request, const char* name, bool post = true);
+bool getParamInt64(AsyncWebServerRequest* request, const char* name, int64_t& value, bool post = true);
+bool getParamInt32(AsyncWebServerRequest* request, const char* name, int32_t& value, bool post = true);
+
+#endif // API_RESPONSE_H
@@ -0,0 +1,250 @@
+#include "batch_api.h"
+#include "wifi_manager.h"
+#include "api_response.h"
+#include "status_push.h"
+#include "config.h"
+#include "config_schema.h"
+#include "rotator.h"
+#include "main.h"
+
+#define BATCH_STRINGIFY(x) #x
+#define BATCH_TO_STRING(x) BATCH_STRINGIFY(x)
+
+// Operations accepted by /api/batch, mirroring the single-shot endpoints
+enum BatchOpType {
+    BATCH_OP_INVALID,
+    BATCH_OP_SETTINGS,    // /api/settings
+    BATCH_OP_ROTATE,      // /api/rotate
+    BATCH_OP_GOTO,        // /api/goto
+    BATCH_OP_SET_ZERO,    // /api/set-zero
+    BATCH_OP_STATUS,      // /api/status
+};
+
+/**
+ * Map an op name to its type
+ */
+static BatchOpType parseBatchOpType(const char* name) {
+    if (!name) return BATCH_OP_INVALID;
+    if (strcmp(name, "settings") == 0) return BATCH_OP_SETTINGS;
+    if (strcmp(name, "rotate") == 0) return BATCH_OP_ROTATE;
+    if (strcmp(name, "goto") == 0) return BATCH_OP_GOTO;
+    if (strcmp(name, "set-zero") == 0) return BATCH_OP_SET_ZERO;
+    if (strcmp(name, "status") == 0) return BATCH_OP_STATUS;
+    return BATCH_OP_INVALID;
+}
+
+/**
+ * Check one op's arguments without executing it
+ * Returns nullptr when valid, otherwise an error message
+ */
+static const char* validateBatchOp(JsonObject op, BatchOpType type) {
+    switch (type) {
+        case BATCH_OP_SETTINGS:
+            if (!op["values"].is<JsonObject>()) {
+                return "'values' must be an object";
+            }
+            if (findInvalidSetting(op["values"].as<JsonObject>())) {
+                return "Invalid setting value";
+            }
+            return nullptr;
+
+        case BATCH_OP_ROTATE: {
+            if (!op["angle"].is<int>()) {
+                return "Missing 'angle' parameter";
+            }
+            int angle = op["angle"];
+            if (angle != 0 && angle != 90 && angle != 180 && angle != 270) {
+                return "Angle must be 0, 90, 180, or 270";
+            }
+            return nullptr;
+        }
+
+        case BATCH_OP_GOTO:
+            if (!op["position"].is<int64_t>()) {
+                return "Missing 'position' parameter";
+            }
+            return nullptr;
+
+        case BATCH_OP_SET_ZERO:
+        case BATCH_OP_STATUS:
+            return nullptr;
+
+        case BATCH_OP_INVALID:
+        default:
+            return "Unknown op";
+    }
+}
+
+/**
+ * Ops that move the motor or its reference; once one has run, the batch is not undone
+ */
+static bool batchOpHasSideEffects(BatchOpType type) {
+    return type == BATCH_OP_ROTATE || type == BATCH_OP_GOTO || type == BATCH_OP_SET_ZERO;
+}
+
+/**
+ * Handle POST /api/batch
+ *
+ * Body: [{"op": "settings", "values": {...}}, {"op": "set-zero"},
+ *        {"op": "rotate", "angle": 90}, {"op": "status"}]
+ * (other ops: {"op": "goto", "position": 1000})
+ * (or {"ops": [...]})
+ *
+ * Every op is validated before any is executed, so a malformed batch changes
+ * nothing. A batch may start at most one move, and only while the motor is idle
+ * (a second move would always be refused, since the first is still running).
+ * Ops then run in order; settings take effect in RAM immediately (so a later goto
+ * uses new motion parameters). If an op fails, the remaining ops are skipped; the
+ * batch's settings are rolled back unless a move or set-zero already ran under
+ * them. Whatever stays applied is saved once, after the last op.
+ */
+static void handleBatchRequest(AsyncWebServerRequest *request, JsonVariant &json) {
+    JsonArray ops = json.is<JsonArray>() ? json.as<JsonArray>() : json["ops"].as<JsonArray>();
+    if (ops.isNull()) {
+        sendText(request, 400, "Body must be an array of operations");
+        return;
+    }
+    if (ops.size() == 0 || ops.size() > BATCH_MAX_OPS) {
+        sendText(request, 400, "Batch must contain 1 to " BATCH_TO_STRING(BATCH_MAX_OPS) " operations");
+        return;
+    }
+
+    JsonResponseSlot *slot = beginJsonResponse(request);
+    if (!slot) return;
+    JsonDocument &doc = slot->doc;
+    JsonArray results = doc.createNestedArray("results");
+
+    // Validation pass: nothing is applied unless every op is well formed and can run
+    BatchOpType types[BATCH_MAX_OPS];
+    bool valid = true;
+    bool busy = false;
+    bool moveSeen = false;
+    size_t index = 0;
+    for (JsonObject op : ops) {
+        types[index] = parseBatchOpType(op["op"]);
+        const char* error = validateBatchOp(op, types[index]);
+        if (!error && (types[index] == BATCH_OP_ROTATE || types[index] == BATCH_OP_GOTO)) {
+            if (moveSeen) {
+                error = "Only one goto or rotate per batch";
+            } else if (is_motion_active()) {
+                error = "A move is already running";
+                busy = true;
+            }
+            moveSeen = true;
+        }
+
+        JsonObject result = results.createNestedObject();
+        result["op"] = op["op"].as<const char*>();
+        result["applied"] = false;
+        if (error) {
+            result["ok"] = false;
+            result["error"] = error;
+            valid = false;
+        }
+        index++;
+    }
+
+    if (!valid) {
+        doc["ok"] = false;
+        doc["applied"] = false;
+        sendJsonSlot(request, slot, busy ? 409 : 400);
+        return;
+    }
+
+    log_i("Batch API access: %u ops", ops.size());
+
+    // Execution pass; the configuration before the batch is kept for the rollback
+    RotatorConfig committed = config;
+    bool configDirty = false;
+    bool sideEffects = false;
+    bool failed = false;
+    index = 0;
+    for (JsonObject op : ops) {
+        JsonObject result = results[index++];
+        if (failed) {
+            result["ok"] = false;
+            result["error"] = "Skipped after an earlier op failed";
+            continue;
+        }
+
+        const char* error = nullptr;
+        switch (types[index - 1]) {
+            case BATCH_OP_SETTINGS:
+                applySettingsJson(op["values"].as<JsonObject>(), config);
+                applyRuntimeConfig();
+                configDirty = true;
+                break;
+
+            // A move started elsewhere since validation (UDP, fleet, auto-rotation) still refuses these
+            case BATCH_OP_ROTATE:
+                if (!rotateToAngle(op["angle"].as<int>())) {
+                    error = "Rotate refused, a move is already running";
+                }
+                break;
+
+            case BATCH_OP_GOTO:
+                if (!move_to_position(op["position"].as<int64_t>())) {
+                    error = "Goto refused, a move is already running";
+                }
+                break;
+
+            case BATCH_OP_SET_ZERO:
+                reset_motor_control();
+                break;
+
+            case BATCH_OP_STATUS: {
+                StatusSnapshot snapshot;
+                captureStatus(snapshot);
+                writeStatusJson(result.createNestedObject("status"), snapshot, nullptr);
+                break;
+            }
+
+            case BATCH_OP_INVALID:
+            default:
+                error = "Unknown op";
+                break;
+        }
+
+        result["ok"] = (error == nullptr);
+        result["applied"] = (error == nullptr);
+        if (error) {
+            result["error"] = error;
+            failed = true;
+        } else if (batchOpHasSideEffects(types[index - 1])) {
+            sideEffects = true;
+        }
+    }
+
+    // Settings are all-or-nothing until something has run under them; only the fields the
+    // batch set are put back, so concurrent changes from other handlers survive
+    if (failed && configDirty && !sideEffects) {
+        index = 0;
+        for (JsonObject op : ops) {
+            if (types[index] == BATCH_OP_SETTINGS && results[index]["applied"].as<bool>()) {
+                restoreSettingsJson(op["values"].as<JsonObject>(), config, committed);
+                results[index]["applied"] = false;
+            }
+            index++;
+        }
+        applyRuntimeConfig();
+        configDirty = false;
+    }
+    if (configDirty) {
+        // Single save request for the whole batch
+        requestConfigSave();
+        doc["saveQueued"] = true;
+    }
+
+    doc["ok"] = !failed;
+    doc["applied"] = !failed || configDirty || sideEffects;
+    sendJsonSlot(request, slot);
+}
+
+/**
+ * Register the /api/batch endpoint
+ */
+void setupBatchApi() {
+    AsyncCallbackJsonWebHandler* batchHandler = new AsyncCallbackJsonWebHandler("/api/batch", handleBatchRequest);
+    webServer.addHandler(batchHandler);
+    log_i("Batch API handler setup complete");
+}
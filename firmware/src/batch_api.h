@@ -0,0 +1,12 @@
+#ifndef BATCH_API_H
+#define BATCH_API_H
+
+#include <Arduino.h>
+
+// Batch endpoint limits
+#define BATCH_MAX_OPS 16
+
+// Function prototypes
+void setupBatchApi();
+
+#endif // BATCH_API_H
@@ -0,0 +1,90 @@
+#include "boot_profile.h"
+#include <esp_timer.h>
+
+// Phases are recorded from setup() and the network startup task at the same time
+static portMUX_TYPE profileLock = portMUX_INITIALIZER_UNLOCKED;
+static BootPhase phases[BOOT_PROFILE_MAX_PHASES] = {};
+static uint8_t phaseCount = 0;
+static volatile int64_t milestones[BOOT_MILESTONE_COUNT] = { -1, -1, -1 };
+
+static const char* const milestoneNames[BOOT_MILESTONE_COUNT] = {
+    "motor ready",
+    "network ready",
+    "startup done",
+};
+
+/**
+ * Start timing a phase; returns its index, or -1 when the table is full
+ */
+int beginBootPhase(const char* name) {
+    int64_t now_us = esp_timer_get_time();
+    int phase = -1;
+
+    portENTER_CRITICAL(&profileLock);
+    if (phaseCount < BOOT_PROFILE_MAX_PHASES) {
+        phase = phaseCount++;
+        phases[phase].name = name;
+        phases[phase].core = xPortGetCoreID();
+        phases[phase].start_us = now_us;
+        phases[phase].end_us = 0;
+    }
+    portEXIT_CRITICAL(&profileLock);
+    return phase;
+}
+
+void endBootPhase(int phase) {
+    if (phase < 0) {
+        return;
+    }
+    int64_t now_us = esp_timer_get_time();
+    portENTER_CRITICAL(&profileLock);
+    phases[phase].end_us = now_us;
+    portEXIT_CRITICAL(&profileLock);
+}
+
+/**
+ * Run one setup step as a timed phase
+ */
+void runBootPhase(const char* name, void (*phase)()) {
+    int index = beginBootPhase(name);
+    phase();
+    endBootPhase(index);
+}
+
+void markBootMilestone(BootMilestone milestone) {
+    if (milestone < BOOT_MILESTONE_COUNT && milestones[milestone] < 0) {
+        milestones[milestone] = esp_timer_get_time();
+    }
+}
+
+int64_t getBootMilestoneUs(BootMilestone milestone) {
+    return milestone < BOOT_MILESTONE_COUNT ? milestones[milestone] : -1;
+}
+
+uint8_t getBootPhaseCount() {
+    return phaseCount;
+}
+
+const BootPhase* getBootPhase(uint8_t index) {
+    return index < phaseCount ? &phases[index] : NULL;
+}
+
+/**
+ * Print the timeline, in start order
+ */
+void logBootProfile() {
+    for (uint8_t i = 0; i < phaseCount; i++) {
+        const BootPhase& phase = phases[i];
+        if (phase.end_us) {
+            log_i("Boot %-16s core %u  start %7lld us  took %7lld us", phase.name, phase.core,
+                  phase.start_us, phase.end_us - phase.start_us);
+        } else {
+            log_i("Boot %-16s core %u  start %7lld us  still running", phase.name, phase.core, phase.start_us);
+        }
+    }
+    for (int i = 0; i < BOOT_MILESTONE_COUNT; i++) {
+        if (milestones[i] >= 0) {
+            log_i("Boot %s at %lld ms", milestoneNames[i], milestones[i] / 1000);
+        }
+    }
+}
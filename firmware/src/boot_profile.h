@@ -0,0 +1,35 @@
+#ifndef BOOT_PROFILE_H
+#define BOOT_PROFILE_H
+
+#include <Arduino.h>
+
+// Boot timeline configuration
+#define BOOT_PROFILE_MAX_PHASES 24          // Later phases still run, untimed
+
+// Points on the boot timeline reported besides the phases
+enum BootMilestone : uint8_t {
+    BOOT_MILESTONE_MOTOR_READY,         // Encoders, PWM and the control loop timers running
+    BOOT_MILESTONE_NETWORK_READY,       // WiFi up (station or AP) and the web server listening
+    BOOT_MILESTONE_STARTUP_DONE,        // Both startup paths finished, self-test included
+    BOOT_MILESTONE_COUNT
+};
+
+// One timed step of setup(); times are esp_timer microseconds since boot
+struct BootPhase {
+    const char* name;
+    uint8_t core;                       // Core the phase ran on
+    int64_t start_us;
+    int64_t end_us;                     // 0 while the phase is running
+};
+
+// Function prototypes
+int beginBootPhase(const char* name);
+void endBootPhase(int phase);
+void runBootPhase(const char* name, void (*phase)());
+void markBootMilestone(BootMilestone milestone);
+int64_t getBootMilestoneUs(BootMilestone milestone);     // -1 until reached
+uint8_t getBootPhaseCount();
+const BootPhase* getBootPhase(uint8_t index);
+void logBootProfile();
+
+#endif // BOOT_PROFILE_H
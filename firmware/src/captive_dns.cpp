@@ -0,0 +1,148 @@
+#include "captive_dns.h"
+#include <AsyncUDP.h>
+#include <WiFi.h>
+
+// DNS wire format
+#define DNS_HEADER_SIZE 12
+#define DNS_FLAG_QR 0x8000
+#define DNS_OPCODE_MASK 0x7800
+#define DNS_TYPE_A 1
+#define DNS_TYPE_ANY 255
+#define DNS_CLASS_IN 1
+
+// Queries are answered in the async_udp task as they arrive
+static AsyncUDP dnsUdp;
+
+// Answer record appended after the echoed question: a pointer to the question name,
+// type A, class IN, TTL and the AP address. Rebuilt when the AP starts, so a query costs two copies
+static uint8_t answerTemplate[16];
+static IPAddress apAddress;
+
+static volatile bool listening = false;
+static volatile uint32_t answeredCount = 0;
+static volatile uint32_t emptyCount = 0;
+static volatile uint32_t ignoredCount = 0;
+
+static uint16_t readBE16(const uint8_t* p) {
+    return (p[0] << 8) | p[1];
+}
+
+static void writeBE16(uint8_t* p, uint16_t value) {
+    p[0] = value >> 8;
+    p[1] = value;
+}
+
+/**
+ * Answer every A query with the AP address; other types get an empty NOERROR answer
+ */
+static void onDnsPacket(AsyncUDPPacket& packet) {
+    const uint8_t* query = packet.data();
+    size_t length = packet.length();
+
+    // Only clients of the soft AP are captive; never answer for the station side
+    if (packet.localIP() != apAddress) {
+        return;
+    }
+
+    if (length < DNS_HEADER_SIZE + 5 || length > CAPTIVE_DNS_MAX_PACKET) {
+        ignoredCount++;
+        return;
+    }
+    uint16_t flags = readBE16(query + 2);
+    if ((flags & DNS_FLAG_QR) || (flags & DNS_OPCODE_MASK) || readBE16(query + 4) != 1) {
+        ignoredCount++;
+        return;
+    }
+
+    // Walk the question name to find where the question ends
+    size_t offset = DNS_HEADER_SIZE;
+    while (offset < length && query[offset] != 0) {
+        if (query[offset] & 0xC0) {
+            ignoredCount++;             // Compression pointers have no place in a question
+            return;
+        }
+        offset += query[offset] + 1;
+    }
+    size_t questionEnd = offset + 5;    // Root label, QTYPE, QCLASS
+    if (questionEnd > length) {
+        ignoredCount++;
+        return;
+    }
+    uint16_t qtype = readBE16(query + offset + 1);
+    uint16_t qclass = readBE16(query + offset + 3);
+    bool answer = (qclass == DNS_CLASS_IN) && (qtype == DNS_TYPE_A || qtype == DNS_TYPE_ANY);
+
+    // Echo the id and question; additional records (EDNS) are dropped
+    uint8_t response[CAPTIVE_DNS_MAX_PACKET + sizeof(answerTemplate)];
+    memcpy(response, query, questionEnd);
+    response[2] = 0x84 | (query[2] & 0x01);     // Response, authoritative, RD echoed
+    response[3] = 0x80;                         // Recursion available, NOERROR
+    writeBE16(response + 4, 1);
+    writeBE16(response + 6, answer ? 1 : 0);
+    writeBE16(response + 8, 0);
+    writeBE16(response + 10, 0);
+
+    size_t responseLength = questionEnd;
+    if (answer) {
+        memcpy(response + questionEnd, answerTemplate, sizeof(answerTemplate));
+        responseLength += sizeof(answerTemplate);
+        answeredCount++;
+    } else {
+        emptyCount++;
+    }
+
+    packet.write(response, responseLength);
+}
+
+static void startCaptiveDns() {
+    apAddress = WiFi.softAPIP();
+
+    writeBE16(answerTemplate, 0xC000 | DNS_HEADER_SIZE);
+    writeBE16(answerTemplate + 2, DNS_TYPE_A);
+    writeBE16(answerTemplate + 4, DNS_CLASS_IN);
+    writeBE16(answerTemplate + 6, CAPTIVE_DNS_TTL >> 16);
+    writeBE16(answerTemplate + 8, CAPTIVE_DNS_TTL & 0xFFFF);
+    writeBE16(answerTemplate + 10, 4);
+    for (int i = 0; i < 4; i++) {
+        answerTemplate[12 + i] = apAddress[i];
+    }
+
+    dnsUdp.close();
+    if (!dnsUdp.listen(CAPTIVE_DNS_PORT)) {
+        listening = false;
+        log_w("Captive portal DNS not started");
+        return;
+    }
+    listening = true;
+    log_i("Captive portal DNS answering with %s", apAddress.toString().c_str());
+}
+
+static void onCaptiveDnsWiFiEvent(arduino_event_id_t event, arduino_event_info_t info) {
+    if (event == ARDUINO_EVENT_WIFI_AP_START) {
+        startCaptiveDns();
+    } else {
+        dnsUdp.close();
+        listening = false;
+    }
+}
+
+void getCaptiveDnsStats(CaptiveDnsStats& stats) {
+    stats.listening = listening;
+    stats.answered = answeredCount;
+    stats.empty = emptyCount;
+    stats.ignored = ignoredCount;
+}
+
+/**
+ * Serve captive portal DNS whenever the soft AP is up
+ * Replaces the polled DNSServer: nothing runs until a query arrives
+ */
+void setupCaptiveDns() {
+    dnsUdp.onPacket(onDnsPacket);
+    WiFi.onEvent(onCaptiveDnsWiFiEvent, ARDUINO_EVENT_WIFI_AP_START);
+    WiFi.onEvent(onCaptiveDnsWiFiEvent, ARDUINO_EVENT_WIFI_AP_STOP);
+
+    if (WiFi.getMode() & WIFI_AP) {
+        startCaptiveDns();
+    }
+}
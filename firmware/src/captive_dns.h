@@ -0,0 +1,23 @@
+#ifndef CAPTIVE_DNS_H
+#define CAPTIVE_DNS_H
+
+#include <Arduino.h>
+
+// Captive portal DNS configuration
+#define CAPTIVE_DNS_PORT 53
+#define CAPTIVE_DNS_TTL 60                  // Seconds; short so clients re-resolve once on a real network
+#define CAPTIVE_DNS_MAX_PACKET 512          // Classic UDP DNS limit
+
+// Counters for /api/wifi/status and debugging
+struct CaptiveDnsStats {
+    bool listening;
+    uint32_t answered;                  // A/ANY queries answered with the AP address
+    uint32_t empty;                     // Other query types, answered with no records
+    uint32_t ignored;                   // Malformed packets, responses, multi-question queries
+};
+
+// Function prototypes
+void setupCaptiveDns();
+void getCaptiveDnsStats(CaptiveDnsStats& stats);
+
+#endif // CAPTIVE_DNS_H
@@ -1,61 +1,75 @@
 #include "config.h"
 #include "main.h"
 #include "rotator.h"
+#include "event_bus.h"
+#include "config_schema.h"
 #include <WiFi.h>
+#include <Preferences.h>
+#include <esp_rom_crc.h>
+#include <esp_timer.h>
+#include <esp_system.h>
 
 // Global configuration instance
 RotatorConfig config;
 
+// Prefixes each stored configuration image
+struct ConfigRecordHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t length;                    // sizeof(RotatorConfig) in the firmware that wrote it
+    uint32_t sequence;                  // Higher is newer
+    uint32_t crc;                       // CRC32 of the header (with crc = 0) and the image
+};
+
+struct ConfigRecord {
+    ConfigRecordHeader header;
+    RotatorConfig config;
+};
+
+// Records alternate between two keys, so a write that never completes leaves the
+// previous record intact
+static const char* const slotKeys[2] = { "cfg_a", "cfg_b" };
+
+static Preferences configStore;
+static SemaphoreHandle_t configStoreLock = NULL;
+static ConfigRecord saveRecord;             // Only used under configStoreLock
+static uint8_t nextSlot = 0;
+static uint32_t nextSequence = 1;
+
+// Deferred saving: a change bumps requestedGeneration, a successful flush catches savedGeneration up
+static TaskHandle_t writerTask = NULL;
+static volatile uint32_t requestedGeneration = 0;
+static volatile uint32_t savedGeneration = 0;
+static volatile uint32_t failedGeneration = 0;      // Newest generation a failed write tried to save
+static ConfigStoreStats storeStats = {};
+
 /**
- * Reset configuration to factory defaults
+ * Fill config with factory defaults without saving
  */
-void resetToDefaultConfig() {
-    // WiFi AP settings
-    strncpy(config.ap_ssid, DEFAULT_AP_SSID, sizeof(config.ap_ssid));
-    strncpy(config.ap_password, DEFAULT_AP_PASSWORD, sizeof(config.ap_password));
-    
-    // WiFi client settings
-    strncpy(config.wifi_ssid, DEFAULT_WIFI_SSID, sizeof(config.wifi_ssid));
-    strncpy(config.wifi_password, DEFAULT_WIFI_PASSWORD, sizeof(config.wifi_password));
-    config.wifi_client_enabled = DEFAULT_WIFI_CLIENT_ENABLED;
-    config.wifi_connection_timeout = DEFAULT_WIFI_CONNECTION_TIMEOUT;
+static void loadDefaultConfig() {
+    applyConfigDefaults(config);
     
     // Generate mDNS name from MAC address
     generateMDNSName();
-    
-    // Motor positions
-    config.pos_0_degrees = POS_0_DEGREES;
-    config.pos_90_degrees = POS_90_DEGREES;
-    config.pos_180_degrees = POS_180_DEGREES;
-    config.pos_270_degrees = POS_270_DEGREES;
-    
-    // NeoPixel colors
-    config.color_0 = DEFAULT_COLOR_0;
-    config.color_90 = DEFAULT_COLOR_90;
-    config.color_180 = DEFAULT_COLOR_180;
-    config.color_270 = DEFAULT_COLOR_270;
+}
 
-    config.full_rotation_count = FULL_ROTATION_COUNT;
-    
-    // Rotation settings
-    config.rotation_interval = DEFAULT_ROTATION_INTERVAL;
-    config.auto_rotation_enabled = false;
-    config.auto_rotate_forward = true;
-    
-    // Motion control parameters
-    config.position_hysteresis = DEFAULT_POSITION_HYSTERESIS;
-    config.max_speed = DEFAULT_MAX_SPEED;
-    config.acceleration = DEFAULT_ACCELERATION;
-    config.vel_loop_p = DEFAULT_VEL_LOOP_P;
-    config.vel_loop_i = DEFAULT_VEL_LOOP_I;
-    config.vel_loop_d = DEFAULT_VEL_LOOP_D;
-    config.vel_filter_persistence = DEFAULT_VEL_FILTER_PERSISTENCE;
-    config.spd_err_persistence = DEFAULT_SPD_ERR_PERSISTENCE;
+/**
+ * Reset configuration to factory defaults
+ */
+void resetToDefaultConfig() {
+    loadDefaultConfig();
     
-    // Save to file
-    saveConfiguration();
+    // Save to flash
+    requestConfigSave();
     
-    // Update runtime motion control parameters
+    // Update runtime motion control and calibration parameters
+    applyRuntimeConfig();
+}
+
+/**
+ * Push the motion control and calibration settings in config to the control loop
+ */
+void applyRuntimeConfig() {
     setMotionControlConfig(config.position_hysteresis, config.max_speed, config.acceleration,
                           config.vel_loop_p, config.vel_loop_i, config.vel_loop_d,
                           config.vel_filter_persistence, config.spd_err_persistence);
@@ -64,13 +78,86 @@ void resetToDefaultConfig() {
     updateMotionControlCalibration();
 }
 
+static uint32_t recordCrc(ConfigRecordHeader* header, size_t length) {
+    uint32_t stored = header->crc;
+    header->crc = 0;
+    uint32_t crc = esp_rom_crc32_le(0, (const uint8_t*)header, length);
+    header->crc = stored;
+    return crc;
+}
+
 /**
- * Load configuration from SPIFFS
+ * Read one slot into a malloc'd buffer; returns NULL unless the record is intact
  */
-bool loadConfiguration() {
+static ConfigRecordHeader* readSlot(uint8_t slot) {
+    size_t length = configStore.getBytesLength(slotKeys[slot]);
+    if (length < sizeof(ConfigRecordHeader)) {
+        return NULL;
+    }
+
+    ConfigRecordHeader* header = (ConfigRecordHeader*)malloc(length);
+    if (!header) {
+        return NULL;
+    }
+    if (configStore.getBytes(slotKeys[slot], header, length) != length ||
+        header->magic != CONFIG_RECORD_MAGIC ||
+        header->version != CONFIG_RECORD_VERSION ||
+        header->length != length - sizeof(ConfigRecordHeader) ||
+        header->crc != recordCrc(header, length)) {
+        log_w("Configuration slot %s is invalid", slotKeys[slot]);
+        free(header);
+        return NULL;
+    }
+    return header;
+}
+
+/**
+ * Load the newest intact record over the defaults
+ * A shorter record (older firmware) leaves the appended fields at their defaults
+ */
+static bool loadConfigRecord() {
+    ConfigRecordHeader* records[2] = { readSlot(0), readSlot(1) };
+
+    int newest = -1;
+    for (int i = 0; i < 2; i++) {
+        if (records[i] && (newest < 0 || records[i]->sequence > records[newest]->sequence)) {
+            newest = i;
+        }
+    }
+
+    if (newest >= 0) {
+        ConfigRecordHeader* header = records[newest];
+        memcpy(&config, header + 1, min((size_t)header->length, sizeof(RotatorConfig)));
+        int repaired = sanitizeConfig(config);
+        if (repaired) {
+            log_w("Reset %d out-of-range configuration fields to defaults", repaired);
+        }
+        nextSlot = newest ^ 1;
+        nextSequence = header->sequence + 1;
+        log_i("Configuration loaded from %s (sequence %u)", slotKeys[newest], header->sequence);
+    }
+
+    free(records[0]);
+    free(records[1]);
+    return newest >= 0;
+}
+
+/**
+ * Read the JSON configuration written by earlier firmware
+ */
+static bool importLegacyConfig() {
+    // Startup mounts SPIFFS later, in the background; a blank partition holds no legacy file
+    if (!SPIFFS.begin(false)) {
+        return false;
+    }
+
+    // Finish a save that was interrupted after the old file was removed
+    if (!SPIFFS.exists(CONFIG_FILE) && SPIFFS.exists(CONFIG_TEMP_FILE)) {
+        log_w("Recovering configuration from interrupted save");
+        SPIFFS.rename(CONFIG_TEMP_FILE, CONFIG_FILE);
+    }
+
     if (!SPIFFS.exists(CONFIG_FILE)) {
-        log_i("Configuration file not found, creating default");
-        resetToDefaultConfig();
         return false;
     }
     
@@ -80,7 +167,7 @@ bool loadConfiguration() {
         return false;
     }
     
-    StaticJsonDocument<1536> doc;
+    StaticJsonDocument<CONFIG_JSON_SIZE> doc;
     DeserializationError error = deserializeJson(doc, file);
     file.close();
     
@@ -89,126 +176,192 @@ bool loadConfiguration() {
         return false;
     }
     
-    // WiFi AP settings
-    strlcpy(config.ap_ssid, 
-            doc["ap_ssid"] | DEFAULT_AP_SSID, 
-            sizeof(config.ap_ssid));
-    strlcpy(config.ap_password, 
-            doc["ap_password"] | DEFAULT_AP_PASSWORD, 
-            sizeof(config.ap_password));
-    
-    // WiFi client settings
-    strlcpy(config.wifi_ssid, 
-            doc["wifi_ssid"] | DEFAULT_WIFI_SSID, 
-            sizeof(config.wifi_ssid));
-    strlcpy(config.wifi_password, 
-            doc["wifi_password"] | DEFAULT_WIFI_PASSWORD, 
-            sizeof(config.wifi_password));
-    config.wifi_client_enabled = doc["wifi_client_enabled"] | DEFAULT_WIFI_CLIENT_ENABLED;
-    config.wifi_connection_timeout = doc["wifi_connection_timeout"] | DEFAULT_WIFI_CONNECTION_TIMEOUT;
-    
-    // mDNS name - generate if not set or empty
-    const char* saved_mdns = doc["mdns_name"];
-    if (saved_mdns && strlen(saved_mdns) > 0) {
-        strlcpy(config.mdns_name, saved_mdns, sizeof(config.mdns_name));
-    } else {
+    readConfigJson(doc.as<JsonObjectConst>(), config);
+    if (config.mdns_name[0] == '\0') {
         generateMDNSName();
     }
     
-    // Motor positions
-    config.pos_0_degrees = doc["pos_0_degrees"] | POS_0_DEGREES;
-    config.pos_90_degrees = doc["pos_90_degrees"] | POS_90_DEGREES;
-    config.pos_180_degrees = doc["pos_180_degrees"] | POS_180_DEGREES;
-    config.pos_270_degrees = doc["pos_270_degrees"] | POS_270_DEGREES;
-
-    config.full_rotation_count = doc["full_rotation_count"] | FULL_ROTATION_COUNT;
-    
-    // NeoPixel colors
-    config.color_0 = doc["color_0"] | DEFAULT_COLOR_0;
-    config.color_90 = doc["color_90"] | DEFAULT_COLOR_90;
-    config.color_180 = doc["color_180"] | DEFAULT_COLOR_180;
-    config.color_270 = doc["color_270"] | DEFAULT_COLOR_270;
-    
-    // Rotation settings
-    config.rotation_interval = doc["rotation_interval"] | DEFAULT_ROTATION_INTERVAL;
-    config.auto_rotation_enabled = doc["auto_rotation_enabled"] | false;
-    
-    // Motion control parameters
-    config.position_hysteresis = doc["position_hysteresis"] | DEFAULT_POSITION_HYSTERESIS;
-    config.max_speed = doc["max_speed"] | DEFAULT_MAX_SPEED;
-    config.acceleration = doc["acceleration"] | DEFAULT_ACCELERATION;
-    config.vel_loop_p = doc["vel_loop_p"] | DEFAULT_VEL_LOOP_P;
-    config.vel_loop_i = doc["vel_loop_i"] | DEFAULT_VEL_LOOP_I;
-    config.vel_loop_d = doc["vel_loop_d"] | DEFAULT_VEL_LOOP_D;
-    config.vel_filter_persistence = doc["vel_filter_persistence"] | DEFAULT_VEL_FILTER_PERSISTENCE;
-    config.spd_err_persistence = doc["spd_err_persistence"] | DEFAULT_SPD_ERR_PERSISTENCE;
-    
-    log_i("Configuration loaded successfully");
     return true;
 }
 
 /**
- * Save configuration to SPIFFS
+ * Save deferred changes once they stop arriving, or after CONFIG_SAVE_MAX_DELAY_MS at most
  */
-bool saveConfiguration() {
-    StaticJsonDocument<1536> doc;
-    
-    // WiFi AP settings
-    doc["ap_ssid"] = config.ap_ssid;
-    doc["ap_password"] = config.ap_password;
-    
-    // WiFi client settings
-    doc["wifi_ssid"] = config.wifi_ssid;
-    doc["wifi_password"] = config.wifi_password;
-    doc["wifi_client_enabled"] = config.wifi_client_enabled;
-    doc["wifi_connection_timeout"] = config.wifi_connection_timeout;
-    doc["mdns_name"] = config.mdns_name;
-    
-    // Motor positions
-    doc["pos_0_degrees"] = config.pos_0_degrees;
-    doc["pos_90_degrees"] = config.pos_90_degrees;
-    doc["pos_180_degrees"] = config.pos_180_degrees;
-    doc["pos_270_degrees"] = config.pos_270_degrees;
-    
-    doc["full_rotation_count"] = config.full_rotation_count;
+static void configWriterTask(void* arg) {
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
 
-    // NeoPixel colors
-    doc["color_0"] = config.color_0;
-    doc["color_90"] = config.color_90;
-    doc["color_180"] = config.color_180;
-    doc["color_270"] = config.color_270;
-    
-    // Rotation settings
-    doc["rotation_interval"] = config.rotation_interval;
-    doc["auto_rotation_enabled"] = config.auto_rotation_enabled;
-    
-    // Motion control parameters
-    doc["position_hysteresis"] = config.position_hysteresis;
-    doc["max_speed"] = config.max_speed;
-    doc["acceleration"] = config.acceleration;
-    doc["vel_loop_p"] = config.vel_loop_p;
-    doc["vel_loop_i"] = config.vel_loop_i;
-    doc["vel_loop_d"] = config.vel_loop_d;
-    doc["vel_filter_persistence"] = config.vel_filter_persistence;
-    doc["spd_err_persistence"] = config.spd_err_persistence;
-    
-    File file = SPIFFS.open(CONFIG_FILE, "w");
-    if (!file) {
-        log_e("Failed to open config file for writing");
+        // Every new request restarts the quiet period
+        uint32_t first_ms = millis();
+        for (;;) {
+            uint32_t waited_ms = millis() - first_ms;
+            if (waited_ms >= CONFIG_SAVE_MAX_DELAY_MS) {
+                break;
+            }
+            uint32_t wait_ms = min((uint32_t)CONFIG_SAVE_QUIET_MS, CONFIG_SAVE_MAX_DELAY_MS - waited_ms);
+            if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(wait_ms)) == 0) {
+                break;
+            }
+        }
+
+        // Try again after another quiet period
+        if (!flushConfiguration()) {
+            xTaskNotifyGive(writerTask);
+        }
+    }
+}
+
+/**
+ * Write pending changes before esp_restart() (OTA, /api/reset, self-test rollback)
+ */
+static void flushOnShutdown() {
+    flushConfiguration();
+}
+
+/**
+ * Load configuration from NVS, migrating the legacy JSON file on first boot
+ * Returns false when the defaults were used
+ */
+bool loadConfiguration() {
+    configStoreLock = xSemaphoreCreateMutex();
+    if (!configStore.begin(CONFIG_NVS_NAMESPACE, false)) {
+        log_e("Failed to open configuration store");
+    }
+    xTaskCreate(configWriterTask, "config_writer", CONFIG_WRITER_STACK_SIZE,
+                NULL, CONFIG_WRITER_PRIORITY, &writerTask);
+    esp_register_shutdown_handler(flushOnShutdown);
+
+    int64_t start_us = esp_timer_get_time();
+    loadDefaultConfig();
+    if (loadConfigRecord()) {
+        log_i("Configuration loaded in %lld us", esp_timer_get_time() - start_us);
+        return true;
+    }
+
+    if (importLegacyConfig()) {
+        log_i("Migrating %s to NVS", CONFIG_FILE);
+        saveConfiguration();
+        return true;
+    }
+
+    log_i("No stored configuration, saving defaults");
+    saveConfiguration();
+    return false;
+}
+
+/**
+ * Save configuration to NVS now
+ * Writes the slot not holding the newest record; NVS commits each write atomically
+ * Handlers call requestConfigSave() instead so they never wait on flash
+ */
+bool saveConfiguration() {
+    if (!configStoreLock) {
+        log_e("Configuration store not initialized");
         return false;
     }
-    
-    if (serializeJson(doc, file) == 0) {
-        log_e("Failed to write config to file");
-        file.close();
+
+    xSemaphoreTake(configStoreLock, portMAX_DELAY);
+    int64_t start_us = esp_timer_get_time();
+
+    saveRecord.header.magic = CONFIG_RECORD_MAGIC;
+    saveRecord.header.version = CONFIG_RECORD_VERSION;
+    saveRecord.header.length = sizeof(RotatorConfig);
+    saveRecord.header.sequence = nextSequence;
+    saveRecord.config = config;
+    saveRecord.header.crc = recordCrc(&saveRecord.header, sizeof(saveRecord));
+
+    uint8_t slot = nextSlot;
+    bool saved = configStore.putBytes(slotKeys[slot], &saveRecord, sizeof(saveRecord)) == sizeof(saveRecord);
+    if (saved) {
+        nextSlot = slot ^ 1;
+        nextSequence++;
+    }
+    int64_t elapsed_us = esp_timer_get_time() - start_us;
+    xSemaphoreGive(configStoreLock);
+
+    if (!saved) {
+        log_e("Failed to write configuration to %s", slotKeys[slot]);
         return false;
     }
-    
-    file.close();
-    log_i("Configuration saved successfully");
+
+    log_i("Configuration saved to %s in %lld us", slotKeys[slot], elapsed_us);
     return true;
 }
 
+/**
+ * Mark the configuration changed; the writer task saves it once changes settle
+ * Callers update config in RAM first and return without touching flash
+ * Returns the change's generation, for getConfigSaveState()
+ */
+uint32_t requestConfigSave() {
+    uint32_t generation = ++requestedGeneration;
+    storeStats.save_requests++;
+    notifyConfigChanged();
+
+    if (writerTask) {
+        xTaskNotifyGive(writerTask);
+    }
+    return generation;
+}
+
+/**
+ * Whether the change from requestConfigSave() has reached flash yet
+ */
+ConfigSaveState getConfigSaveState(uint32_t generation) {
+    if ((int32_t)(savedGeneration - generation) >= 0) {
+        return CONFIG_SAVE_DONE;
+    }
+    if ((int32_t)(failedGeneration - generation) >= 0) {
+        return CONFIG_SAVE_FAILED;
+    }
+    return CONFIG_SAVE_PENDING;
+}
+
+/**
+ * Write pending changes now, if there are any
+ */
+bool flushConfiguration() {
+    uint32_t generation = requestedGeneration;
+    if (generation == savedGeneration) {
+        return true;
+    }
+
+    int64_t start_us = esp_timer_get_time();
+    bool saved = saveConfiguration();
+    uint32_t elapsed_us = esp_timer_get_time() - start_us;
+
+    if (saved) {
+        savedGeneration = generation;
+        storeStats.flushes++;
+        storeStats.last_flush_us = elapsed_us;
+        storeStats.max_flush_us = max(storeStats.max_flush_us, elapsed_us);
+    } else {
+        failedGeneration = generation;
+        storeStats.failures++;
+    }
+    return saved;
+}
+
+void getConfigStoreStats(ConfigStoreStats& stats) {
+    stats = storeStats;
+    stats.dirty = (requestedGeneration != savedGeneration);
+}
+
+/**
+ * Let push subscribers know the configuration changed
+ */
+void notifyConfigChanged() {
+    postEvent(EVENT_CONFIG_CHANGED);
+}
+
+/**
+ * Forget the cached access point (e.g. when the network changes)
+ */
+void clearWiFiCache(RotatorConfig& target) {
+    memset(target.wifi_bssid, 0, sizeof(target.wifi_bssid));
+    target.wifi_channel = 0;
+}
+
 /**
  * Generate mDNS name from MAC address
  * Format: "rotator-XXXX" where XXXX is the last 4 hex digits of MAC
@@ -1,9 +1,13 @@
 #ifndef CONFIG_H
 #define CONFIG_H
 
+#ifdef ARDUINO
 #include <Arduino.h>
-#include <ArduinoJson.h>
 #include <SPIFFS.h>
+#else
+#include <stdint.h>                     // Host build of config_schema.cpp (tools/config_bench.cpp)
+#endif
+#include <ArduinoJson.h>
 
 // Default WiFi settings
 #define DEFAULT_AP_SSID "RotatorAP"
@@ -15,6 +19,13 @@
 #define DEFAULT_WIFI_CLIENT_ENABLED false
 #define DEFAULT_WIFI_CONNECTION_TIMEOUT 5 // seconds
 #define DEFAULT_MDNS_NAME "" // Will be set to "rotator-XXXX" where XXXX is last 4 MAC digits
+#define DEFAULT_WIFI_STATIC_IP "" // Empty = DHCP
+
+// Default fleet settings
+#define DEFAULT_FLEET_GROUPS "" // Comma-separated group names, e.g. "lobby,north"
+
+// Default UDP control settings
+#define DEFAULT_CONTROL_KEY "" // Empty = binary UDP commands are not authenticated
 
 // Motor positions in encoder counts
 
@@ -43,10 +54,24 @@
 #define DEFAULT_VEL_FILTER_PERSISTENCE 0.7f
 #define DEFAULT_SPD_ERR_PERSISTENCE 0.7f
 
-// Configuration file path
+// Configuration storage: a binary record in NVS, written to alternating slots
+#define CONFIG_NVS_NAMESPACE "rotator"
+#define CONFIG_RECORD_MAGIC 0x47464352      // "RCFG"
+#define CONFIG_RECORD_VERSION 1             // Bump when existing fields move; appending fields keeps the version
+
+// Deferred saving: requestConfigSave() returns at once and a writer task saves after a quiet period
+#define CONFIG_SAVE_QUIET_MS 2000           // Save once changes have stopped for this long
+#define CONFIG_SAVE_MAX_DELAY_MS 10000      // Never hold back a change longer than this (slider drags)
+#define CONFIG_WRITER_PRIORITY 2            // Below the event dispatcher
+#define CONFIG_WRITER_STACK_SIZE 4096
+
+// Legacy JSON configuration, imported when no binary record exists (left in place for rollbacks)
 #define CONFIG_FILE "/config.json"
+#define CONFIG_TEMP_FILE "/config.json.tmp"  // Written first, then renamed over CONFIG_FILE
+#define CONFIG_JSON_SIZE 2048                // Document capacity for the import
 
 // Structure to hold all configuration data
+// Stored as a raw image: new fields go at the end so records from older firmware still load
 struct RotatorConfig {
     // WiFi AP settings
     char ap_ssid[32];
@@ -59,6 +84,28 @@ struct RotatorConfig {
     uint32_t wifi_connection_timeout; // seconds
     char mdns_name[32]; // mDNS hostname
     
+    // Static IP (used when wifi_static_ip is set; dotted quads)
+    char wifi_static_ip[16];
+    char wifi_static_gateway[16];
+    char wifi_static_subnet[16];
+    char wifi_static_dns[16];
+    
+    // Fast reconnect cache, learned from the last successful station connection
+    uint8_t wifi_bssid[6];
+    uint8_t wifi_channel; // 0 = nothing cached
+    // Unused (formerly a reused DHCP lease); kept so stored records keep their layout
+    uint32_t reserved_lease_ip;
+    uint32_t reserved_lease_gateway;
+    uint32_t reserved_lease_subnet;
+    uint32_t reserved_lease_dns;
+    bool reserved_reuse_lease;
+    
+    // Fleet settings
+    char fleet_groups[64]; // Comma-separated groups this unit answers to
+    
+    // UDP control settings
+    char control_key[64]; // HMAC-SHA256 key for the binary UDP control protocol
+    
     // Motor position calibration (encoder counts)
     int32_t pos_0_degrees;
     int32_t pos_90_degrees;
@@ -89,13 +136,40 @@ struct RotatorConfig {
     float spd_err_persistence;
 };
 
+// Fate of the change recorded by one requestConfigSave() call
+enum ConfigSaveState : uint8_t {
+    CONFIG_SAVE_PENDING,                // Waiting for the writer
+    CONFIG_SAVE_DONE,                   // On flash
+    CONFIG_SAVE_FAILED                  // The last write attempt failed; the writer keeps retrying
+};
+
+// Save counters for /api/diagnostics/config and /metrics
+struct ConfigStoreStats {
+    uint32_t save_requests;             // requestConfigSave() calls
+    uint32_t flushes;                   // Records written
+    uint32_t failures;
+    uint32_t last_flush_us;
+    uint32_t max_flush_us;
+    bool dirty;                         // RAM holds changes not yet written
+};
+
 // Global configuration object
 extern RotatorConfig config;
 
 // Function prototypes
 bool loadConfiguration();
 bool saveConfiguration();
+uint32_t requestConfigSave();
+ConfigSaveState getConfigSaveState(uint32_t generation);
+bool flushConfiguration();
+void getConfigStoreStats(ConfigStoreStats& stats);
 void resetToDefaultConfig();
+void applyRuntimeConfig();
+void applySettingsJson(JsonObject json, RotatorConfig& target);
+void restoreSettingsJson(JsonObject json, RotatorConfig& target, const RotatorConfig& saved);
+void writeSettingsJson(JsonObject json, const RotatorConfig& source);
 void generateMDNSName();
+void notifyConfigChanged();
+void clearWiFiCache(RotatorConfig& target);
 
 #endif // CONFIG_H 
\ No newline at end of file
@@ -0,0 +1,435 @@
+#include "config_schema.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#define SETTABLE CONFIG_FIELD_SETTABLE
+#define PUBLIC CONFIG_FIELD_PUBLIC
+
+#define CONFIG_STRING(type, field, flags, def) \
+    { #field, type, flags, offsetof(RotatorConfig, field), sizeof(RotatorConfig::field), 0, 0, 0, def }
+#define CONFIG_NUMBER(type, field, flags, def, lo, hi) \
+    { #field, type, flags, offsetof(RotatorConfig, field), sizeof(RotatorConfig::field), lo, hi, (double)(def), NULL }
+
+// The single definition of the configuration fields: defaults, bounds, and where each is visible
+extern constexpr ConfigField configFields[] = {
+    // WiFi AP settings
+    CONFIG_STRING(CONFIG_TYPE_STRING, ap_ssid, SETTABLE | PUBLIC, DEFAULT_AP_SSID),
+    CONFIG_STRING(CONFIG_TYPE_STRING, ap_password, SETTABLE | PUBLIC, DEFAULT_AP_PASSWORD),
+
+    // WiFi client settings (credentials change through the WiFi job endpoints)
+    CONFIG_STRING(CONFIG_TYPE_STRING, wifi_ssid, 0, DEFAULT_WIFI_SSID),
+    CONFIG_STRING(CONFIG_TYPE_STRING, wifi_password, 0, DEFAULT_WIFI_PASSWORD),
+    CONFIG_NUMBER(CONFIG_TYPE_BOOL, wifi_client_enabled, 0, DEFAULT_WIFI_CLIENT_ENABLED, 0, 1),
+    CONFIG_NUMBER(CONFIG_TYPE_UINT32, wifi_connection_timeout, 0, DEFAULT_WIFI_CONNECTION_TIMEOUT, 1, 120),
+    CONFIG_STRING(CONFIG_TYPE_STRING, mdns_name, SETTABLE | PUBLIC, DEFAULT_MDNS_NAME),
+
+    // Static IP
+    CONFIG_STRING(CONFIG_TYPE_IPV4, wifi_static_ip, SETTABLE | PUBLIC, DEFAULT_WIFI_STATIC_IP),
+    CONFIG_STRING(CONFIG_TYPE_IPV4, wifi_static_gateway, SETTABLE | PUBLIC, ""),
+    CONFIG_STRING(CONFIG_TYPE_IPV4, wifi_static_subnet, SETTABLE | PUBLIC, ""),
+    CONFIG_STRING(CONFIG_TYPE_IPV4, wifi_static_dns, SETTABLE | PUBLIC, ""),
+
+    // Fast reconnect cache (learned, never set through the API)
+    { "wifi_bssid", CONFIG_TYPE_MAC, 0, offsetof(RotatorConfig, wifi_bssid), sizeof(RotatorConfig::wifi_bssid), 0, 0, 0, NULL },
+    CONFIG_NUMBER(CONFIG_TYPE_UINT8, wifi_channel, 0, 0, 0, 14),
+    CONFIG_NUMBER(CONFIG_TYPE_UINT32, reserved_lease_ip, 0, 0, 0, UINT32_MAX),
+    CONFIG_NUMBER(CONFIG_TYPE_UINT32, reserved_lease_gateway, 0, 0, 0, UINT32_MAX),
+    CONFIG_NUMBER(CONFIG_TYPE_UINT32, reserved_lease_subnet, 0, 0, 0, UINT32_MAX),
+    CONFIG_NUMBER(CONFIG_TYPE_UINT32, reserved_lease_dns, 0, 0, 0, UINT32_MAX),
+    CONFIG_NUMBER(CONFIG_TYPE_BOOL, reserved_reuse_lease, 0, 0, 0, 1),
+
+    // Fleet settings
+    CONFIG_STRING(CONFIG_TYPE_STRING, fleet_groups, SETTABLE | PUBLIC, DEFAULT_FLEET_GROUPS),
+
+    // UDP control settings (write-only; /api/config reports control_auth instead)
+    CONFIG_STRING(CONFIG_TYPE_STRING, control_key, SETTABLE, DEFAULT_CONTROL_KEY),
+
+    // Motor position calibration
+    CONFIG_NUMBER(CONFIG_TYPE_INT32, pos_0_degrees, SETTABLE | PUBLIC, POS_0_DEGREES, INT32_MIN, INT32_MAX),
+    CONFIG_NUMBER(CONFIG_TYPE_INT32, pos_90_degrees, SETTABLE | PUBLIC, POS_90_DEGREES, INT32_MIN, INT32_MAX),
+    CONFIG_NUMBER(CONFIG_TYPE_INT32, pos_180_degrees, SETTABLE | PUBLIC, POS_180_DEGREES, INT32_MIN, INT32_MAX),
+    CONFIG_NUMBER(CONFIG_TYPE_INT32, pos_270_degrees, SETTABLE | PUBLIC, POS_270_DEGREES, INT32_MIN, INT32_MAX),
+    CONFIG_NUMBER(CONFIG_TYPE_INT32, full_rotation_count, SETTABLE | PUBLIC, FULL_ROTATION_COUNT, 1, INT32_MAX),
+
+    // NeoPixel colors (0xRRGGBB)
+    CONFIG_NUMBER(CONFIG_TYPE_UINT32, color_0, SETTABLE | PUBLIC, DEFAULT_COLOR_0, 0, 0xFFFFFF),
+    CONFIG_NUMBER(CONFIG_TYPE_UINT32, color_90, SETTABLE | PUBLIC, DEFAULT_COLOR_90, 0, 0xFFFFFF),
+    CONFIG_NUMBER(CONFIG_TYPE_UINT32, color_180, SETTABLE | PUBLIC, DEFAULT_COLOR_180, 0, 0xFFFFFF),
+    CONFIG_NUMBER(CONFIG_TYPE_UINT32, color_270, SETTABLE | PUBLIC, DEFAULT_COLOR_270, 0, 0xFFFFFF),
+
+    // Rotation settings
+    CONFIG_NUMBER(CONFIG_TYPE_UINT32, rotation_interval, SETTABLE | PUBLIC, DEFAULT_ROTATION_INTERVAL, 1, 86400),
+    CONFIG_NUMBER(CONFIG_TYPE_BOOL, auto_rotation_enabled, SETTABLE | PUBLIC, false, 0, 1),
+    CONFIG_NUMBER(CONFIG_TYPE_BOOL, auto_rotate_forward, SETTABLE | PUBLIC, true, 0, 1),
+
+    // Motion control parameters
+    CONFIG_NUMBER(CONFIG_TYPE_UINT32, position_hysteresis, SETTABLE | PUBLIC, DEFAULT_POSITION_HYSTERESIS, 0, 10000),
+    CONFIG_NUMBER(CONFIG_TYPE_FLOAT, max_speed, SETTABLE | PUBLIC, DEFAULT_MAX_SPEED, 1, 100000),
+    CONFIG_NUMBER(CONFIG_TYPE_FLOAT, acceleration, SETTABLE | PUBLIC, DEFAULT_ACCELERATION, 1, 1000000),
+    CONFIG_NUMBER(CONFIG_TYPE_FLOAT, vel_loop_p, SETTABLE | PUBLIC, DEFAULT_VEL_LOOP_P, -1, 1),
+    CONFIG_NUMBER(CONFIG_TYPE_FLOAT, vel_loop_i, SETTABLE | PUBLIC, DEFAULT_VEL_LOOP_I, -1, 1),
+    CONFIG_NUMBER(CONFIG_TYPE_FLOAT, vel_loop_d, SETTABLE | PUBLIC, DEFAULT_VEL_LOOP_D, -1, 1),
+    CONFIG_NUMBER(CONFIG_TYPE_FLOAT, vel_filter_persistence, SETTABLE | PUBLIC, DEFAULT_VEL_FILTER_PERSISTENCE, 0, 1),
+    CONFIG_NUMBER(CONFIG_TYPE_FLOAT, spd_err_persistence, SETTABLE | PUBLIC, DEFAULT_SPD_ERR_PERSISTENCE, 0, 1),
+};
+
+extern const size_t configFieldCount = sizeof(configFields) / sizeof(configFields[0]);
+
+#define CONFIG_FIELD_COUNT (sizeof(configFields) / sizeof(configFields[0]))
+
+// Compile-time checks (C++11 constexpr, so recursion instead of loops)
+
+constexpr bool fieldSizeMatches(const ConfigField& field) {
+    return field.type == CONFIG_TYPE_STRING ? field.size > 1 :
+           field.type == CONFIG_TYPE_IPV4 ? field.size == 16 :
+           field.type == CONFIG_TYPE_MAC ? field.size == 6 :
+           field.type == CONFIG_TYPE_BOOL ? field.size == sizeof(bool) :
+           field.type == CONFIG_TYPE_UINT8 ? field.size == 1 :
+           field.size == 4;
+}
+
+constexpr bool fieldDefaultInBounds(const ConfigField& field) {
+    return field.type <= CONFIG_TYPE_MAC ||
+           (field.default_number >= field.min_value && field.default_number <= field.max_value);
+}
+
+// Fields must be listed in struct order with no gap a missing member could hide in
+// (alignment padding here is at most 3 bytes)
+constexpr bool fieldFollows(const ConfigField& previous, const ConfigField& field) {
+    return field.offset >= previous.offset + previous.size &&
+           field.offset - (previous.offset + previous.size) < 4;
+}
+
+constexpr bool fieldsValid(size_t i) {
+    return i == CONFIG_FIELD_COUNT ||
+           (fieldSizeMatches(configFields[i]) &&
+            fieldDefaultInBounds(configFields[i]) &&
+            (i == 0 ? configFields[i].offset == 0 : fieldFollows(configFields[i - 1], configFields[i])) &&
+            fieldsValid(i + 1));
+}
+
+static_assert(fieldsValid(0), "configFields must match RotatorConfig: size, default or order mismatch");
+static_assert(sizeof(RotatorConfig) - (configFields[CONFIG_FIELD_COUNT - 1].offset + configFields[CONFIG_FIELD_COUNT - 1].size) < 4,
+              "RotatorConfig has members missing from configFields");
+
+static void* fieldAddress(RotatorConfig& target, const ConfigField& field) {
+    return (uint8_t*)&target + field.offset;
+}
+
+static const void* fieldAddress(const RotatorConfig& source, const ConfigField& field) {
+    return (const uint8_t*)&source + field.offset;
+}
+
+/**
+ * Parse "a.b.c.d"; IPAddress is not available in the host benchmark
+ */
+static bool isDottedQuad(const char* text) {
+    unsigned int a, b, c, d;
+    char extra;
+    return sscanf(text, "%u.%u.%u.%u%c", &a, &b, &c, &d, &extra) == 4 &&
+           a <= 255 && b <= 255 && c <= 255 && d <= 255;
+}
+
+static bool parseMac(const char* text, uint8_t* mac) {
+    unsigned int bytes[6];
+    char extra;
+    if (sscanf(text, "%x:%x:%x:%x:%x:%x%c", &bytes[0], &bytes[1], &bytes[2],
+               &bytes[3], &bytes[4], &bytes[5], &extra) != 6) {
+        return false;
+    }
+    for (int i = 0; i < 6; i++) {
+        if (bytes[i] > 255) {
+            return false;
+        }
+        mac[i] = bytes[i];
+    }
+    return true;
+}
+
+/**
+ * Check a JSON value against a field and, when target is given, store it
+ * Returns false (leaving target unchanged) for a wrong type or an out-of-range value
+ */
+static bool storeField(const ConfigField& field, JsonVariantConst value, RotatorConfig* target) {
+    switch (field.type) {
+        case CONFIG_TYPE_STRING:
+        case CONFIG_TYPE_IPV4: {
+            const char* text = value.as<const char*>();
+            if (!text || strlen(text) >= field.size) {
+                return false;
+            }
+            if (field.type == CONFIG_TYPE_IPV4 && text[0] != '\0' && !isDottedQuad(text)) {
+                return false;
+            }
+            if (target) {
+                snprintf((char*)fieldAddress(*target, field), field.size, "%s", text);
+            }
+            return true;
+        }
+
+        case CONFIG_TYPE_MAC: {
+            const char* text = value.as<const char*>();
+            uint8_t mac[6];
+            if (!text || !parseMac(text, mac)) {
+                return false;
+            }
+            if (target) {
+                memcpy(fieldAddress(*target, field), mac, sizeof(mac));
+            }
+            return true;
+        }
+
+        case CONFIG_TYPE_BOOL:
+            if (!value.is<bool>()) {
+                return false;
+            }
+            if (target) {
+                *(bool*)fieldAddress(*target, field) = value.as<bool>();
+            }
+            return true;
+
+        case CONFIG_TYPE_FLOAT: {
+            if (!value.is<double>()) {
+                return false;
+            }
+            double number = value.as<double>();
+            if (!isfinite(number) || number < field.min_value || number > field.max_value) {
+                return false;
+            }
+            if (target) {
+                *(float*)fieldAddress(*target, field) = (float)number;
+            }
+            return true;
+        }
+
+        default: {
+            if (!value.is<int64_t>()) {
+                return false;
+            }
+            int64_t number = value.as<int64_t>();
+            if (number < field.min_value || number > field.max_value) {
+                return false;
+            }
+            if (target) {
+                void* address = fieldAddress(*target, field);
+                if (field.type == CONFIG_TYPE_UINT8) {
+                    *(uint8_t*)address = (uint8_t)number;
+                } else if (field.type == CONFIG_TYPE_INT32) {
+                    *(int32_t*)address = (int32_t)number;
+                } else {
+                    *(uint32_t*)address = (uint32_t)number;
+                }
+            }
+            return true;
+        }
+    }
+}
+
+/**
+ * Set one field to its default
+ */
+static void setFieldDefault(const ConfigField& field, RotatorConfig& target) {
+    void* address = fieldAddress(target, field);
+
+    switch (field.type) {
+        case CONFIG_TYPE_STRING:
+        case CONFIG_TYPE_IPV4:
+            snprintf((char*)address, field.size, "%s", field.default_string);
+            break;
+        case CONFIG_TYPE_MAC:
+            memset(address, 0, field.size);
+            break;
+        case CONFIG_TYPE_BOOL:
+            *(bool*)address = field.default_number != 0;
+            break;
+        case CONFIG_TYPE_UINT8:
+            *(uint8_t*)address = (uint8_t)field.default_number;
+            break;
+        case CONFIG_TYPE_INT32:
+            *(int32_t*)address = (int32_t)field.default_number;
+            break;
+        case CONFIG_TYPE_UINT32:
+            *(uint32_t*)address = (uint32_t)field.default_number;
+            break;
+        case CONFIG_TYPE_FLOAT:
+            *(float*)address = (float)field.default_number;
+            break;
+    }
+}
+
+/**
+ * Write one field's value into a JSON object under its name
+ */
+static void writeField(const ConfigField& field, JsonObject json, const RotatorConfig& source) {
+    const void* address = fieldAddress(source, field);
+
+    switch (field.type) {
+        case CONFIG_TYPE_STRING:
+        case CONFIG_TYPE_IPV4:
+            json[field.name] = (char*)address;          // Copied: the document may outlive a config snapshot
+            break;
+        case CONFIG_TYPE_MAC: {
+            const uint8_t* mac = (const uint8_t*)address;
+            char text[18];
+            snprintf(text, sizeof(text), "%02x:%02x:%02x:%02x:%02x:%02x", mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+            json[field.name] = text;
+            break;
+        }
+        case CONFIG_TYPE_BOOL:
+            json[field.name] = *(const bool*)address;
+            break;
+        case CONFIG_TYPE_UINT8:
+            json[field.name] = *(const uint8_t*)address;
+            break;
+        case CONFIG_TYPE_INT32:
+            json[field.name] = *(const int32_t*)address;
+            break;
+        case CONFIG_TYPE_UINT32:
+            json[field.name] = *(const uint32_t*)address;
+            break;
+        case CONFIG_TYPE_FLOAT:
+            json[field.name] = *(const float*)address;
+            break;
+    }
+}
+
+const ConfigField* findConfigField(const char* name) {
+    for (size_t i = 0; i < CONFIG_FIELD_COUNT; i++) {
+        if (strcmp(configFields[i].name, name) == 0) {
+            return &configFields[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Set every field to its default (mdns_name stays empty; the caller derives it from the MAC)
+ */
+void applyConfigDefaults(RotatorConfig& target) {
+    memset(&target, 0, sizeof(target));
+    for (size_t i = 0; i < CONFIG_FIELD_COUNT; i++) {
+        setFieldDefault(configFields[i], target);
+    }
+}
+
+/**
+ * Read every field present in a JSON document (the legacy /config.json)
+ * Missing or invalid values keep what target already holds
+ */
+void readConfigJson(JsonObjectConst json, RotatorConfig& target) {
+    for (size_t i = 0; i < CONFIG_FIELD_COUNT; i++) {
+        JsonVariantConst value = json[configFields[i].name];
+        if (!value.isNull()) {
+            storeField(configFields[i], value, &target);
+        }
+    }
+}
+
+/**
+ * Write the fields carrying all of the given flags (0 writes every field)
+ */
+void writeConfigJson(JsonObject json, const RotatorConfig& source, uint8_t flags) {
+    for (size_t i = 0; i < CONFIG_FIELD_COUNT; i++) {
+        if ((configFields[i].flags & flags) == flags) {
+            writeField(configFields[i], json, source);
+        }
+    }
+}
+
+/**
+ * Find the first settable key whose value has the wrong type or is out of range
+ * Returns NULL when every value can be applied; unknown and read-only keys are ignored
+ */
+const char* findInvalidSetting(JsonObjectConst json) {
+    for (size_t i = 0; i < CONFIG_FIELD_COUNT; i++) {
+        const ConfigField& field = configFields[i];
+        JsonVariantConst value = json[field.name];
+        if ((field.flags & CONFIG_FIELD_SETTABLE) && !value.isNull() && !storeField(field, value, NULL)) {
+            return field.name;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Apply the settings present in a JSON object to a configuration
+ * Keys that are absent, unknown, read-only or invalid are left unchanged
+ */
+void applySettingsJson(JsonObject json, RotatorConfig& target) {
+    JsonObjectConst values = json;
+    for (size_t i = 0; i < CONFIG_FIELD_COUNT; i++) {
+        const ConfigField& field = configFields[i];
+        JsonVariantConst value = values[field.name];
+        if ((field.flags & CONFIG_FIELD_SETTABLE) && !value.isNull()) {
+            storeField(field, value, &target);
+        }
+    }
+}
+
+/**
+ * Undo applySettingsJson(): copy back from saved only the fields named in json
+ */
+void restoreSettingsJson(JsonObject json, RotatorConfig& target, const RotatorConfig& saved) {
+    JsonObjectConst values = json;
+    for (size_t i = 0; i < CONFIG_FIELD_COUNT; i++) {
+        const ConfigField& field = configFields[i];
+        if ((field.flags & CONFIG_FIELD_SETTABLE) && !values[field.name].isNull()) {
+            memcpy(fieldAddress(target, field), fieldAddress(saved, field), field.size);
+        }
+    }
+}
+
+/**
+ * Write the public settings, in the format applySettingsJson() accepts
+ */
+void writeSettingsJson(JsonObject json, const RotatorConfig& source) {
+    writeConfigJson(json, source, CONFIG_FIELD_PUBLIC);
+}
+
+/**
+ * Repair a configuration loaded as a raw image: terminate strings and reset
+ * out-of-range numbers to their defaults. Returns the number of fields repaired
+ */
+int sanitizeConfig(RotatorConfig& target) {
+    int repaired = 0;
+
+    for (size_t i = 0; i < CONFIG_FIELD_COUNT; i++) {
+        const ConfigField& field = configFields[i];
+        void* address = fieldAddress(target, field);
+        bool valid = true;
+
+        switch (field.type) {
+            case CONFIG_TYPE_STRING:
+            case CONFIG_TYPE_IPV4:
+                valid = memchr(address, '\0', field.size) != NULL &&
+                        (field.type == CONFIG_TYPE_STRING || ((char*)address)[0] == '\0' || isDottedQuad((char*)address));
+                break;
+            case CONFIG_TYPE_MAC:
+                break;
+            case CONFIG_TYPE_BOOL:
+                valid = *(uint8_t*)address <= 1;
+                break;
+            case CONFIG_TYPE_UINT8:
+                valid = *(uint8_t*)address >= field.min_value && *(uint8_t*)address <= field.max_value;
+                break;
+            case CONFIG_TYPE_INT32:
+                valid = *(int32_t*)address >= field.min_value && *(int32_t*)address <= field.max_value;
+                break;
+            case CONFIG_TYPE_UINT32:
+                valid = *(uint32_t*)address >= field.min_value && *(uint32_t*)address <= field.max_value;
+                break;
+            case CONFIG_TYPE_FLOAT: {
+                float number = *(float*)address;
+                valid = isfinite(number) && number >= field.min_value && number <= field.max_value;
+                break;
+            }
+        }
+
+        if (!valid) {
+            setFieldDefault(field, target);
+            repaired++;
+        }
+    }
+    return repaired;
+}
@@ -0,0 +1,52 @@
+#ifndef CONFIG_SCHEMA_H
+#define CONFIG_SCHEMA_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <ArduinoJson.h>
+#include "config.h"
+
+// Value types a configuration field can hold
+enum ConfigFieldType : uint8_t {
+    CONFIG_TYPE_STRING,                 // char[], NUL-terminated
+    CONFIG_TYPE_IPV4,                   // char[16] holding a dotted quad or ""
+    CONFIG_TYPE_MAC,                    // uint8_t[6]; "aa:bb:cc:dd:ee:ff" in JSON
+    CONFIG_TYPE_BOOL,
+    CONFIG_TYPE_UINT8,
+    CONFIG_TYPE_INT32,
+    CONFIG_TYPE_UINT32,
+    CONFIG_TYPE_FLOAT
+};
+
+// Where a field is visible besides the stored record and the legacy JSON import
+enum ConfigFieldFlags : uint8_t {
+    CONFIG_FIELD_SETTABLE = 0x01,       // Accepted by /api/settings and batch settings ops
+    CONFIG_FIELD_PUBLIC = 0x02          // Reported by /api/config and /api/config/export
+};
+
+// One RotatorConfig member; the JSON key is the member name
+struct ConfigField {
+    const char* name;
+    ConfigFieldType type;
+    uint8_t flags;
+    uint16_t offset;
+    uint16_t size;
+    double min_value;                   // Inclusive bounds for numeric fields
+    double max_value;
+    double default_number;
+    const char* default_string;         // Strings and IPv4 fields
+};
+
+// Every RotatorConfig member, in struct order (checked at compile time in config_schema.cpp)
+extern const ConfigField configFields[];
+extern const size_t configFieldCount;
+
+// Function prototypes
+const ConfigField* findConfigField(const char* name);
+void applyConfigDefaults(RotatorConfig& target);
+void readConfigJson(JsonObjectConst json, RotatorConfig& target);
+void writeConfigJson(JsonObject json, const RotatorConfig& source, uint8_t flags);
+const char* findInvalidSetting(JsonObjectConst json);
+int sanitizeConfig(RotatorConfig& target);
+
+#endif // CONFIG_SCHEMA_H
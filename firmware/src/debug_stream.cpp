@@ -0,0 +1,367 @@
+#include "debug_stream.h"
+#include "event_bus.h"
+#include "api_response.h"
+#include "wifi_manager.h"
+#include "main.h"
+
+// Debug streaming WebSocket
+AsyncWebSocket debugWebSocket("/ws/debug");
+
+// True while at least one client is subscribed
+bool debugStreamActive = false;
+
+// Subscriptions, updated from WebSocket events (async_tcp) and the sender (dispatcher)
+static DebugSubscriber subscribers[DEBUG_STREAM_MAX_CLIENTS] = {};
+static portMUX_TYPE subscribersLock = portMUX_INITIALIZER_UNLOCKED;
+
+// Frames sent/dropped over all clients since boot (survive client disconnects)
+static uint32_t totalFramesSent = 0;
+static uint32_t totalFramesDropped = 0;
+
+static const char* const debugFieldNames[DEBUG_FIELD_COUNT] = {
+    "currentPosition",
+    "currentVelocity",
+    "targetPosition",
+    "motionActive",
+    "speedError",
+    "errorIntegral",
+    "errorDerivative",
+    "controlPWMOut",
+};
+
+/**
+ * Find a client's slot (call with subscribersLock held)
+ */
+static DebugSubscriber* findSubscriber(uint32_t client_id) {
+    for (int i = 0; i < DEBUG_STREAM_MAX_CLIENTS; i++) {
+        if (subscribers[i].client_id == client_id) {
+            return &subscribers[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Recompute debugStreamActive (call with subscribersLock held)
+ */
+static void updateStreamActive() {
+    bool active = false;
+    for (int i = 0; i < DEBUG_STREAM_MAX_CLIENTS; i++) {
+        if (subscribers[i].client_id && subscribers[i].active) {
+            active = true;
+        }
+    }
+    debugStreamActive = active;
+}
+
+/**
+ * Start (or update) a client's subscription
+ */
+static void subscribe(uint32_t client_id, int rate_hz, uint16_t field_mask) {
+    portENTER_CRITICAL(&subscribersLock);
+    DebugSubscriber* subscriber = findSubscriber(client_id);
+    if (subscriber) {
+        subscriber->active = true;
+        subscriber->rate_hz = constrain(rate_hz, 1, DEBUG_STREAM_MAX_RATE_HZ);
+        subscriber->field_mask = field_mask ? field_mask : DEBUG_FIELDS_ALL;
+        subscriber->decimation = 1;
+        subscriber->clear_frames = 0;
+        subscriber->last_sent_ms = 0;  // Send on the next tick
+    }
+    updateStreamActive();
+    portEXIT_CRITICAL(&subscribersLock);
+}
+
+static void unsubscribe(uint32_t client_id) {
+    portENTER_CRITICAL(&subscribersLock);
+    DebugSubscriber* subscriber = findSubscriber(client_id);
+    if (subscriber) {
+        subscriber->active = false;
+    }
+    updateStreamActive();
+    portEXIT_CRITICAL(&subscribersLock);
+}
+
+/**
+ * Parse a JSON subscribe command: {"cmd":"subscribe","rate":5,"fields":["currentPosition",...]}
+ */
+static void handleSubscribeCommand(AsyncWebSocketClient *client, const uint8_t* data, size_t len) {
+    StaticJsonDocument<384> doc;
+    if (deserializeJson(doc, data, len) || !doc["cmd"].is<const char*>()) {
+        client->text("{\"error\":\"Invalid command\"}");
+        return;
+    }
+
+    const char* cmd = doc["cmd"];
+    if (strcmp(cmd, "unsubscribe") == 0) {
+        unsubscribe(client->id());
+        return;
+    }
+    if (strcmp(cmd, "subscribe") != 0) {
+        client->text("{\"error\":\"Unknown command\"}");
+        return;
+    }
+
+    int rate = doc["rate"] | DEBUG_STREAM_MAX_RATE_HZ;
+    uint16_t mask = 0;
+    if (doc["fields"].is<JsonArray>()) {
+        for (const char* name : doc["fields"].as<JsonArray>()) {
+            for (int i = 0; name && i < DEBUG_FIELD_COUNT; i++) {
+                if (strcmp(name, debugFieldNames[i]) == 0) {
+                    mask |= 1u << i;
+                }
+            }
+        }
+    }
+
+    subscribe(client->id(), rate, mask);
+    log_i("Debug WebSocket client #%u subscribed at %d Hz (fields 0x%02x)", client->id(), rate, mask);
+}
+
+/**
+ * Handle WebSocket events for debug interface
+ */
+static void onDebugWebSocketEvent(AsyncWebSocket *server, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len) {
+    switch (type) {
+        case WS_EVT_CONNECT: {
+            log_i("Debug WebSocket client #%u connected from %s", client->id(), client->remoteIP().toString().c_str());
+
+            portENTER_CRITICAL(&subscribersLock);
+            DebugSubscriber* slot = findSubscriber(0);
+            if (slot) {
+                *slot = {};
+                slot->client_id = client->id();
+                slot->rate_hz = DEBUG_STREAM_MAX_RATE_HZ;
+                slot->decimation = 1;
+                slot->field_mask = DEBUG_FIELDS_ALL;
+            }
+            portEXIT_CRITICAL(&subscribersLock);
+            break;
+        }
+
+        case WS_EVT_DISCONNECT: {
+            log_i("Debug WebSocket client #%u disconnected", client->id());
+
+            portENTER_CRITICAL(&subscribersLock);
+            DebugSubscriber* slot = findSubscriber(client->id());
+            if (slot) {
+                *slot = {};
+            }
+            updateStreamActive();
+            portEXIT_CRITICAL(&subscribersLock);
+
+            if (!debugStreamActive) {
+                log_i("Debug streaming stopped - no clients subscribed");
+            }
+            break;
+        }
+
+        case WS_EVT_DATA: {
+            AwsFrameInfo *info = (AwsFrameInfo*)arg;
+            if (info->final && info->index == 0 && info->len == len && info->opcode == WS_TEXT) {
+                // Plain "start"/"stop" stream every field at the full rate
+                if (len == 5 && memcmp(data, "start", 5) == 0) {
+                    subscribe(client->id(), DEBUG_STREAM_MAX_RATE_HZ, DEBUG_FIELDS_ALL);
+                    log_i("Debug streaming started for client #%u", client->id());
+                } else if (len == 4 && memcmp(data, "stop", 4) == 0) {
+                    unsubscribe(client->id());
+                    log_i("Debug streaming stopped for client #%u", client->id());
+                } else {
+                    handleSubscribeCommand(client, data, len);
+                }
+            }
+            break;
+        }
+
+        case WS_EVT_PONG:
+        case WS_EVT_ERROR:
+            break;
+    }
+}
+
+/**
+ * Serialize one frame with the selected fields into a buffer shared by every client that receives it
+ */
+static AsyncWebSocketSharedBuffer buildDebugFrame(uint32_t timestamp, int64_t position, const MotionControlInfo& motionInfo, uint16_t mask) {
+    StaticJsonDocument<256> doc;
+    doc["timestamp"] = timestamp;
+    if (mask & (1u << DEBUG_FIELD_POSITION)) doc["currentPosition"] = position;
+    if (mask & (1u << DEBUG_FIELD_VELOCITY)) doc["currentVelocity"] = motionInfo.velocity;
+    if (mask & (1u << DEBUG_FIELD_TARGET)) doc["targetPosition"] = motionInfo.target_position;
+    if (mask & (1u << DEBUG_FIELD_MOTION_ACTIVE)) doc["motionActive"] = motionInfo.motion_active;
+    if (mask & (1u << DEBUG_FIELD_SPEED_ERROR)) doc["speedError"] = motionInfo.speed_error;
+    if (mask & (1u << DEBUG_FIELD_ERROR_INTEGRAL)) doc["errorIntegral"] = motionInfo.speed_error_integral;
+    if (mask & (1u << DEBUG_FIELD_ERROR_DERIVATIVE)) doc["errorDerivative"] = motionInfo.speed_error_derivative;
+    if (mask & (1u << DEBUG_FIELD_PWM_OUT)) doc["controlPWMOut"] = motionInfo.pwm_control_out;
+
+    size_t len = measureJson(doc);
+    AsyncWebSocketSharedBuffer buffer = std::make_shared<std::vector<uint8_t>>(len + 1);
+    serializeJson(doc, (char*)buffer->data(), len + 1);
+    buffer->resize(len);  // Drop the terminator
+    return buffer;
+}
+
+/**
+ * Send debug data to subscribed WebSocket clients
+ * Runs in the event dispatcher task on each EVENT_DEBUG_TICK (10Hz)
+ *
+ * Each distinct field selection is serialized once per tick and the buffer is shared.
+ * A client whose send queue is at the high-water mark skips the frame and its rate is
+ * halved (down to 1/DEBUG_STREAM_MAX_DECIMATION); it recovers once its queue stays empty.
+ */
+void sendDebugData() {
+    if (!debugStreamActive || debugWebSocket.count() == 0) {
+        return;
+    }
+
+    // Pick the clients due this tick
+    uint32_t now = millis();
+    uint32_t dueIds[DEBUG_STREAM_MAX_CLIENTS];
+    uint16_t dueMasks[DEBUG_STREAM_MAX_CLIENTS];
+    int dueCount = 0;
+
+    portENTER_CRITICAL(&subscribersLock);
+    for (int i = 0; i < DEBUG_STREAM_MAX_CLIENTS; i++) {
+        DebugSubscriber& subscriber = subscribers[i];
+        if (!subscriber.client_id || !subscriber.active) {
+            continue;
+        }
+        // Half a tick of slack so 10Hz is not aliased down to 5Hz by timer jitter
+        uint32_t interval = (1000 / subscriber.rate_hz) * subscriber.decimation;
+        if (subscriber.last_sent_ms == 0 || now - subscriber.last_sent_ms + DEBUG_SEND_INTERVAL_MS / 2 >= interval) {
+            dueIds[dueCount] = subscriber.client_id;
+            dueMasks[dueCount] = subscriber.field_mask;
+            dueCount++;
+        }
+    }
+    portEXIT_CRITICAL(&subscribersLock);
+
+    if (dueCount == 0) {
+        return;
+    }
+
+    MotionControlInfo motionInfo = get_motion_control_info();
+    int64_t position = get_current_position();
+
+    // Frames built this tick, one per distinct field mask
+    uint16_t frameMasks[DEBUG_STREAM_MAX_CLIENTS];
+    AsyncWebSocketSharedBuffer frames[DEBUG_STREAM_MAX_CLIENTS];
+    int frameCount = 0;
+
+    for (int i = 0; i < dueCount; i++) {
+        AsyncWebSocketClient *client = debugWebSocket.client(dueIds[i]);
+        if (!client || client->status() != WS_CONNECTED) {
+            continue;
+        }
+
+        size_t queued = client->queueLen();
+        bool congested = queued >= DEBUG_STREAM_QUEUE_HIGH_WATER || !client->canSend();
+
+        bool sent = false;
+        if (!congested) {
+            int frame = 0;
+            while (frame < frameCount && frameMasks[frame] != dueMasks[i]) {
+                frame++;
+            }
+            if (frame == frameCount) {
+                frameMasks[frameCount] = dueMasks[i];
+                frames[frameCount] = buildDebugFrame(now, position, motionInfo, dueMasks[i]);
+                frameCount++;
+            }
+            sent = client->text(frames[frame]);
+        }
+
+        portENTER_CRITICAL(&subscribersLock);
+        DebugSubscriber* subscriber = findSubscriber(dueIds[i]);
+        if (subscriber) {
+            if (queued > subscriber->max_queue) {
+                subscriber->max_queue = queued;
+            }
+            if (sent) {
+                subscriber->sent++;
+                totalFramesSent++;
+                subscriber->last_sent_ms = now;
+                if (queued == 0 && subscriber->decimation > 1 &&
+                    ++subscriber->clear_frames >= DEBUG_STREAM_RECOVER_FRAMES) {
+                    subscriber->decimation /= 2;
+                    subscriber->clear_frames = 0;
+                }
+            } else {
+                subscriber->dropped++;
+                totalFramesDropped++;
+                subscriber->last_sent_ms = now;  // Wait a full (slower) interval before retrying
+                subscriber->clear_frames = 0;
+                if (subscriber->decimation < DEBUG_STREAM_MAX_DECIMATION) {
+                    subscriber->decimation *= 2;
+                }
+            }
+        }
+        portEXIT_CRITICAL(&subscribersLock);
+    }
+}
+
+/**
+ * Frames sent and dropped over all clients since boot
+ */
+void getDebugStreamTotals(uint32_t& sent, uint32_t& dropped) {
+    portENTER_CRITICAL(&subscribersLock);
+    sent = totalFramesSent;
+    dropped = totalFramesDropped;
+    portEXIT_CRITICAL(&subscribersLock);
+}
+
+/**
+ * Write per-client subscription and backpressure counters
+ */
+void writeDebugStreamStatsJson(JsonArray clients) {
+    DebugSubscriber snapshot[DEBUG_STREAM_MAX_CLIENTS];
+    portENTER_CRITICAL(&subscribersLock);
+    memcpy(snapshot, subscribers, sizeof(snapshot));
+    portEXIT_CRITICAL(&subscribersLock);
+
+    for (int i = 0; i < DEBUG_STREAM_MAX_CLIENTS; i++) {
+        const DebugSubscriber& subscriber = snapshot[i];
+        if (!subscriber.client_id) {
+            continue;
+        }
+
+        JsonObject obj = clients.createNestedObject();
+        obj["id"] = subscriber.client_id;
+        obj["active"] = subscriber.active;
+        obj["rateHz"] = subscriber.rate_hz;
+        obj["effectiveRateHz"] = (float)subscriber.rate_hz / subscriber.decimation;
+        JsonArray fields = obj.createNestedArray("fields");
+        for (int field = 0; field < DEBUG_FIELD_COUNT; field++) {
+            if (subscriber.field_mask & (1u << field)) {
+                fields.add(debugFieldNames[field]);
+            }
+        }
+        obj["sent"] = subscriber.sent;
+        obj["dropped"] = subscriber.dropped;
+        obj["maxQueue"] = subscriber.max_queue;
+    }
+}
+
+/**
+ * Setup the debug WebSocket, its tick handler and the stats endpoint
+ * Must be called before webServer.begin()
+ */
+void setupDebugStream() {
+    debugWebSocket.onEvent(onDebugWebSocketEvent);
+    webServer.addHandler(&debugWebSocket);
+
+    // Debug frames are built in the dispatcher task, never in the esp_timer task
+    registerEventHandler(EVENT_DEBUG_TICK, [](const Event& event) {
+        sendDebugData();
+    });
+
+    // Per-client rates, drop counters and queue high-water marks
+    webServer.on("/api/debug/clients", HTTP_GET, [](AsyncWebServerRequest *request) {
+        JsonResponseSlot *slot = beginJsonResponse(request);
+        if (!slot) return;
+        writeDebugStreamStatsJson(slot->doc.createNestedArray("clients"));
+        sendJsonSlot(request, slot);
+    });
+
+    log_i("Debug WebSocket handler setup complete");
+}
@@ -0,0 +1,54 @@
+#ifndef DEBUG_STREAM_H
+#define DEBUG_STREAM_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <ESPAsyncWebServer.h>
+
+// Debug stream configuration
+#define DEBUG_STREAM_MAX_CLIENTS 8          // Matches the AsyncWebSocket client limit
+#define DEBUG_STREAM_MAX_RATE_HZ 10         // One frame per debug tick (DEBUG_SEND_INTERVAL_MS)
+#define DEBUG_STREAM_QUEUE_HIGH_WATER 4     // Skip a client whose send queue holds this many frames
+#define DEBUG_STREAM_MAX_DECIMATION 16      // Slowest adaptive rate is requested rate / 16
+#define DEBUG_STREAM_RECOVER_FRAMES 10      // Clear-queue frames before halving the decimation
+
+// Fields a subscriber can select; timestamp is always sent
+enum DebugField : uint8_t {
+    DEBUG_FIELD_POSITION,
+    DEBUG_FIELD_VELOCITY,
+    DEBUG_FIELD_TARGET,
+    DEBUG_FIELD_MOTION_ACTIVE,
+    DEBUG_FIELD_SPEED_ERROR,
+    DEBUG_FIELD_ERROR_INTEGRAL,
+    DEBUG_FIELD_ERROR_DERIVATIVE,
+    DEBUG_FIELD_PWM_OUT,
+    DEBUG_FIELD_COUNT
+};
+
+#define DEBUG_FIELDS_ALL ((uint16_t)((1u << DEBUG_FIELD_COUNT) - 1))
+
+// Per-client subscription and backpressure state
+struct DebugSubscriber {
+    uint32_t client_id;           // 0 marks a free slot
+    bool active;                  // Streaming requested ("start" or "subscribe")
+    uint8_t rate_hz;              // Requested rate
+    uint8_t decimation;           // Adaptive divider applied under backpressure
+    uint8_t clear_frames;         // Consecutive sends that found the queue empty
+    uint16_t field_mask;          // Bit per DebugField
+    uint16_t max_queue;           // Send queue high-water mark
+    uint32_t last_sent_ms;
+    uint32_t sent;
+    uint32_t dropped;
+};
+
+// Function prototypes
+void setupDebugStream();
+void sendDebugData();
+void writeDebugStreamStatsJson(JsonArray clients);
+void getDebugStreamTotals(uint32_t& sent, uint32_t& dropped);
+
+// External declarations
+extern AsyncWebSocket debugWebSocket;
+extern bool debugStreamActive;
+
+#endif // DEBUG_STREAM_H
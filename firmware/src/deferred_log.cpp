@@ -0,0 +1,369 @@
+#include "deferred_log.h"
+#include "lockfree_queue.h"
+#include "api_response.h"
+#include "wifi_manager.h"
+#include <ESPAsyncWebServer.h>
+
+// Remote log viewer: every formatted line is sent as one text frame
+AsyncWebSocket logWebSocket("/ws/log");
+
+volatile uint8_t logModuleLevels[LOG_MODULE_COUNT];
+
+// Records captured by callers, drained by the formatter task
+static LockFreeQueue<LogRecord, DLOG_QUEUE_DEPTH> logQueue;
+
+// Clients that connected since the last drain and still need the history
+static LockFreeQueue<uint32_t, 8> replayQueue;
+
+static std::atomic<uint32_t> formattedCount(0);
+static std::atomic<uint32_t> droppedCount(0);
+static std::atomic<uint32_t> filteredCount(0);
+
+static volatile bool serialOutput = true;
+static TaskHandle_t formatterTask = NULL;
+
+// Last records formatted, replayed to new viewers (owned by the formatter task)
+static LogRecord history[DLOG_HISTORY_RECORDS];
+static uint8_t historyNext = 0;
+static uint8_t historyCount = 0;
+
+static const char* const moduleNames[LOG_MODULE_COUNT] = {
+    "motion", "api", "wifi", "network", "ota", "system"
+};
+
+static const char* const levelNames[] = {
+    "none", "error", "warn", "info", "debug", "verbose"
+};
+
+/**
+ * Queue a captured record; returns false (and counts a drop) if the ring is full
+ */
+bool enqueueLogRecord(const LogRecord& record) {
+    if (!logQueue.push(record)) {
+        droppedCount.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+void countFilteredLogRecord() {
+    filteredCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+const char* logModuleName(LogModule module) {
+    return module < LOG_MODULE_COUNT ? moduleNames[module] : "?";
+}
+
+bool setLogModuleLevel(LogModule module, esp_log_level_t level) {
+    if (module >= LOG_MODULE_COUNT || level > ESP_LOG_VERBOSE) {
+        return false;
+    }
+    logModuleLevels[module] = level;
+    return true;
+}
+
+void getDeferredLogStats(DeferredLogStats& stats) {
+    stats.queued = logQueue.size();
+    stats.formatted = formattedCount.load(std::memory_order_relaxed);
+    stats.dropped = droppedCount.load(std::memory_order_relaxed);
+    stats.filtered = filteredCount.load(std::memory_order_relaxed);
+}
+
+template <typename T>
+static void appendConversion(char* line, size_t size, size_t& length, const char* spec, T value) {
+    int written = snprintf(line + length, size - length, spec, value);
+    if (written > 0) {
+        length += min((size_t)written, size - 1 - length);
+    }
+}
+
+/**
+ * Expand a record the way printf would have at the call site
+ * Each conversion is handed to snprintf on its own, with the argument converted back to the
+ * type the conversion expects (%d/%u/%x are 32-bit unless written %lld/%llu/%llx)
+ */
+static size_t formatRecord(const LogRecord& record, char* line, size_t size) {
+    static const char levelLetters[] = "-EWIDV";
+    size_t length = 0;
+    appendConversion(line, size, length, "[%6u]", record.timestamp_ms);
+    appendConversion(line, size, length, "[%c]", levelLetters[record.level <= ESP_LOG_VERBOSE ? record.level : 0]);
+    appendConversion(line, size, length, "[%s] ", logModuleName((LogModule)record.module));
+
+    const char* p = record.format;
+    uint8_t argIndex = 0;
+
+    while (*p && length < size - 1) {
+        if (*p != '%') {
+            line[length++] = *p++;
+            continue;
+        }
+        if (p[1] == '%') {
+            line[length++] = '%';
+            p += 2;
+            continue;
+        }
+
+        // Flags, width and precision are kept; length modifiers are replaced below
+        const char* start = p++;
+        while (*p && strchr("-+ #0123456789.", *p)) {
+            p++;
+        }
+        size_t prefixLength = min((size_t)(p - start), (size_t)10);
+        int longCount = 0;
+        while (*p && strchr("hljztL", *p)) {
+            if (*p == 'l') {
+                longCount++;
+            } else if (*p == 'j') {
+                longCount += 2;         // intmax_t is 64-bit
+            }
+            p++;
+        }
+        char conversion = *p;
+        if (!conversion) {
+            break;
+        }
+        p++;
+
+        if (argIndex >= record.arg_count) {
+            appendConversion(line, size, length, "%s", "<?>");
+            continue;
+        }
+        uint64_t raw = record.args[argIndex++];
+        bool wide = longCount >= 2;
+
+        char spec[16];
+        memcpy(spec, start, prefixLength);
+        size_t specLength = prefixLength;
+        if (wide && strchr("diouxX", conversion)) {
+            spec[specLength++] = 'l';
+            spec[specLength++] = 'l';
+        }
+        spec[specLength++] = conversion;
+        spec[specLength] = '\0';
+
+        switch (conversion) {
+            case 'd':
+            case 'i':
+                if (wide) {
+                    appendConversion(line, size, length, spec, (long long)raw);
+                } else {
+                    appendConversion(line, size, length, spec, (int)(int32_t)raw);
+                }
+                break;
+            case 'o':
+            case 'u':
+            case 'x':
+            case 'X':
+                if (wide) {
+                    appendConversion(line, size, length, spec, (unsigned long long)raw);
+                } else {
+                    appendConversion(line, size, length, spec, (unsigned)(uint32_t)raw);
+                }
+                break;
+            case 'c':
+                appendConversion(line, size, length, spec, (int)raw);
+                break;
+            case 'e':
+            case 'E':
+            case 'f':
+            case 'F':
+            case 'g':
+            case 'G':
+            case 'a':
+            case 'A': {
+                double value;
+                memcpy(&value, &raw, sizeof(value));
+                appendConversion(line, size, length, spec, value);
+                break;
+            }
+            case 's':
+                appendConversion(line, size, length, spec, raw < DLOG_TEXT_SIZE ? record.text + raw : "");
+                break;
+            case 'p':
+                appendConversion(line, size, length, spec, (void*)(uintptr_t)raw);
+                break;
+            default:
+                appendConversion(line, size, length, "%s", "<?>");
+                break;
+        }
+    }
+
+    line[length] = '\0';
+    return length;
+}
+
+/**
+ * Write a formatted line to the serial console and the log viewers
+ */
+static void emitLine(const char* line, size_t length) {
+    if (serialOutput) {
+        log_printf("%s\n", line);
+    }
+    // Viewers that cannot keep up miss lines rather than stalling the formatter
+    if (logWebSocket.count() > 0 && logWebSocket.availableForWriteAll()) {
+        logWebSocket.textAll(line, length);
+    }
+}
+
+static void replayHistory(uint32_t clientId) {
+    AsyncWebSocketClient* client = logWebSocket.client(clientId);
+    if (!client) {
+        return;
+    }
+
+    char line[DLOG_LINE_SIZE];
+    uint8_t first = (historyNext + DLOG_HISTORY_RECORDS - historyCount) % DLOG_HISTORY_RECORDS;
+    for (uint8_t i = 0; i < historyCount; i++) {
+        size_t length = formatRecord(history[(first + i) % DLOG_HISTORY_RECORDS], line, sizeof(line));
+        client->text(line, length);
+    }
+}
+
+/**
+ * Formatter task: drains the ring at low priority, so callers never wait for printf or the UART
+ */
+static void logFormatterTask(void* param) {
+    LogRecord record;
+    char line[DLOG_LINE_SIZE];
+    uint32_t reportedDropped = 0;
+
+    for (;;) {
+        uint32_t clientId;
+        while (replayQueue.pop(clientId)) {
+            replayHistory(clientId);
+        }
+
+        while (logQueue.pop(record)) {
+            size_t length = formatRecord(record, line, sizeof(line));
+            emitLine(line, length);
+
+            history[historyNext] = record;
+            historyNext = (historyNext + 1) % DLOG_HISTORY_RECORDS;
+            if (historyCount < DLOG_HISTORY_RECORDS) {
+                historyCount++;
+            }
+            formattedCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        uint32_t dropped = droppedCount.load(std::memory_order_relaxed);
+        if (dropped != reportedDropped) {
+            int length = snprintf(line, sizeof(line), "[%6u][W][log] %u records dropped (ring full)",
+                                  millis(), dropped - reportedDropped);
+            emitLine(line, length);
+            reportedDropped = dropped;
+        }
+
+        vTaskDelay(pdMS_TO_TICKS(DLOG_DRAIN_INTERVAL_MS));
+    }
+}
+
+/**
+ * Set the default levels and start the formatter task
+ * Records logged before this are kept in the ring and printed once the task runs
+ */
+void setupDeferredLog() {
+    for (int i = 0; i < LOG_MODULE_COUNT; i++) {
+        logModuleLevels[i] = DLOG_DEFAULT_LEVEL;
+    }
+
+    xTaskCreatePinnedToCore(logFormatterTask, "log_format", DLOG_FORMATTER_STACK_SIZE,
+                            NULL, DLOG_FORMATTER_PRIORITY, &formatterTask, DLOG_FORMATTER_CORE);
+
+    log_i("Deferred log started (ring %d records, priority %d)", DLOG_QUEUE_DEPTH, DLOG_FORMATTER_PRIORITY);
+}
+
+static void onLogWebSocketEvent(AsyncWebSocket *server, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len) {
+    switch (type) {
+        case WS_EVT_CONNECT:
+            log_i("Log WebSocket client #%u connected from %s", client->id(), client->remoteIP().toString().c_str());
+            replayQueue.push(client->id());
+            break;
+
+        case WS_EVT_DISCONNECT:
+            log_i("Log WebSocket client #%u disconnected", client->id());
+            break;
+
+        case WS_EVT_DATA:
+        case WS_EVT_PONG:
+        case WS_EVT_ERROR:
+            break;
+    }
+}
+
+static void writeLogStateJson(JsonDocument& doc) {
+    JsonObject levels = doc.createNestedObject("levels");
+    for (int i = 0; i < LOG_MODULE_COUNT; i++) {
+        levels[moduleNames[i]] = levelNames[logModuleLevels[i]];
+    }
+    doc["serial"] = serialOutput;
+
+    DeferredLogStats stats;
+    getDeferredLogStats(stats);
+    doc["queued"] = stats.queued;
+    doc["formatted"] = stats.formatted;
+    doc["dropped"] = stats.dropped;
+    doc["filtered"] = stats.filtered;
+    doc["viewers"] = logWebSocket.count();
+}
+
+static int findName(const char* const* names, int count, const char* name) {
+    for (int i = 0; i < count; i++) {
+        if (strcmp(names[i], name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * Register /ws/log and the level API; called from setupWebServer()
+ */
+void setupLogStream() {
+    logWebSocket.onEvent(onLogWebSocketEvent);
+    webServer.addHandler(&logWebSocket);
+
+    // Current levels and formatter counters
+    webServer.on("/api/log", HTTP_GET, [](AsyncWebServerRequest *request) {
+        JsonResponseSlot *slot = beginJsonResponse(request);
+        if (!slot) return;
+        writeLogStateJson(slot->doc);
+        sendJsonSlot(request, slot);
+    });
+
+    // Change a module's level (module=all for every module) and/or the serial echo
+    webServer.on("/api/log", HTTP_POST, [](AsyncWebServerRequest *request) {
+        const char* levelName = getParamValue(request, "level");
+        if (levelName) {
+            const char* moduleName = getParamValue(request, "module");
+            int level = findName(levelNames, sizeof(levelNames) / sizeof(levelNames[0]), levelName);
+            if (level < 0) {
+                sendText(request, 400, "Level must be none, error, warn, info, debug or verbose");
+                return;
+            }
+            if (!moduleName || strcmp(moduleName, "all") == 0) {
+                for (int i = 0; i < LOG_MODULE_COUNT; i++) {
+                    setLogModuleLevel((LogModule)i, (esp_log_level_t)level);
+                }
+            } else {
+                int module = findName(moduleNames, LOG_MODULE_COUNT, moduleName);
+                if (module < 0) {
+                    sendText(request, 400, "Unknown log module");
+                    return;
+                }
+                setLogModuleLevel((LogModule)module, (esp_log_level_t)level);
+            }
+        }
+
+        int32_t serial;
+        if (getParamInt32(request, "serial", serial)) {
+            serialOutput = (serial != 0);
+        }
+
+        JsonResponseSlot *slot = beginJsonResponse(request);
+        if (!slot) return;
+        writeLogStateJson(slot->doc);
+        sendJsonSlot(request, slot);
+    });
+
+    log_i("Log stream setup complete");
+}
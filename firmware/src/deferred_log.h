@@ -0,0 +1,143 @@
+#ifndef DEFERRED_LOG_H
+#define DEFERRED_LOG_H
+
+#include <Arduino.h>
+#include <esp_log.h>
+#include <type_traits>
+
+// Deferred logging configuration
+#define DLOG_QUEUE_DEPTH 64                 // Records; must be a power of two
+#define DLOG_MAX_ARGS 4
+#define DLOG_TEXT_SIZE 32                   // Bytes for copied string arguments per record (truncated beyond)
+#define DLOG_LINE_SIZE 192                  // Longest formatted line
+#define DLOG_HISTORY_RECORDS 16             // Recent records replayed to a new /ws/log client
+#define DLOG_FORMATTER_PRIORITY 1           // Just above idle, below everything that logs
+#define DLOG_FORMATTER_STACK_SIZE 4096
+#define DLOG_FORMATTER_CORE 0
+#define DLOG_DRAIN_INTERVAL_MS 20
+#define DLOG_DEFAULT_LEVEL ESP_LOG_INFO
+
+// Modules with their own runtime level
+enum LogModule : uint8_t {
+    LOG_MODULE_MOTION,         // Control loop, move_to_position, rotator
+    LOG_MODULE_API,            // HTTP handlers
+    LOG_MODULE_WIFI,
+    LOG_MODULE_NETWORK,        // Fleet and UDP control
+    LOG_MODULE_OTA,
+    LOG_MODULE_SYSTEM,
+    LOG_MODULE_COUNT
+};
+
+// One log call as captured by the caller: no formatting happens until the formatter task
+struct LogRecord {
+    const char* format;                 // String literal; its address doubles as the message id
+    uint32_t timestamp_ms;
+    uint8_t module;                     // LogModule
+    uint8_t level;                      // esp_log_level_t
+    uint8_t arg_count;
+    uint8_t text_used;
+    uint64_t args[DLOG_MAX_ARGS];       // Integers widened, doubles bit-copied, strings as an offset into text
+    char text[DLOG_TEXT_SIZE];
+};
+
+// Formatter statistics
+struct DeferredLogStats {
+    uint32_t queued;
+    uint32_t formatted;
+    uint32_t dropped;                   // Records lost because the queue was full
+    uint32_t filtered;                  // Calls skipped by the module level
+};
+
+// Per-module level, read inline by the dlog_* macros
+extern volatile uint8_t logModuleLevels[LOG_MODULE_COUNT];
+
+// Function prototypes
+void setupDeferredLog();
+void setupLogStream();
+bool enqueueLogRecord(const LogRecord& record);
+void countFilteredLogRecord();
+bool setLogModuleLevel(LogModule module, esp_log_level_t level);
+const char* logModuleName(LogModule module);
+void getDeferredLogStats(DeferredLogStats& stats);
+
+namespace dlog_detail {
+
+inline void pack(LogRecord& record, const char* text) {
+    // Copy the string now: the caller's buffer may be gone by the time it is formatted
+    uint8_t offset = record.text_used;
+    if (offset < DLOG_TEXT_SIZE - 1) {
+        strlcpy(record.text + offset, text ? text : "(null)", DLOG_TEXT_SIZE - offset);
+        record.text_used += strlen(record.text + offset) + 1;
+    } else {
+        offset = DLOG_TEXT_SIZE;        // No room left; formats as an empty string
+    }
+    record.args[record.arg_count++] = offset;
+}
+
+inline void pack(LogRecord& record, const String& text) {
+    pack(record, text.c_str());
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value>::type
+pack(LogRecord& record, T value) {
+    record.args[record.arg_count++] = (uint64_t)(int64_t)value;
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_floating_point<T>::value>::type
+pack(LogRecord& record, T value) {
+    double promoted = value;
+    memcpy(&record.args[record.arg_count++], &promoted, sizeof(promoted));
+}
+
+template <typename T>
+inline typename std::enable_if<!std::is_same<typename std::remove_cv<T>::type, char>::value>::type
+pack(LogRecord& record, T* pointer) {
+    record.args[record.arg_count++] = (uintptr_t)pointer;
+}
+
+inline void packArgs(LogRecord& record) {}
+
+template <typename T, typename... Rest>
+inline void packArgs(LogRecord& record, const T& first, const Rest&... rest) {
+    pack(record, first);
+    packArgs(record, rest...);
+}
+
+} // namespace dlog_detail
+
+/**
+ * Capture a log call into the ring; formatting and output happen later in the formatter task
+ * Never blocks: if the ring is full the record is counted as dropped
+ */
+template <typename... Args>
+void logDeferred(LogModule module, esp_log_level_t level, const char* format, const Args&... args) {
+    static_assert(sizeof...(Args) <= DLOG_MAX_ARGS, "Too many arguments for a deferred log record");
+
+    LogRecord record;
+    record.format = format;
+    record.timestamp_ms = millis();
+    record.module = module;
+    record.level = level;
+    record.arg_count = 0;
+    record.text_used = 0;
+    dlog_detail::packArgs(record, args...);
+    enqueueLogRecord(record);
+}
+
+#define DLOG(module, level, format, ...) do { \
+        if ((level) <= logModuleLevels[module]) { \
+            logDeferred(module, level, format, ##__VA_ARGS__); \
+        } else { \
+            countFilteredLogRecord(); \
+        } \
+    } while (0)
+
+#define dlog_e(module, format, ...) DLOG(module, ESP_LOG_ERROR, format, ##__VA_ARGS__)
+#define dlog_w(module, format, ...) DLOG(module, ESP_LOG_WARN, format, ##__VA_ARGS__)
+#define dlog_i(module, format, ...) DLOG(module, ESP_LOG_INFO, format, ##__VA_ARGS__)
+#define dlog_d(module, format, ...) DLOG(module, ESP_LOG_DEBUG, format, ##__VA_ARGS__)
+#define dlog_v(module, format, ...) DLOG(module, ESP_LOG_VERBOSE, format, ##__VA_ARGS__)
+
+#endif // DEFERRED_LOG_H
@@ -0,0 +1,176 @@
+#include "event_bus.h"
+#include "lockfree_queue.h"
+#include <esp_timer.h>
+
+// Event queue shared by all producers; drained only by the dispatcher task
+static LockFreeQueue<Event, EVENT_QUEUE_DEPTH> eventQueue;
+static EventHandler eventHandlers[EVENT_TYPE_COUNT][EVENT_MAX_HANDLERS_PER_TYPE] = {};
+static TaskHandle_t dispatcherTask = NULL;
+static portMUX_TYPE handlerLock = portMUX_INITIALIZER_UNLOCKED;
+
+// Producer-side counters (may be touched from several tasks)
+static std::atomic<uint32_t> postedCount[EVENT_TYPE_COUNT];
+static std::atomic<uint32_t> droppedCount[EVENT_TYPE_COUNT];
+static std::atomic<uint32_t> maxQueueDepth(0);
+
+// Dispatcher-side counters, guarded by statsLock for consistent snapshots
+static portMUX_TYPE statsLock = portMUX_INITIALIZER_UNLOCKED;
+static EventTypeStats dispatchStats[EVENT_TYPE_COUNT] = {};
+
+static const char* const eventTypeNames[EVENT_TYPE_COUNT] = {
+    "debug_tick",
+    "auto_rotation_tick",
+    "status_tick",
+    "move_started",
+    "move_completed",
+    "config_changed",
+    "ota_progress",
+    "wifi_job_signal",
+    "wifi_job_updated",
+    "fleet_move",
+    "wifi_state_changed",
+};
+
+/**
+ * Dispatcher task: sleeps until notified, then drains the queue and runs handlers
+ */
+static void eventDispatcherTask(void* arg) {
+    Event event;
+
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        while (eventQueue.pop(event)) {
+            int64_t start_us = esp_timer_get_time();
+
+            for (int i = 0; i < EVENT_MAX_HANDLERS_PER_TYPE; i++) {
+                EventHandler handler = eventHandlers[event.type][i];
+                if (!handler) {
+                    break;
+                }
+                handler(event);
+            }
+
+            int64_t end_us = esp_timer_get_time();
+            uint32_t latency_us = (uint32_t)(start_us - event.posted_us);
+            uint32_t handler_us = (uint32_t)(end_us - start_us);
+
+            portENTER_CRITICAL(&statsLock);
+            EventTypeStats& stats = dispatchStats[event.type];
+            stats.dispatched++;
+            stats.total_latency_us += latency_us;
+            stats.total_handler_us += handler_us;
+            if (latency_us > stats.max_latency_us) {
+                stats.max_latency_us = latency_us;
+            }
+            if (handler_us > stats.max_handler_us) {
+                stats.max_handler_us = handler_us;
+            }
+            portEXIT_CRITICAL(&statsLock);
+        }
+    }
+}
+
+/**
+ * Start the event dispatcher task
+ * Must be called before any timer that posts events is started
+ */
+void setupEventBus() {
+    for (int i = 0; i < EVENT_TYPE_COUNT; i++) {
+        postedCount[i].store(0, std::memory_order_relaxed);
+        droppedCount[i].store(0, std::memory_order_relaxed);
+    }
+
+    xTaskCreatePinnedToCore(eventDispatcherTask, "event_dispatch", EVENT_DISPATCHER_STACK_SIZE,
+                            NULL, EVENT_DISPATCHER_PRIORITY, &dispatcherTask, EVENT_DISPATCHER_CORE);
+
+    log_i("Event dispatcher started (queue depth %d, priority %d)",
+          EVENT_QUEUE_DEPTH, EVENT_DISPATCHER_PRIORITY);
+}
+
+/**
+ * Register a handler for an event type (up to EVENT_MAX_HANDLERS_PER_TYPE per type)
+ * Handlers run in the dispatcher task, in registration order, and may block, log and do I/O
+ * Register during startup only (setup() and the network startup task register concurrently)
+ */
+bool registerEventHandler(EventType type, EventHandler handler) {
+    if (type >= EVENT_TYPE_COUNT || !handler) {
+        return false;
+    }
+
+    portENTER_CRITICAL(&handlerLock);
+    for (int i = 0; i < EVENT_MAX_HANDLERS_PER_TYPE; i++) {
+        if (!eventHandlers[type][i]) {
+            eventHandlers[type][i] = handler;
+            portEXIT_CRITICAL(&handlerLock);
+            return true;
+        }
+    }
+    portEXIT_CRITICAL(&handlerLock);
+
+    log_e("No free handler slot for event %s", eventTypeName(type));
+    return false;
+}
+
+/**
+ * Post an event to the dispatcher
+ * Never blocks; safe to call from esp_timer callbacks and other tasks (not from ISRs)
+ */
+bool postEvent(EventType type, uint32_t arg) {
+    if (type >= EVENT_TYPE_COUNT) {
+        return false;
+    }
+
+    Event event;
+    event.type = type;
+    event.arg = arg;
+    event.posted_us = esp_timer_get_time();
+
+    if (!eventQueue.push(event)) {
+        droppedCount[type].fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    postedCount[type].fetch_add(1, std::memory_order_relaxed);
+
+    // Track the queue high-water mark
+    uint32_t depth = eventQueue.size();
+    uint32_t previous = maxQueueDepth.load(std::memory_order_relaxed);
+    while (depth > previous &&
+           !maxQueueDepth.compare_exchange_weak(previous, depth, std::memory_order_relaxed)) {
+    }
+
+    if (dispatcherTask) {
+        xTaskNotifyGive(dispatcherTask);
+    }
+    return true;
+}
+
+/**
+ * Snapshot queue depth and per-type dispatch statistics
+ */
+void getEventBusStats(EventBusStats& stats) {
+    stats.queue_depth = eventQueue.size();
+    stats.max_queue_depth = maxQueueDepth.load(std::memory_order_relaxed);
+    stats.queue_capacity = eventQueue.capacity();
+
+    portENTER_CRITICAL(&statsLock);
+    for (int i = 0; i < EVENT_TYPE_COUNT; i++) {
+        stats.types[i] = dispatchStats[i];
+    }
+    portEXIT_CRITICAL(&statsLock);
+
+    for (int i = 0; i < EVENT_TYPE_COUNT; i++) {
+        stats.types[i].posted = postedCount[i].load(std::memory_order_relaxed);
+        stats.types[i].dropped = droppedCount[i].load(std::memory_order_relaxed);
+    }
+}
+
+/**
+ * Get a printable name for an event type
+ */
+const char* eventTypeName(EventType type) {
+    if (type >= EVENT_TYPE_COUNT) {
+        return "unknown";
+    }
+    return eventTypeNames[type];
+}
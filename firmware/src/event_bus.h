@@ -0,0 +1,64 @@
+#ifndef EVENT_BUS_H
+#define EVENT_BUS_H
+
+#include <Arduino.h>
+
+// Event dispatcher configuration
+#define EVENT_QUEUE_DEPTH 32               // Must be a power of two
+#define EVENT_DISPATCHER_PRIORITY 5        // Below async_tcp (10), far below esp_timer (22)
+#define EVENT_DISPATCHER_STACK_SIZE 6144
+#define EVENT_DISPATCHER_CORE 1
+#define EVENT_MAX_HANDLERS_PER_TYPE 4
+
+// Event types posted by timers and other time-critical contexts
+enum EventType : uint8_t {
+    EVENT_DEBUG_TICK,          // Debug WebSocket streaming period elapsed
+    EVENT_AUTO_ROTATION_TICK,  // Auto-rotation check period elapsed
+    EVENT_STATUS_TICK,         // Status push channel sampling period elapsed
+    EVENT_MOVE_STARTED,        // move_to_position() accepted a new target
+    EVENT_MOVE_COMPLETED,      // Motion ended; arg is a MoveResult
+    EVENT_CONFIG_CHANGED,      // Configuration was saved
+    EVENT_OTA_PROGRESS,        // OTA state change or progress step; arg is an OtaState
+    EVENT_WIFI_JOB_SIGNAL,     // Input to the WiFi job state machine; arg is a WiFiJobSignal | reason << 8
+    EVENT_WIFI_JOB_UPDATED,    // A WiFi job changed state; arg is the job id
+    EVENT_FLEET_MOVE,          // A scheduled fleet move is due; arg is the angle
+    EVENT_WIFI_STATE_CHANGED,  // currentWiFiState changed; arg is the new WiFiState
+    EVENT_TYPE_COUNT
+};
+
+// Small, copyable event record
+struct Event {
+    EventType type;
+    uint32_t arg;
+    int64_t posted_us;         // esp_timer time at which the event was posted
+};
+
+typedef void (*EventHandler)(const Event& event);
+
+// Per event type instrumentation
+struct EventTypeStats {
+    uint32_t posted;
+    uint32_t dispatched;
+    uint32_t dropped;
+    uint32_t max_latency_us;   // post -> handler start
+    uint64_t total_latency_us;
+    uint32_t max_handler_us;   // handler run time
+    uint64_t total_handler_us;
+};
+
+// Queue-wide instrumentation
+struct EventBusStats {
+    uint32_t queue_depth;
+    uint32_t max_queue_depth;
+    uint32_t queue_capacity;
+    EventTypeStats types[EVENT_TYPE_COUNT];
+};
+
+// Function prototypes
+void setupEventBus();
+bool registerEventHandler(EventType type, EventHandler handler);
+bool postEvent(EventType type, uint32_t arg = 0);
+void getEventBusStats(EventBusStats& stats);
+const char* eventTypeName(EventType type);
+
+#endif // EVENT_BUS_H
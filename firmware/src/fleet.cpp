@@ -0,0 +1,278 @@
+#include "fleet.h"
+#include "config.h"
+#include "rotator.h"
+#include "status_push.h"
+#include "event_bus.h"
+#include "build_info.h"
+#include <AsyncUDP.h>
+#include <ArduinoJson.h>
+#include <WiFi.h>
+#include <esp_timer.h>
+
+// Multicast listener; packets are handled in the async_udp task
+static AsyncUDP fleetUdp;
+
+// Stable id derived from the station MAC address (12 hex digits)
+static char deviceId[13];
+
+static esp_timer_handle_t fleetMoveTimer = NULL;
+
+// Scheduled move; written in the async_udp task, taken by the timer callback
+static portMUX_TYPE fleetLock = portMUX_INITIALIZER_UNLOCKED;
+static int32_t pendingAngle = -1;        // -1 when no move is scheduled
+static int64_t pendingAtUs = 0;          // esp_timer time at which the move is due
+
+// Last move request, so a retransmission is acknowledged without rescheduling
+static uint32_t lastMoveSeq = 0;
+static uint32_t lastMoveSender = 0;
+
+/**
+ * Check whether a group name appears in the comma-separated fleet_groups setting
+ */
+static bool isInGroup(const char* group) {
+    size_t length = strlen(group);
+    const char* entry = config.fleet_groups;
+
+    while (*entry) {
+        while (*entry == ' ') {
+            entry++;
+        }
+        const char* end = strchr(entry, ',');
+        size_t entryLength = end ? (size_t)(end - entry) : strlen(entry);
+        while (entryLength > 0 && entry[entryLength - 1] == ' ') {
+            entryLength--;
+        }
+
+        if (entryLength == length && strncmp(entry, group, length) == 0) {
+            return true;
+        }
+        if (!end) {
+            break;
+        }
+        entry = end + 1;
+    }
+    return false;
+}
+
+/**
+ * A request targets this unit by "id" (device id or mDNS name), by "group",
+ * or every unit when neither is given (or group is "*")
+ */
+static bool isAddressed(const JsonDocument& request) {
+    const char* id = request["id"];
+    if (id) {
+        return strcmp(id, deviceId) == 0 || strcmp(id, config.mdns_name) == 0;
+    }
+
+    const char* group = request["group"];
+    if (!group || strcmp(group, "*") == 0) {
+        return true;
+    }
+    return isInGroup(group);
+}
+
+/**
+ * Milliseconds until the scheduled move, or -1 if none is pending
+ */
+static int32_t pendingMoveInMs(int32_t* angle) {
+    portENTER_CRITICAL(&fleetLock);
+    int32_t pending = pendingAngle;
+    int64_t dueUs = pendingAtUs;
+    portEXIT_CRITICAL(&fleetLock);
+
+    if (angle) {
+        *angle = pending;
+    }
+    if (pending < 0) {
+        return -1;
+    }
+    int64_t remainingUs = dueUs - esp_timer_get_time();
+    return remainingUs > 0 ? (int32_t)(remainingUs / 1000) : 0;
+}
+
+/**
+ * Send a JSON reply to the sender of a packet (unicast)
+ * A reply that lost members or would not fit is dropped rather than sent cut off
+ */
+static void sendReply(AsyncUDPPacket& packet, const JsonDocument& reply) {
+    char buffer[FLEET_MAX_REPLY_SIZE];
+    if (reply.overflowed() || measureJson(reply) >= sizeof(buffer)) {
+        log_w("Fleet reply too large, not sent");
+        return;
+    }
+    size_t length = serializeJson(reply, buffer, sizeof(buffer));
+    packet.write((const uint8_t*)buffer, length);
+}
+
+/**
+ * Answer a discovery request with this unit's identity, position and state
+ */
+static void handleDiscover(AsyncUDPPacket& packet, uint32_t seq) {
+    StaticJsonDocument<FLEET_REPLY_DOC_SIZE> reply;
+    JsonObject obj = reply.to<JsonObject>();
+
+    obj["type"] = "announce";
+    obj["seq"] = seq;
+    obj["id"] = (const char*)deviceId;
+    obj["name"] = config.mdns_name;
+    obj["ip"] = packet.localIP().toString();
+    obj["groups"] = config.fleet_groups;
+    obj["fw"] = BUILD_GIT_HASH;
+
+    StatusSnapshot snapshot;
+    captureStatus(snapshot);
+    writeStatusJson(obj, snapshot, NULL);
+
+    int32_t scheduledAngle;
+    int32_t startsInMs = pendingMoveInMs(&scheduledAngle);
+    if (startsInMs >= 0) {
+        obj["state"] = "scheduled";
+        obj["scheduledAngle"] = scheduledAngle;
+        obj["startsInMs"] = startsInMs;
+    } else {
+        obj["state"] = snapshot.motion_active ? "moving" : "idle";
+    }
+
+    sendReply(packet, reply);
+}
+
+/**
+ * Replace any scheduled move with a new one, delayMs from now
+ */
+static void scheduleMove(int32_t angle, int32_t delayMs) {
+    esp_timer_stop(fleetMoveTimer);
+
+    portENTER_CRITICAL(&fleetLock);
+    pendingAngle = angle;
+    pendingAtUs = esp_timer_get_time() + (int64_t)delayMs * 1000;
+    portEXIT_CRITICAL(&fleetLock);
+
+    esp_timer_start_once(fleetMoveTimer, (uint64_t)delayMs * 1000);
+}
+
+/**
+ * Schedule a move and acknowledge it to the sender
+ * A retransmission (same seq from the same sender) is acknowledged again but not rescheduled,
+ * so the controller can resend to units whose ack it missed
+ */
+static void handleMove(AsyncUDPPacket& packet, const JsonDocument& request, uint32_t seq) {
+    StaticJsonDocument<192> reply;
+    reply["type"] = "ack";
+    reply["seq"] = seq;
+    reply["id"] = (const char*)deviceId;
+
+    JsonVariantConst angleValue = request["angle"];
+    int32_t angle = angleValue | -1;
+    int32_t delayMs = request["delayMs"] | 0;
+
+    if (!angleValue.is<int32_t>() || angle < 0 || angle >= 360) {
+        reply["ok"] = false;
+        reply["error"] = "Invalid angle";
+    } else if (delayMs < 0 || delayMs > FLEET_MAX_DELAY_MS) {
+        reply["ok"] = false;
+        reply["error"] = "Invalid delay";
+    } else {
+        uint32_t sender = packet.remoteIP();
+        if (seq == 0 || seq != lastMoveSeq || sender != lastMoveSender) {
+            scheduleMove(angle, delayMs);
+            lastMoveSeq = seq;
+            lastMoveSender = sender;
+            log_i("Fleet move to %d° scheduled in %d ms (seq %u)", angle, delayMs, seq);
+        }
+        reply["ok"] = true;
+        reply["startsInMs"] = max(pendingMoveInMs(NULL), (int32_t)0);
+    }
+
+    sendReply(packet, reply);
+}
+
+/**
+ * Fleet packet handler; runs in the async_udp task
+ */
+static void onFleetPacket(AsyncUDPPacket& packet) {
+    if (packet.length() > FLEET_MAX_PACKET_SIZE) {
+        return;
+    }
+
+    StaticJsonDocument<FLEET_MAX_PACKET_SIZE> request;
+    if (deserializeJson(request, (const char*)packet.data(), packet.length())) {
+        return;
+    }
+    if (!isAddressed(request)) {
+        return;
+    }
+
+    const char* type = request["type"] | "";
+    uint32_t seq = request["seq"] | 0;
+
+    if (strcmp(type, "discover") == 0) {
+        handleDiscover(packet, seq);
+    } else if (strcmp(type, "move") == 0) {
+        handleMove(packet, request, seq);
+    }
+}
+
+/**
+ * Scheduled move timer callback
+ * Only posts an event; the move itself starts in the dispatcher task
+ */
+static void fleetMoveTimerCallback(void* arg) {
+    portENTER_CRITICAL(&fleetLock);
+    int32_t angle = pendingAngle;
+    pendingAngle = -1;
+    portEXIT_CRITICAL(&fleetLock);
+
+    if (angle >= 0) {
+        postEvent(EVENT_FLEET_MOVE, (uint32_t)angle);
+    }
+}
+
+static void onFleetMove(const Event& event) {
+    log_i("Fleet move to %u° due", event.arg);
+    rotateToAngle((int)event.arg);
+}
+
+/**
+ * (Re)join the multicast group; interfaces only accept the membership once they are up
+ */
+static void startFleetListener() {
+    fleetUdp.close();
+    if (!fleetUdp.listenMulticast(FLEET_MULTICAST_ADDR, FLEET_PORT)) {
+        log_w("Fleet listener not started (no network interface yet)");
+        return;
+    }
+    log_i("Fleet listener on %s:%d", FLEET_MULTICAST_ADDR.toString().c_str(), FLEET_PORT);
+}
+
+static void onFleetWiFiEvent(arduino_event_id_t event, arduino_event_info_t info) {
+    startFleetListener();
+}
+
+const char* getFleetDeviceId() {
+    return deviceId;
+}
+
+/**
+ * Start the fleet discovery/group command listener
+ * Call after WiFi has been initialized
+ */
+void setupFleet() {
+    uint8_t mac[6];
+    WiFi.macAddress(mac);
+    snprintf(deviceId, sizeof(deviceId), "%02x%02x%02x%02x%02x%02x",
+             mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+
+    esp_timer_create_args_t move_timer_config = {};
+    move_timer_config.callback = &fleetMoveTimerCallback;
+    move_timer_config.name = "fleet_move_timer";
+    ESP_ERROR_CHECK(esp_timer_create(&move_timer_config, &fleetMoveTimer));
+
+    registerEventHandler(EVENT_FLEET_MOVE, onFleetMove);
+
+    fleetUdp.onPacket(onFleetPacket);
+    WiFi.onEvent(onFleetWiFiEvent, ARDUINO_EVENT_WIFI_STA_GOT_IP);
+    WiFi.onEvent(onFleetWiFiEvent, ARDUINO_EVENT_WIFI_AP_START);
+    startFleetListener();
+
+    log_i("Fleet control setup complete (id %s)", deviceId);
+}
@@ -0,0 +1,18 @@
+#ifndef FLEET_H
+#define FLEET_H
+
+#include <Arduino.h>
+
+// Fleet protocol configuration
+#define FLEET_MULTICAST_ADDR IPAddress(239, 255, 42, 1)  // Organization-local scope
+#define FLEET_PORT 42420
+#define FLEET_MAX_PACKET_SIZE 384       // Largest request accepted
+#define FLEET_MAX_REPLY_SIZE 768        // Longest announce (31-char name, 63-char groups, full hash) is ~520 bytes
+#define FLEET_REPLY_DOC_SIZE 640        // 17 members plus copies of the name, groups and IP
+#define FLEET_MAX_DELAY_MS 60000        // Latest a move may be scheduled
+
+// Function prototypes
+void setupFleet();
+const char* getFleetDeviceId();
+
+#endif // FLEET_H
@@ -0,0 +1,617 @@
+#include "history.h"
+#include "main.h"
+#include "event_bus.h"
+#include "wifi_manager.h"
+#include "api_response.h"
+#include "deferred_log.h"
+#include <SPIFFS.h>
+#include <esp_rom_crc.h>
+#include <time.h>
+
+// The journal is a series of append-only segment files, HISTORY_DIR/<number>.bin,
+// numbered upwards. Records are never rewritten; whole segments are deleted oldest
+// first, so SPIFFS spreads the erases over the partition. The RAM index holds the
+// time span of each segment, so a range query opens only the segments it needs.
+struct HistorySegment {
+    uint32_t number;
+    uint32_t first_time;
+    uint32_t last_time;
+    uint16_t records;                   // 0 until the first record lands
+};
+
+static HistorySegment segments[HISTORY_MAX_SEGMENTS + 1];   // +1 until the oldest is deleted
+static uint32_t segmentCount = 0;
+static SemaphoreHandle_t indexLock = NULL;  // Guards segments[] (writer task vs. HTTP readers)
+static volatile bool indexReady = false;    // Set once the writer task has scanned the journal
+
+// Writer task state
+static QueueHandle_t moveQueue = NULL;
+static uint32_t nextSequence = 1;
+static uint32_t nextSegmentNumber = 1;  // Above every segment file seen, indexed or not
+static uint32_t lastTimestamp = 0;
+static bool appendToNewest = false;     // The newest segment is neither full nor torn
+
+static HistoryStats historyStats = {};
+
+static const char* const moveResultNames[] = { "reached", "aborted", "stopped" };
+
+static void segmentPath(uint32_t number, char* path, size_t size) {
+    snprintf(path, size, HISTORY_DIR "/%08u.bin", number);
+}
+
+static uint32_t recordCrc(const MoveRecord& record) {
+    return esp_rom_crc32_le(0, (const uint8_t*)&record, offsetof(MoveRecord, crc));
+}
+
+/**
+ * Read record index of an open segment; false if it is missing or fails its CRC
+ */
+static bool readRecord(File& file, uint32_t index, MoveRecord& record) {
+    return file.seek(index * sizeof(MoveRecord)) &&
+           file.read((uint8_t*)&record, sizeof(record)) == sizeof(record) &&
+           record.crc == recordCrc(record);
+}
+
+/**
+ * Add a segment found at boot to the index, keeping it sorted by number
+ */
+static void indexSegment(const HistorySegment& segment) {
+    uint32_t i = segmentCount;
+    while (i > 0 && segments[i - 1].number > segment.number) {
+        segments[i] = segments[i - 1];
+        i--;
+    }
+    segments[i] = segment;
+    segmentCount++;
+}
+
+static void removeSegmentFile(uint32_t number) {
+    char path[32];
+    segmentPath(number, path, sizeof(path));
+    SPIFFS.remove(path);
+}
+
+/**
+ * Drop the oldest segment from the index and flash
+ */
+static void deleteOldestSegment() {
+    xSemaphoreTake(indexLock, portMAX_DELAY);
+    uint32_t number = segments[0].number;
+    memmove(&segments[0], &segments[1], (segmentCount - 1) * sizeof(HistorySegment));
+    segmentCount--;
+    xSemaphoreGive(indexLock);
+
+    removeSegmentFile(number);
+    historyStats.segments_deleted++;
+    dlog_i(LOG_MODULE_SYSTEM, "Deleted move history segment %u", number);
+}
+
+/**
+ * Build the index from the segment files: only the first and last record of each is read
+ * Files that cannot be indexed (corrupt first record, beyond HISTORY_MAX_SEGMENTS) are
+ * deleted, and new segments are numbered above every file seen, so an append never
+ * lands behind leftover bytes
+ */
+static void scanSegments() {
+    HistorySegment newest = {};
+    bool newestTorn = false;
+    uint32_t unusable[HISTORY_SCAN_MAX_DELETES];
+    uint32_t unusableCount = 0;
+
+    File dir = SPIFFS.open(HISTORY_DIR);
+    // SPIFFS has no real directories; opening the prefix lists the files under it
+    for (File file = dir.openNextFile(); file; file = dir.openNextFile()) {
+        const char* name = strrchr(file.name(), '/');
+        name = name ? name + 1 : file.name();
+        char* end;
+        uint32_t number = strtoul(name, &end, 10);
+        if (end == name || strcmp(end, ".bin") != 0) {
+            continue;
+        }
+        nextSegmentNumber = max(nextSegmentNumber, number + 1);
+
+        size_t size = file.size();
+        HistorySegment segment = { number, 0, 0, (uint16_t)min(size / sizeof(MoveRecord), (size_t)HISTORY_RECORDS_PER_SEGMENT) };
+        MoveRecord first, last;
+        bool valid = segment.records > 0 && readRecord(file, 0, first);
+        // A torn or corrupt tail keeps its slots (queries skip them), but the times come from intact records
+        uint32_t lastIndex = segment.records;
+        while (valid && lastIndex > 0 && !readRecord(file, lastIndex - 1, last)) {
+            lastIndex--;
+        }
+        file.close();
+
+        if (!valid || lastIndex == 0) {
+            log_w("Deleting unreadable move history segment %s", name);
+            if (unusableCount < HISTORY_SCAN_MAX_DELETES) {
+                unusable[unusableCount++] = number;
+            }
+            continue;
+        }
+        segment.first_time = first.timestamp;
+        segment.last_time = last.timestamp;
+
+        // Over the limit: keep the newest HISTORY_MAX_SEGMENTS, like appends do
+        xSemaphoreTake(indexLock, portMAX_DELAY);
+        indexSegment(segment);
+        uint32_t dropped = 0;
+        bool drop = segmentCount > HISTORY_MAX_SEGMENTS;
+        if (drop) {
+            dropped = segments[0].number;
+            memmove(&segments[0], &segments[1], (segmentCount - 1) * sizeof(HistorySegment));
+            segmentCount--;
+        }
+        xSemaphoreGive(indexLock);
+        if (drop) {
+            log_w("Deleting move history segment %u beyond the segment limit", dropped);
+            if (unusableCount < HISTORY_SCAN_MAX_DELETES) {
+                unusable[unusableCount++] = dropped;
+            }
+            if (dropped == number) {
+                continue;
+            }
+        }
+
+        if (number >= newest.number) {
+            newest = segment;
+            newestTorn = (size % sizeof(MoveRecord)) != 0 || lastIndex != segment.records;
+            nextSequence = last.sequence + 1;
+            lastTimestamp = last.timestamp;
+        }
+    }
+
+    dir.close();
+
+    // Removed after the listing, which must not change under the iteration; any
+    // beyond HISTORY_SCAN_MAX_DELETES go on a later boot
+    for (uint32_t i = 0; i < unusableCount; i++) {
+        removeSegmentFile(unusable[i]);
+        historyStats.segments_deleted++;
+    }
+
+    // Appending is only safe to the newest file on flash, and only if it was indexed intact
+    appendToNewest = segmentCount > 0 && !newestTorn && newest.records < HISTORY_RECORDS_PER_SEGMENT &&
+                     newest.number + 1 == nextSegmentNumber;
+}
+
+/**
+ * Stamp a finished move and append it to the newest segment, starting and trimming segments as needed
+ */
+static bool appendRecord(MoveRecord& record) {
+    // Keep timestamps ordered so the index and the binary search stay valid
+    if (record.timestamp < HISTORY_MIN_VALID_TIME) {
+        record.flags |= HISTORY_FLAG_NO_CLOCK;
+        record.timestamp = lastTimestamp;
+    } else if (record.timestamp < lastTimestamp) {
+        record.timestamp = lastTimestamp;
+    }
+    record.sequence = nextSequence;
+    record.crc = recordCrc(record);
+
+    if (!appendToNewest) {
+        // A newest segment left empty by a failed write is renumbered rather than followed by
+        // another, so repeated failures (full partition) cannot grow the index
+        if (segmentCount > 0 && segments[segmentCount - 1].records == 0) {
+            removeSegmentFile(segments[segmentCount - 1].number);
+            xSemaphoreTake(indexLock, portMAX_DELAY);
+            segments[segmentCount - 1].number = nextSegmentNumber++;
+            xSemaphoreGive(indexLock);
+        } else {
+            if (segmentCount > HISTORY_MAX_SEGMENTS) {
+                deleteOldestSegment();
+            }
+            HistorySegment segment = { nextSegmentNumber++, 0, 0, 0 };
+            xSemaphoreTake(indexLock, portMAX_DELAY);
+            segments[segmentCount++] = segment;
+            xSemaphoreGive(indexLock);
+        }
+        appendToNewest = true;
+    }
+
+    HistorySegment& segment = segments[segmentCount - 1];
+    char path[32];
+    segmentPath(segment.number, path, sizeof(path));
+    File file = SPIFFS.open(path, FILE_APPEND);
+    bool written = file && file.write((const uint8_t*)&record, sizeof(record)) == sizeof(record);
+    file.close();
+
+    if (!written) {
+        // A partial write would misalign the rest of this segment, so continue in a new one
+        historyStats.write_failures++;
+        appendToNewest = false;
+        return false;
+    }
+
+    xSemaphoreTake(indexLock, portMAX_DELAY);
+    if (segment.records == 0) {
+        segment.first_time = record.timestamp;
+    }
+    segment.last_time = record.timestamp;
+    segment.records++;
+    xSemaphoreGive(indexLock);
+
+    nextSequence++;
+    lastTimestamp = record.timestamp;
+    historyStats.written++;
+    appendToNewest = segment.records < HISTORY_RECORDS_PER_SEGMENT;
+
+    // Bound the journal by segment count and by how full the partition is
+    while (segmentCount > HISTORY_MAX_SEGMENTS ||
+           (segmentCount > 1 && SPIFFS.usedBytes() > SPIFFS.totalBytes() * HISTORY_MAX_FS_USAGE)) {
+        deleteOldestSegment();
+    }
+    return true;
+}
+
+/**
+ * Writer task: indexes the journal, then appends finished moves at low priority
+ * (SPIFFS writes can stall for a garbage collection pass)
+ */
+static void historyWriterTask(void* arg) {
+    int64_t start_us = esp_timer_get_time();
+    scanSegments();
+    indexReady = true;
+    log_i("Move history: %u segments indexed in %lld ms, next move #%u",
+          segmentCount, (esp_timer_get_time() - start_us) / 1000, nextSequence);
+
+    MoveRecord record;
+    for (;;) {
+        if (xQueueReceive(moveQueue, &record, portMAX_DELAY) == pdTRUE && !appendRecord(record)) {
+            dlog_w(LOG_MODULE_SYSTEM, "Failed to append move #%u to history", record.sequence);
+        }
+    }
+}
+
+/**
+ * Move finished: queue it for the writer (runs in the dispatcher task, never touches flash)
+ */
+static void onMoveCompleted(const Event& event) {
+    MoveSummary summary;
+    get_last_move_summary(summary);
+
+    MoveRecord record = {};
+    record.timestamp = (uint32_t)time(NULL);
+    record.start_position = summary.start_position;
+    record.target_position = summary.target_position;
+    record.final_position = summary.final_position;
+    record.duration_ms = summary.duration_ms;
+    record.peak_pwm = summary.peak_pwm;
+    record.result = summary.result;
+    record.faults = summary.faults;
+
+    if (xQueueSend(moveQueue, &record, 0) != pdTRUE) {
+        historyStats.dropped++;
+    }
+}
+
+/**
+ * Find the oldest stored record at or after from_time
+ * Returns false if there is none
+ */
+static bool seekHistory(uint32_t from_time, uint32_t& number, uint32_t& index) {
+    bool found = false;
+    uint32_t records = 0;
+
+    xSemaphoreTake(indexLock, portMAX_DELAY);
+    for (uint32_t i = 0; i < segmentCount; i++) {
+        if (segments[i].records > 0 && segments[i].last_time >= from_time) {
+            number = segments[i].number;
+            records = segments[i].records;
+            found = true;
+            break;
+        }
+    }
+    xSemaphoreGive(indexLock);
+    if (!found) {
+        return false;
+    }
+
+    char path[32];
+    segmentPath(number, path, sizeof(path));
+    File file = SPIFFS.open(path, FILE_READ);
+    if (!file) {
+        return false;
+    }
+
+    // Binary search on the (non-decreasing) timestamps; unreadable records count as older
+    uint32_t low = 0, high = records;
+    MoveRecord record;
+    while (low < high) {
+        uint32_t mid = (low + high) / 2;
+        if (!readRecord(file, mid, record) || record.timestamp < from_time) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    index = low;
+    return true;
+}
+
+/**
+ * Segment following number in the index; returns false after the newest
+ */
+static bool nextSegment(uint32_t& number) {
+    bool found = false;
+    xSemaphoreTake(indexLock, portMAX_DELAY);
+    for (uint32_t i = 0; i < segmentCount; i++) {
+        if (segments[i].number > number && segments[i].records > 0) {
+            number = segments[i].number;
+            found = true;
+            break;
+        }
+    }
+    xSemaphoreGive(indexLock);
+    return found;
+}
+
+/**
+ * Records currently stored in segment number (the newest one may still grow)
+ */
+static uint32_t segmentRecords(uint32_t number) {
+    uint32_t records = 0;
+    xSemaphoreTake(indexLock, portMAX_DELAY);
+    for (uint32_t i = 0; i < segmentCount; i++) {
+        if (segments[i].number == number) {
+            records = segments[i].records;
+            break;
+        }
+    }
+    xSemaphoreGive(indexLock);
+    return records;
+}
+
+static size_t renderRecord(const MoveRecord& record, bool first, char* line, size_t size) {
+    const char* result = record.result < sizeof(moveResultNames) / sizeof(moveResultNames[0]) ?
+                         moveResultNames[record.result] : "unknown";
+    int length = snprintf(line, size,
+        "%s\n{\"sequence\":%u,\"time\":%u,\"clockSynced\":%s,\"startPosition\":%lld,"
+        "\"targetPosition\":%lld,\"finalPosition\":%lld,\"durationMs\":%u,\"peakPwm\":%.3f,"
+        "\"result\":\"%s\",\"faults\":%u}",
+        first ? "" : ",", record.sequence, record.timestamp,
+        (record.flags & HISTORY_FLAG_NO_CLOCK) ? "false" : "true",
+        record.start_position, record.target_position, record.final_position,
+        record.duration_ms, record.peak_pwm, result, record.faults);
+    return length > 0 ? min((size_t)length, size - 1) : 0;
+}
+
+/**
+ * Streams the records of [from, to] as a JSON array, one segment file at a time
+ * Nothing is buffered beyond the current record, whatever the range
+ */
+class HistoryResponse : public AsyncAbstractResponse {
+public:
+    HistoryResponse(bool chunked, uint32_t from_time, uint32_t to_time, uint32_t limit)
+        : _to(to_time), _remaining(limit), _number(0), _index(0), _records(0),
+          _state(STATE_OPEN), _lineLength(0), _lineOffset(0) {
+        _code = 200;
+        _contentType = "application/json";
+        _sendContentLength = false;
+        _chunked = chunked;             // HTTP/1.0 clients read until the connection closes
+        _hasRecords = seekHistory(from_time, _number, _index);
+    }
+
+    bool _sourceValid() const override {
+        return true;
+    }
+
+    size_t _fillBuffer(uint8_t* buf, size_t maxLen) override {
+        size_t written = 0;
+        while (written < maxLen) {
+            if (_lineOffset == _lineLength) {
+                _lineLength = renderNextLine();
+                _lineOffset = 0;
+                if (_lineLength == 0) {
+                    break;
+                }
+            }
+            size_t count = min(_lineLength - _lineOffset, maxLen - written);
+            memcpy(buf + written, _line + _lineOffset, count);
+            _lineOffset += count;
+            written += count;
+        }
+        return written;
+    }
+
+private:
+    enum State { STATE_OPEN, STATE_RECORDS, STATE_CLOSE, STATE_DONE };
+
+    size_t renderNextLine() {
+        switch (_state) {
+            case STATE_OPEN:
+                _state = _hasRecords ? STATE_RECORDS : STATE_CLOSE;
+                _line[0] = '[';
+                return 1;
+
+            case STATE_RECORDS: {
+                MoveRecord record;
+                if (_remaining > 0 && readNext(record) && record.timestamp <= _to) {
+                    _remaining--;
+                    size_t length = renderRecord(record, _first, _line, sizeof(_line));
+                    _first = false;
+                    return length;
+                }
+                _file.close();
+                _state = STATE_CLOSE;
+            }
+            // fall through
+
+            case STATE_CLOSE:
+                _state = STATE_DONE;
+                memcpy(_line, "\n]\n", 3);
+                return 3;
+
+            default:
+                return 0;
+        }
+    }
+
+    /**
+     * Next intact record of the range, moving to the following segment as needed
+     */
+    bool readNext(MoveRecord& record) {
+        for (;;) {
+            if (!_file) {
+                char path[32];
+                segmentPath(_number, path, sizeof(path));
+                _file = SPIFFS.open(path, FILE_READ);
+                _records = segmentRecords(_number);
+                if (!_file || !_file.seek(_index * sizeof(MoveRecord))) {
+                    _index = _records;  // Deleted meanwhile; go on with the next segment
+                }
+            }
+
+            if (_index >= _records) {
+                _records = segmentRecords(_number);
+            }
+            if (_index >= _records) {
+                _file.close();
+                if (!nextSegment(_number)) {
+                    return false;
+                }
+                _index = 0;
+                continue;
+            }
+
+            _index++;
+            if (_file.read((uint8_t*)&record, sizeof(record)) == sizeof(record) &&
+                record.crc == recordCrc(record)) {
+                return true;
+            }
+        }
+    }
+
+    uint32_t _to;
+    uint32_t _remaining;
+    uint32_t _number;                   // Current segment
+    uint32_t _index;                    // Next record in it
+    uint32_t _records;
+    bool _hasRecords;
+    bool _first = true;
+    File _file;
+    State _state;
+    char _line[HISTORY_LINE_SIZE];
+    size_t _lineLength;
+    size_t _lineOffset;
+};
+
+/**
+ * Read an optional non-negative query parameter; false if present but malformed
+ */
+static bool getTimeParam(AsyncWebServerRequest* request, const char* name, uint32_t& value) {
+    if (!getParamValue(request, name, false)) {
+        return true;
+    }
+    int64_t parsed;
+    if (!getParamInt64(request, name, parsed, false) || parsed < 0 || parsed > UINT32_MAX) {
+        return false;
+    }
+    value = (uint32_t)parsed;
+    return true;
+}
+
+/**
+ * Journal counters; the index fields stay 0 until the startup scan is done
+ */
+void getHistoryStats(HistoryStats& stats) {
+    stats = historyStats;
+    stats.segments = 0;
+    stats.records = 0;
+    stats.first_time = 0;
+    stats.last_time = 0;
+    if (!indexReady) {
+        return;
+    }
+
+    xSemaphoreTake(indexLock, portMAX_DELAY);
+    for (uint32_t i = 0; i < segmentCount; i++) {
+        if (segments[i].records == 0) {
+            continue;
+        }
+        if (stats.segments == 0) {
+            stats.first_time = segments[i].first_time;
+        }
+        stats.segments++;
+        stats.records += segments[i].records;
+        stats.last_time = segments[i].last_time;
+    }
+    xSemaphoreGive(indexLock);
+}
+
+/**
+ * Create the index lock and the writer queue
+ * Runs in setup(), before the web server can call getHistoryStats() from /metrics
+ */
+void initHistory() {
+    indexLock = xSemaphoreCreateMutex();
+    moveQueue = xQueueCreate(HISTORY_QUEUE_DEPTH, sizeof(MoveRecord));
+}
+
+/**
+ * Register the /api/history handlers; they answer 503 until the journal has been indexed
+ * Must be called before webServer.begin()
+ */
+void setupHistoryApi() {
+    // Journal summary; registered first because /api/history also matches it as a prefix
+    webServer.on("/api/history/info", HTTP_GET, [](AsyncWebServerRequest *request) {
+        if (!indexReady) {
+            sendText(request, 503, "Move history not available");
+            return;
+        }
+        JsonResponseSlot *slot = beginJsonResponse(request);
+        if (!slot) return;
+        JsonDocument &doc = slot->doc;
+        HistoryStats stats;
+        getHistoryStats(stats);
+
+        doc["segments"] = stats.segments;
+        doc["records"] = stats.records;
+        doc["firstTime"] = stats.first_time;
+        doc["lastTime"] = stats.last_time;
+        doc["written"] = stats.written;
+        doc["writeFailures"] = stats.write_failures;
+        doc["dropped"] = stats.dropped;
+        doc["segmentsDeleted"] = stats.segments_deleted;
+
+        sendJsonSlot(request, slot);
+    });
+
+    // Moves finished in [from, to] (Unix seconds, inclusive), oldest first, streamed
+    webServer.on("/api/history", HTTP_GET, [](AsyncWebServerRequest *request) {
+        if (!indexReady) {
+            sendText(request, 503, "Move history not available");
+            return;
+        }
+        uint32_t from_time = 0, to_time = UINT32_MAX, limit = UINT32_MAX;
+        if (!getTimeParam(request, "from", from_time) || !getTimeParam(request, "to", to_time) ||
+            !getTimeParam(request, "limit", limit) || from_time > to_time) {
+            sendText(request, 400, "Invalid from, to or limit");
+            return;
+        }
+
+        AsyncWebServerResponse *response = new HistoryResponse(request->version() != 0, from_time, to_time, limit);
+        if (getParamValue(request, "download", false)) {
+            response->addHeader("Content-Disposition", "attachment; filename=\"move-history.json\"");
+        }
+        request->send(response);
+    });
+}
+
+/**
+ * Start the history writer
+ * Needs setup_spiffs() and initHistory() done; moves finished before this are not recorded
+ * Without a mounted file system nothing is recorded and the handlers keep answering 503
+ */
+void setupHistory() {
+    SpiffsMountState mount = get_spiffs_mount_state();
+    if (mount != SPIFFS_MOUNT_OK && mount != SPIFFS_MOUNT_FORMATTED) {
+        log_e("SPIFFS not mounted, move history disabled");
+        return;
+    }
+
+    xTaskCreate(historyWriterTask, "history_writer", HISTORY_WRITER_STACK_SIZE,
+                NULL, HISTORY_WRITER_PRIORITY, NULL);
+    registerEventHandler(EVENT_MOVE_COMPLETED, onMoveCompleted);
+
+    log_i("Move history setup complete");
+}
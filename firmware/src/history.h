@@ -0,0 +1,57 @@
+#ifndef HISTORY_H
+#define HISTORY_H
+
+#include <Arduino.h>
+
+// Move history configuration
+#define HISTORY_DIR "/history"
+#define HISTORY_RECORDS_PER_SEGMENT 1024    // 48 KB segment files
+#define HISTORY_MAX_SEGMENTS 128            // ~6 MB, 131k moves; the oldest segment is deleted beyond this
+#define HISTORY_MAX_FS_USAGE 0.75f          // Also delete old segments while SPIFFS is fuller than this
+#define HISTORY_SCAN_MAX_DELETES 16         // Unusable segment files removed per boot scan
+#define HISTORY_QUEUE_DEPTH 8               // Finished moves waiting for the writer task
+#define HISTORY_WRITER_PRIORITY 1           // Flash writes (and SPIFFS garbage collection) at the lowest priority
+#define HISTORY_WRITER_STACK_SIZE 4096
+#define HISTORY_MIN_VALID_TIME 1700000000   // Earlier clock readings mean SNTP has not synced yet
+#define HISTORY_LINE_SIZE 256               // One rendered JSON record
+
+// Flags in MoveRecord::flags
+enum HistoryRecordFlags : uint8_t {
+    HISTORY_FLAG_NO_CLOCK = 0x01,           // Clock not synced; timestamp repeats the previous record's
+};
+
+// One finished move as stored on flash (timestamps never decrease within the log)
+struct MoveRecord {
+    uint32_t timestamp;                     // Unix seconds at the end of the move
+    uint32_t sequence;                      // Move number, continues across segments and reboots
+    int64_t start_position;
+    int64_t target_position;
+    int64_t final_position;
+    uint32_t duration_ms;
+    float peak_pwm;                         // Largest |duty| applied, 0..1
+    uint8_t result;                         // MoveResult
+    uint8_t faults;                         // MoveFault bits
+    uint8_t flags;                          // HistoryRecordFlags
+    uint8_t reserved;
+    uint32_t crc;                           // CRC32 of the preceding bytes
+};
+
+// Journal state for /api/history/info and /metrics
+struct HistoryStats {
+    uint32_t segments;
+    uint32_t records;                       // Stored, across all segments
+    uint32_t first_time;                    // Oldest stored timestamp (0 when empty)
+    uint32_t last_time;
+    uint32_t written;                       // Since boot
+    uint32_t write_failures;
+    uint32_t dropped;                       // Moves lost because the writer queue was full
+    uint32_t segments_deleted;
+};
+
+// Function prototypes
+void initHistory();
+void setupHistoryApi();
+void setupHistory();
+void getHistoryStats(HistoryStats& stats);
+
+#endif // HISTORY_H
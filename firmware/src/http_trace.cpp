@@ -0,0 +1,333 @@
+#include "http_trace.h"
+#include "wifi_manager.h"
+#include "api_response.h"
+#include <esp_timer.h>
+
+// Histogram bounds shared by every route
+static const float latencyBounds[] = { 1, 2, 5, 10, 25, 50, 100, 250, 500, 1000 };          // milliseconds
+static const float sizeBounds[] = { 128, 512, 1024, 2048, 4096, 16384, 65536, 262144 };    // bytes
+
+// HTTP_TRACE_MAX_ROUTES + 1 entries; the last one collects the overflow as "other"
+static HttpRouteStats* routes = NULL;
+static uint8_t routeCount = 0;
+
+static bool serverTimingEnabled = false;
+
+// A request between header parsing and disconnect
+struct InflightRequest {
+    AsyncWebServerRequest* request;     // NULL marks a free slot
+    int64_t accepted_us;
+    HttpRouteStats* route;              // Set once the handler has run; NULL if not timed to completion
+};
+
+static InflightRequest inflight[HTTP_TRACE_MAX_INFLIGHT] = {};
+
+// The library keeps the bytes written per response protected; this reads them through a member pointer
+struct ResponseBytes : AsyncWebServerResponse {
+    static size_t written(const AsyncWebServerResponse* response) {
+        return response->*(&ResponseBytes::_writtenLength);
+    }
+};
+
+#define TRACE_HISTOGRAM(bounds) { bounds, sizeof(bounds) / sizeof(bounds[0]) }
+
+static void resetRoute(HttpRouteStats& route, const char* name) {
+    memset(&route, 0, sizeof(route));
+    strlcpy(route.route, name, sizeof(route.route));
+    route.handler_ms = TRACE_HISTOGRAM(latencyBounds);
+    route.first_byte_ms = TRACE_HISTOGRAM(latencyBounds);
+    route.total_ms = TRACE_HISTOGRAM(latencyBounds);
+    route.response_bytes = TRACE_HISTOGRAM(sizeBounds);
+}
+
+static void resetRoutes() {
+    routeCount = 0;
+    resetRoute(routes[HTTP_TRACE_MAX_ROUTES], "other");
+    for (int i = 0; i < HTTP_TRACE_MAX_INFLIGHT; i++) {
+        inflight[i].route = NULL;
+    }
+}
+
+/**
+ * Find or claim the entry for a request path
+ * Quotes, backslashes and control characters are replaced so the path is a valid metrics label
+ */
+static HttpRouteStats* findRoute(const char* url) {
+    char key[HTTP_TRACE_ROUTE_LENGTH];
+    size_t length = 0;
+    for (; url[length] && length < sizeof(key) - 1; length++) {
+        char c = url[length];
+        key[length] = (c == '"' || c == '\\' || (uint8_t)c < 0x20) ? '_' : c;
+    }
+    key[length] = '\0';
+
+    for (int i = 0; i < routeCount; i++) {
+        if (strcmp(routes[i].route, key) == 0) {
+            return &routes[i];
+        }
+    }
+    if (routeCount < HTTP_TRACE_MAX_ROUTES) {
+        resetRoute(routes[routeCount], key);
+        return &routes[routeCount++];
+    }
+    return &routes[HTTP_TRACE_MAX_ROUTES];
+}
+
+static InflightRequest* findInflight(AsyncWebServerRequest* request) {
+    for (int i = 0; i < HTTP_TRACE_MAX_INFLIGHT; i++) {
+        if (inflight[i].request == request) {
+            return &inflight[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Connection closed: the response has been sent (or the client gave up)
+ */
+static void finishRequest(AsyncWebServerRequest* request) {
+    InflightRequest* slot = findInflight(request);
+    if (!slot) {
+        return;
+    }
+
+    if (slot->route) {
+        float totalMs = (esp_timer_get_time() - slot->accepted_us) / 1000.0f;
+        observeHistogram(slot->route->total_ms, totalMs);
+        if (totalMs > slot->route->max_total_ms) {
+            slot->route->max_total_ms = totalMs;
+        }
+
+        AsyncWebServerResponse* response = request->getResponse();
+        if (response) {
+            observeHistogram(slot->route->response_bytes, ResponseBytes::written(response));
+        }
+    }
+    slot->request = NULL;
+}
+
+/**
+ * Headers parsed: start the clock
+ * Slots whose disconnect never arrived (a handler replaced our onDisconnect, as the OTA upload
+ * handler does) are recycled oldest first
+ */
+static bool noteRequestAccepted(AsyncWebServerRequest* request) {
+    InflightRequest* slot = findInflight(request);
+    if (!slot) {
+        slot = findInflight(NULL);
+    }
+    if (!slot) {
+        slot = &inflight[0];
+        for (int i = 1; i < HTTP_TRACE_MAX_INFLIGHT; i++) {
+            if (inflight[i].accepted_us < slot->accepted_us) {
+                slot = &inflight[i];
+            }
+        }
+    }
+
+    slot->request = request;
+    slot->accepted_us = esp_timer_get_time();
+    slot->route = NULL;
+    request->onDisconnect([request]() {
+        finishRequest(request);
+    });
+
+    return false;                       // Never handles the request itself
+}
+
+// Registered before every route, so its filter sees each request as soon as its headers are parsed
+static AsyncWebHandler requestStartHook;
+
+// Times the handler and attributes the request to its path once a response exists
+static AsyncMiddlewareFunction httpTraceMiddleware([](AsyncWebServerRequest* request, ArMiddlewareNext next) {
+    int64_t start = esp_timer_get_time();
+    next();
+    int64_t ready = esp_timer_get_time();
+
+    AsyncWebServerResponse* response = request->getResponse();
+    int code = response ? response->code() : 0;
+    HttpRouteStats* route = findRoute(request->url().c_str());
+    if (code >= 100 && code < 600) {
+        route->responses[code / 100 - 1]++;
+    }
+
+    InflightRequest* slot = findInflight(request);
+    int64_t accepted = slot ? slot->accepted_us : start;
+    float handlerMs = (ready - start) / 1000.0f;
+    observeHistogram(route->handler_ms, handlerMs);
+    observeHistogram(route->first_byte_ms, (ready - accepted) / 1000.0f);
+
+    if (slot) {
+        // A WebSocket upgrade keeps the connection open; its lifetime is not a response time
+        if (code == 101) {
+            slot->request = NULL;
+        } else {
+            slot->route = route;
+        }
+    }
+
+    if (serverTimingEnabled && response) {
+        char timing[64];
+        snprintf(timing, sizeof(timing), "queue;dur=%.2f, handler;dur=%.2f", (start - accepted) / 1000.0f, handlerMs);
+        response->addHeader("Server-Timing", timing);
+    }
+});
+
+uint8_t getHttpRouteCount() {
+    return routes ? routeCount : 0;
+}
+
+const HttpRouteStats* getHttpRoute(uint8_t index) {
+    if (!routes || index > routeCount) {
+        return NULL;
+    }
+    return index == routeCount ? &routes[HTTP_TRACE_MAX_ROUTES] : &routes[index];
+}
+
+static uint32_t routeRequestCount(const HttpRouteStats& route) {
+    uint32_t count = 0;
+    for (int i = 0; i < 5; i++) {
+        count += route.responses[i];
+    }
+    return count;
+}
+
+// Uploads and other requests without a total time are ranked by time to first byte
+static float routeSortKey(const HttpRouteStats& route) {
+    const MetricsHistogram& histogram = route.total_ms.count ? route.total_ms : route.first_byte_ms;
+    return estimateHistogramQuantile(histogram, 0.99f);
+}
+
+static void writeHistogramJson(JsonObject obj, const MetricsHistogram& histogram) {
+    obj["count"] = histogram.count;
+    obj["sum"] = getHistogramSum(histogram);
+    JsonArray bounds = obj.createNestedArray("le");
+    JsonArray counts = obj.createNestedArray("counts");
+    for (uint8_t i = 0; i <= histogram.bucket_count; i++) {
+        if (i < histogram.bucket_count) {
+            bounds.add(histogram.bounds[i]);
+        }
+        counts.add(histogram.counts[i]);
+    }
+}
+
+/**
+ * Full histograms for one path
+ */
+static void handleRouteDetail(AsyncWebServerRequest* request, const char* path) {
+    const HttpRouteStats* route = NULL;
+    for (uint8_t i = 0; i <= getHttpRouteCount() && !route; i++) {
+        const HttpRouteStats* candidate = getHttpRoute(i);
+        if (strcmp(candidate->route, path) == 0) {
+            route = candidate;
+        }
+    }
+    if (!route) {
+        sendText(request, 404, "No requests recorded for this route");
+        return;
+    }
+
+    JsonResponseSlot *slot = beginJsonResponse(request);
+    if (!slot) return;
+    JsonDocument &doc = slot->doc;
+
+    doc["route"] = (const char*)route->route;
+    JsonArray responses = doc.createNestedArray("responses");
+    for (int i = 0; i < 5; i++) {
+        responses.add(route->responses[i]);
+    }
+    writeHistogramJson(doc.createNestedObject("handlerMs"), route->handler_ms);
+    writeHistogramJson(doc.createNestedObject("firstByteMs"), route->first_byte_ms);
+    writeHistogramJson(doc.createNestedObject("totalMs"), route->total_ms);
+    writeHistogramJson(doc.createNestedObject("responseBytes"), route->response_bytes);
+    doc["maxTotalMs"] = route->max_total_ms;
+
+    sendJsonSlot(request, slot);
+}
+
+/**
+ * Slowest routes by p99, with percentiles estimated from the histograms
+ */
+static void handleRouteSummary(AsyncWebServerRequest* request) {
+    JsonResponseSlot *slot = beginJsonResponse(request);
+    if (!slot) return;
+    JsonDocument &doc = slot->doc;
+
+    const HttpRouteStats* ranked[HTTP_TRACE_MAX_ROUTES + 1];
+    uint8_t rankedCount = 0;
+    for (uint8_t i = 0; i <= getHttpRouteCount(); i++) {
+        const HttpRouteStats* route = getHttpRoute(i);
+        if (routeRequestCount(*route) == 0) {
+            continue;
+        }
+        // Insertion sort, slowest first
+        uint8_t position = rankedCount++;
+        float key = routeSortKey(*route);
+        while (position > 0 && routeSortKey(*ranked[position - 1]) < key) {
+            ranked[position] = ranked[position - 1];
+            position--;
+        }
+        ranked[position] = route;
+    }
+
+    doc["serverTiming"] = serverTimingEnabled;
+    doc["routesTracked"] = rankedCount;
+    JsonArray list = doc.createNestedArray("routes");
+    for (uint8_t i = 0; i < rankedCount && i < HTTP_TRACE_REPORT_ROUTES; i++) {
+        const HttpRouteStats* route = ranked[i];
+        JsonObject entry = list.createNestedObject();
+        entry["route"] = (const char*)route->route;
+        entry["count"] = routeRequestCount(*route);
+        entry["errors"] = route->responses[3] + route->responses[4];
+        entry["handlerP50"] = estimateHistogramQuantile(route->handler_ms, 0.5f);
+        entry["handlerP99"] = estimateHistogramQuantile(route->handler_ms, 0.99f);
+        entry["firstByteP99"] = estimateHistogramQuantile(route->first_byte_ms, 0.99f);
+        entry["totalP50"] = estimateHistogramQuantile(route->total_ms, 0.5f);
+        entry["totalP99"] = estimateHistogramQuantile(route->total_ms, 0.99f);
+        entry["totalMax"] = route->max_total_ms;
+    }
+
+    sendJsonSlot(request, slot);
+}
+
+/**
+ * Allocate the route table and install the request hook and middleware
+ * Must be called at the start of setupWebServer(), before any route is registered
+ */
+void setupHttpTrace() {
+    size_t bytes = sizeof(HttpRouteStats) * (HTTP_TRACE_MAX_ROUTES + 1);
+    routes = static_cast<HttpRouteStats*>(psramFound() ? ps_malloc(bytes) : malloc(bytes));
+    if (!routes) {
+        log_e("HTTP trace table allocation failed; tracing disabled");
+        return;
+    }
+    resetRoutes();
+
+    requestStartHook.setFilter(noteRequestAccepted);
+    webServer.addHandler(&requestStartHook);
+    webServer.addMiddleware(&httpTraceMiddleware);
+
+    // Per-route latency summary, or full histograms with ?route=/api/config
+    webServer.on("/api/diagnostics/http", HTTP_GET, [](AsyncWebServerRequest *request) {
+        const char* path = getParamValue(request, "route", false);
+        if (path) {
+            handleRouteDetail(request, path);
+        } else {
+            handleRouteSummary(request);
+        }
+    });
+
+    // server_timing=0|1 toggles the Server-Timing header, reset=1 clears the statistics
+    webServer.on("/api/diagnostics/http", HTTP_POST, [](AsyncWebServerRequest *request) {
+        int32_t value;
+        if (getParamInt32(request, "server_timing", value)) {
+            serverTimingEnabled = (value != 0);
+        }
+        if (getParamInt32(request, "reset", value) && value) {
+            resetRoutes();
+        }
+        sendText(request, 200, serverTimingEnabled ? "Server-Timing enabled" : "Server-Timing disabled");
+    });
+
+    log_i("HTTP tracing enabled (%u routes, %u bytes)", HTTP_TRACE_MAX_ROUTES, bytes);
+}
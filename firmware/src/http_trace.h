@@ -0,0 +1,31 @@
+#ifndef HTTP_TRACE_H
+#define HTTP_TRACE_H
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include "metrics.h"
+
+// HTTP tracing configuration
+#define HTTP_TRACE_MAX_ROUTES 32            // Distinct paths traced; later ones count as "other"
+#define HTTP_TRACE_ROUTE_LENGTH 40          // Longer paths are truncated
+#define HTTP_TRACE_MAX_INFLIGHT 8           // Requests timed at once (oldest slot is recycled)
+#define HTTP_TRACE_REPORT_ROUTES 10         // Slowest routes listed by /api/diagnostics/http
+
+// Per-path response counts and timings; allocated once (in PSRAM when present),
+// only touched by the async_tcp task
+struct HttpRouteStats {
+    char route[HTTP_TRACE_ROUTE_LENGTH];
+    uint32_t responses[5];              // By status class, 1xx..5xx
+    MetricsHistogram handler_ms;        // Handler and middleware run time
+    MetricsHistogram first_byte_ms;     // Headers parsed -> response handed to the connection
+    MetricsHistogram total_ms;          // Headers parsed -> connection closed after the response
+    MetricsHistogram response_bytes;    // Bytes written, headers included
+    float max_total_ms;
+};
+
+// Function prototypes
+void setupHttpTrace();
+uint8_t getHttpRouteCount();
+const HttpRouteStats* getHttpRoute(uint8_t index);     // index == getHttpRouteCount() is "other"
+
+#endif // HTTP_TRACE_H
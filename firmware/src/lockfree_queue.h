@@ -0,0 +1,108 @@
+#ifndef LOCKFREE_QUEUE_H
+#define LOCKFREE_QUEUE_H
+
+#include <Arduino.h>
+#include <atomic>
+
+/**
+ * Bounded multi-producer / multi-consumer queue (Vyukov sequence-cell design)
+ *
+ * push() and pop() never block and never take a lock, so producers running in
+ * the esp_timer task can hand work to other tasks without being delayed by
+ * them. Capacity must be a power of two.
+ */
+template <typename T, size_t Capacity>
+class LockFreeQueue {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                  "LockFreeQueue capacity must be a power of two");
+
+public:
+    LockFreeQueue() {
+        for (size_t i = 0; i < Capacity; i++) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        enqueue_pos.store(0, std::memory_order_relaxed);
+        dequeue_pos.store(0, std::memory_order_relaxed);
+    }
+
+    /**
+     * Append an item; returns false if the queue is full
+     */
+    bool push(const T& item) {
+        Cell* cell;
+        size_t pos = enqueue_pos.load(std::memory_order_relaxed);
+
+        for (;;) {
+            cell = &cells[pos & (Capacity - 1)];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+
+            if (diff == 0) {
+                if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->data = item;
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Remove the oldest item; returns false if the queue is empty
+     */
+    bool pop(T& item) {
+        Cell* cell;
+        size_t pos = dequeue_pos.load(std::memory_order_relaxed);
+
+        for (;;) {
+            cell = &cells[pos & (Capacity - 1)];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+
+            if (diff == 0) {
+                if (dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = dequeue_pos.load(std::memory_order_relaxed);
+            }
+        }
+
+        item = cell->data;
+        cell->sequence.store(pos + Capacity, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Approximate number of queued items (exact when producers/consumers are idle)
+     */
+    size_t size() const {
+        size_t head = enqueue_pos.load(std::memory_order_relaxed);
+        size_t tail = dequeue_pos.load(std::memory_order_relaxed);
+        return head >= tail ? head - tail : 0;
+    }
+
+    static constexpr size_t capacity() {
+        return Capacity;
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T data;
+    };
+
+    Cell cells[Capacity];
+    std::atomic<size_t> enqueue_pos;
+    std::atomic<size_t> dequeue_pos;
+};
+
+#endif // LOCKFREE_QUEUE_H
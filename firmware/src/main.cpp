@@ -2,13 +2,23 @@
 #include <SPIFFS.h>
 #include <ESP32Encoder.h>
 #include <driver/mcpwm.h>
+#include <driver/ledc.h>
+#include <esp_partition.h>
 #include <WiFi.h>
-#include <Adafruit_NeoPixel.h>
 #include "config.h"
 #include "wifi_manager.h"
 #include "neopixel.h"
 #include "rotator.h"
+#include "event_bus.h"
+#include "ota_update.h"
+#include "fleet.h"
+#include "udp_control.h"
+#include "metrics.h"
+#include "deferred_log.h"
+#include "boot_profile.h"
+#include "history.h"
 #include "main.h"
+#include <atomic>
 
 #define USER_LED_PIN 12
 #define M1A_PIN 15
@@ -28,34 +38,80 @@
 #define MCPWM_TIMER_M2 MCPWM_TIMER_1
 #define MCPWM_UNIT MCPWM_UNIT_0
 
+// Motion control parameter set, published as a whole by setMotionControlConfig()
+struct MotionParams {
+  int64_t position_hysteresis;
+  float max_speed;
+  float acceleration;
+  float vel_loop_p;
+  float vel_loop_i;
+  float vel_loop_d;
+  float vel_filter_persistence;
+  float spd_err_persistence;
+
+  // Derived at publish time so the control loop only multiplies
+  float inv_acceleration;          // 1 / acceleration
+  float acceleration_per_ms;       // acceleration / 1000
+  float vel_filter_gain;           // (1 - vel_filter_persistence) * 1000, counts/ms -> counts/s
+  float spd_err_gain;              // (1 - spd_err_persistence) * 1000, per ms -> per s
+};
+
 // Function prototypes
 void setup_pins();
 void setup_serial();
 void setup_quadrature_encoders();
 void setup_mcpwm();
-void setup_timers();
+void setup_user_led();
+void setup_scheduler();
 void setup_spiffs();
 void set_motor1_speed(float speed);
 void set_motor2_speed(float speed);
 void disable_motors();
-void toggle_led(void* arg);
 void update_encoder_status(void* arg);
 void update_motion_control(void* arg);
 void check_auto_rotation(void* arg);
 boolean is_motion_active(void);
 void send_debug_data_timer(void* arg);
-float generate_trapezoidal_profile(int64_t current_position, int64_t target_position, float current_velocity, float max_speed, float acceleration, unsigned long dt_ms);
+float generate_trapezoidal_profile(int64_t current_position, int64_t target_position, float current_velocity, const MotionParams& params, unsigned long dt_ms);
 
 // Global variables
 ESP32Encoder encoder1;
 ESP32Encoder encoder2;
 
-// ESP Timer handles
-esp_timer_handle_t led_timer;
-esp_timer_handle_t encoder_timer;
-esp_timer_handle_t motion_control_timer;
-esp_timer_handle_t auto_rotation_timer;
-esp_timer_handle_t debug_timer;
+// ESP Timer handle of the control tick
+esp_timer_handle_t control_tick_timer;
+
+// Periodic work run from the control tick
+struct TickTask {
+  const char* name;
+  esp_timer_cb_t run;
+  uint16_t divisor;
+  uint16_t phase;
+};
+
+static_assert(ENCODER_UPDATE_INTERVAL_MS == CONTROL_TICK_MS && MOTION_CONTROL_INTERVAL_MS == CONTROL_TICK_MS,
+              "Encoder and motion control run on every tick");
+static_assert(DEBUG_SEND_INTERVAL_MS % CONTROL_TICK_MS == 0 && DEBUG_SEND_TICK_PHASE < DEBUG_SEND_INTERVAL_MS / CONTROL_TICK_MS,
+              "Debug interval must be a whole number of ticks");
+static_assert(AUTO_ROTATION_CHECK_INTERVAL_MS % CONTROL_TICK_MS == 0 && AUTO_ROTATION_TICK_PHASE < AUTO_ROTATION_CHECK_INTERVAL_MS / CONTROL_TICK_MS,
+              "Auto rotation interval must be a whole number of ticks");
+static_assert(AUTO_ROTATION_TICK_PHASE % (DEBUG_SEND_INTERVAL_MS / CONTROL_TICK_MS) != DEBUG_SEND_TICK_PHASE,
+              "Debug and auto rotation ticks must not coincide");
+
+// In run order within a tick: the encoder velocity is fresh when the control loop reads it
+static const TickTask tick_schedule[] = {
+  { "encoder", update_encoder_status, ENCODER_UPDATE_INTERVAL_MS / CONTROL_TICK_MS, 0 },
+  { "motion_control", update_motion_control, MOTION_CONTROL_INTERVAL_MS / CONTROL_TICK_MS, 0 },
+  { "debug", send_debug_data_timer, DEBUG_SEND_INTERVAL_MS / CONTROL_TICK_MS, DEBUG_SEND_TICK_PHASE },
+  { "auto_rotation", check_auto_rotation, AUTO_ROTATION_CHECK_INTERVAL_MS / CONTROL_TICK_MS, AUTO_ROTATION_TICK_PHASE },
+};
+
+#define TICK_TASK_COUNT (sizeof(tick_schedule) / sizeof(tick_schedule[0]))
+
+// Written by the esp_timer task only
+static TickSchedulerStats tick_stats = {};
+static uint32_t tick_task_runs[TICK_TASK_COUNT] = {};
+static uint32_t tick_task_max_us[TICK_TASK_COUNT] = {};
 
 // Variables for velocity calculation
 volatile int64_t g_last_encoder_count = 0;
@@ -65,26 +121,30 @@ volatile unsigned long g_last_velocity_calc_time = 0;
 // Variable for sanity checking motion
 volatile int64_t g_last_position_error = 0;
 
-// LED state
-volatile bool led_state = false;
-
 // Motion control variables
 volatile bool motion_active = false;
+volatile bool stop_requested = false;
 volatile int64_t target_position = 0;
 volatile float max_velocity = DEFAULT_MAX_SPEED;
 volatile float acceleration = DEFAULT_ACCELERATION;
 volatile float current_setpoint_velocity = 0;
 volatile unsigned long last_motion_update_time = 0;
 
-// Motion control parameters (module-level variables)
-static uint32_t motion_position_hysteresis = DEFAULT_POSITION_HYSTERESIS;
-static float motion_max_speed = DEFAULT_MAX_SPEED;
-static float motion_acceleration = DEFAULT_ACCELERATION;
-static float motion_vel_loop_p = DEFAULT_VEL_LOOP_P;
-static float motion_vel_loop_i = DEFAULT_VEL_LOOP_I;
-static float motion_vel_loop_d = DEFAULT_VEL_LOOP_D;
-static float motion_vel_filter_persistence = DEFAULT_VEL_FILTER_PERSISTENCE;
-static float motion_spd_err_persistence = DEFAULT_SPD_ERR_PERSISTENCE;
+// Current move bookkeeping for the move history (written by the control loop)
+static int64_t move_start_position = 0;
+static int64_t move_start_us = 0;
+static float move_peak_pwm = 0;
+static uint8_t move_faults = 0;
+static MoveSummary last_move = {};
+
+// Motion control parameters: the published set is guarded by a sequence number (odd while
+// it is being rewritten). The timer callbacks copy it into loop_params at the start of a
+// tick whenever the sequence has moved, so a tick never mixes old and new values
+static MotionParams published_params;
+static std::atomic<uint32_t> params_sequence(0);
+static portMUX_TYPE params_lock = portMUX_INITIALIZER_UNLOCKED;
+static MotionParams loop_params;           // Only touched by the esp_timer task
+static uint32_t loop_params_sequence = 0;
 
 // Debug variables for WebSocket streaming
 float debug_speed_error = 0.0f;
@@ -92,38 +152,26 @@ float debug_speed_error_integral = 0.0f;
 float debug_speed_error_derivative = 0.0f;
 float debug_control_pwm_out = 0.0f;
 
-void setup() {
-  // Initialize the system
-  setup_pins();
-  disable_motors();
-  setup_serial();
-  
-  // Setup file system and configuration
-  setup_spiffs();
-  loadConfiguration();
-  
-  // Initialize motion control parameters from configuration
-  setMotionControlConfig(config.position_hysteresis, config.max_speed, config.acceleration,
-                        config.vel_loop_p, config.vel_loop_i, config.vel_loop_d,
-                        config.vel_filter_persistence, config.spd_err_persistence);
-  
-  // Initialize calibration-based parameters
-  updateMotionControlCalibration();
-  
-  // Initialize components
-  setup_quadrature_encoders();
-  setupNeoPixel();
-  setup_mcpwm();
-  setup_timers();
-  setupRotator();
-  
-  // Start WiFi and web server
-  initializeWiFi();
-  setupCaptivePortal();
-  setupWebServer();
-  setupOTA();
-  
-  //delay(500);
+/**
+ * Network half of startup, run alongside the motion setup in setup()
+ * WiFi association dominates boot time, so nothing on the motor side waits for it
+ */
+static void network_startup_task(void* arg) {
+  runBootPhase("wifi", []() { initializeWiFi(); });
+  runBootPhase("captive_portal", setupCaptivePortal);
+  runBootPhase("web_server", setupWebServer);
+  runBootPhase("fleet_udp", []() { setupFleet(); setupUdpControl(); });
+  markBootMilestone(BOOT_MILESTONE_NETWORK_READY);
+
+  // Only the legacy configuration import needs the file system earlier (and mounts it
+  // itself), so the mount (and the format of a blank partition) is off the critical path
+  runBootPhase("spiffs", setup_spiffs);
+  runBootPhase("history", setupHistory);
+
+  // The self-test covers the whole system, so wait for the motion side too
+  while (getBootMilestoneUs(BOOT_MILESTONE_MOTOR_READY) < 0) {
+    vTaskDelay(pdMS_TO_TICKS(1));
+  }
   
   // Log system information
   log_i("Total heap: %d", ESP.getHeapSize());
@@ -136,17 +184,103 @@ void setup() {
   log_i("Flash chip real size: %d", ESP.getFlashChipSize());
   log_i("Flash chip speed: %d", ESP.getFlashChipSpeed()); 
   
+  // Confirm a freshly updated image, or roll back to the previous one
+  runBootPhase("self_test", confirmRunningFirmware);
+  markBootMilestone(BOOT_MILESTONE_STARTUP_DONE);
+  logBootProfile();
+  
   log_i("Rotator ready!");
+  vTaskDelete(NULL);
+}
+
+void setup() {
+  // Initialize the system
+  runBootPhase("pins", []() { setup_pins(); disable_motors(); });
+  runBootPhase("serial_log", []() { setup_serial(); setupDeferredLog(); });
+  
+  // Load configuration and initialize motion control and calibration parameters from it
+  runBootPhase("config", []() { loadConfiguration(); applyRuntimeConfig(); });
+  
+  // Shared by both startup paths
+  runBootPhase("event_bus", setupEventBus);
+  runBootPhase("history_init", initHistory);
+  runBootPhase("neopixel", setupNeoPixel);
+  
+  // Start WiFi and web server in the background
+  xTaskCreatePinnedToCore(network_startup_task, "net_startup", NETWORK_STARTUP_STACK_SIZE,
+                          NULL, NETWORK_STARTUP_PRIORITY, NULL, NETWORK_STARTUP_CORE);
+  
+  // Bring up the motion subsystem meanwhile
+  runBootPhase("encoders", setup_quadrature_encoders);
+  runBootPhase("mcpwm", setup_mcpwm);
+  runBootPhase("user_led", setup_user_led);
+  runBootPhase("scheduler", setup_scheduler);
+  runBootPhase("rotator", setupRotator);
+  markBootMilestone(BOOT_MILESTONE_MOTOR_READY);
+  
+  log_i("Motor ready %lld ms after boot", getBootMilestoneUs(BOOT_MILESTONE_MOTOR_READY) / 1000);
+}
+
+static volatile SpiffsMountState spiffs_mount_state = SPIFFS_MOUNT_PENDING;
+
+/**
+ * True when every byte of the SPIFFS partition is erased, i.e. it never held a file system
+ * Stops at the first programmed word, so only a truly blank partition is read to the end
+ */
+static bool spiffs_partition_blank() {
+  const esp_partition_t* partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                                              ESP_PARTITION_SUBTYPE_DATA_SPIFFS, NULL);
+  if (!partition) {
+    return false;
+  }
+
+  static uint32_t buffer[256];
+  for (size_t offset = 0; offset < partition->size; offset += sizeof(buffer)) {
+    if (esp_partition_read(partition, offset, buffer, sizeof(buffer)) != ESP_OK) {
+      return false;
+    }
+    for (size_t i = 0; i < sizeof(buffer) / sizeof(buffer[0]); i++) {
+      if (buffer[i] != 0xFFFFFFFF) {
+        return false;
+      }
+    }
+    // Reading 13 MB takes a while; let the idle task feed the watchdog
+    if (offset % SPIFFS_BLANK_CHECK_YIELD_BYTES == 0) {
+      vTaskDelay(1);
+    }
+  }
+  return true;
 }
 
 void setup_spiffs() {
-  if (!SPIFFS.begin(true)) {
-    log_e("SPIFFS mount failed");
-  } else {
+  if (SPIFFS.begin(false)) {
+    spiffs_mount_state = SPIFFS_MOUNT_OK;
     log_i("SPIFFS mounted successfully");
+    return;
+  }
+
+  // A failed mount may be transient, and the partition holds the move history:
+  // only format a partition that has never been written
+  if (!spiffs_partition_blank()) {
+    spiffs_mount_state = SPIFFS_MOUNT_FAILED;
+    log_e("SPIFFS mount failed; the partition holds data, so it was not formatted");
+    return;
+  }
+
+  log_w("SPIFFS partition is blank, formatting");
+  if (SPIFFS.begin(true)) {
+    spiffs_mount_state = SPIFFS_MOUNT_FORMATTED;
+    log_i("SPIFFS formatted and mounted");
+  } else {
+    spiffs_mount_state = SPIFFS_MOUNT_FAILED;
+    log_e("SPIFFS format failed");
   }
 }
 
+SpiffsMountState get_spiffs_mount_state() {
+  return spiffs_mount_state;
+}
+
 void setup_mcpwm() {
   // Motor 1 MCPWM configuration
   mcpwm_gpio_init(MCPWM_UNIT, MCPWM0A, M1A_PIN);
@@ -171,59 +305,91 @@ void setup_mcpwm() {
   log_i("MCPWM initialized");
 }
 
-void setup_timers() {
-  // LED blink timer
-  esp_timer_create_args_t led_timer_config = {};
-  led_timer_config.callback = &toggle_led;
-  led_timer_config.name = "led_timer";
-  
-  ESP_ERROR_CHECK(esp_timer_create(&led_timer_config, &led_timer));
-  ESP_ERROR_CHECK(esp_timer_start_periodic(led_timer, LED_BLINK_INTERVAL_MS * 1000));
-  
-  // Encoder update timer
-  esp_timer_create_args_t encoder_timer_config = {};
-  encoder_timer_config.callback = &update_encoder_status;
-  encoder_timer_config.name = "encoder_timer";
-  
-  ESP_ERROR_CHECK(esp_timer_create(&encoder_timer_config, &encoder_timer));
-  ESP_ERROR_CHECK(esp_timer_start_periodic(encoder_timer, ENCODER_UPDATE_INTERVAL_MS * 1000));
-  
-  // Motion control timer
-  esp_timer_create_args_t motion_timer_config = {};
-  motion_timer_config.callback = &update_motion_control;
-  motion_timer_config.name = "motion_control_timer";
-  
-  ESP_ERROR_CHECK(esp_timer_create(&motion_timer_config, &motion_control_timer));
-  ESP_ERROR_CHECK(esp_timer_start_periodic(motion_control_timer, MOTION_CONTROL_INTERVAL_MS * 1000));
-  
-  // Auto rotation check timer
-  esp_timer_create_args_t auto_rotation_timer_config = {};
-  auto_rotation_timer_config.callback = &check_auto_rotation;
-  auto_rotation_timer_config.name = "auto_rotation_timer";
-  
-  ESP_ERROR_CHECK(esp_timer_create(&auto_rotation_timer_config, &auto_rotation_timer));
-  ESP_ERROR_CHECK(esp_timer_start_periodic(auto_rotation_timer, AUTO_ROTATION_CHECK_INTERVAL_MS * 1000));
-  
-  // Debug data streaming timer
-  esp_timer_create_args_t debug_timer_config = {};
-  debug_timer_config.callback = &send_debug_data_timer;
-  debug_timer_config.name = "debug_timer";
-  
-  ESP_ERROR_CHECK(esp_timer_create(&debug_timer_config, &debug_timer));
-  ESP_ERROR_CHECK(esp_timer_start_periodic(debug_timer, DEBUG_SEND_INTERVAL_MS * 1000));
-  
-  log_i("Timers initialized");
+void setup_user_led() {
+  // Blink state lives in the LEDC timer; nothing runs on the CPU to toggle the pin
+  setLEDBlink(5, 50);
+
+  ledc_channel_config_t channel_config = {};
+  channel_config.gpio_num = USER_LED_PIN;
+  channel_config.speed_mode = LEDC_LOW_SPEED_MODE;
+  channel_config.channel = USER_LED_LEDC_CHANNEL;
+  channel_config.timer_sel = USER_LED_LEDC_TIMER;
+  channel_config.intr_type = LEDC_INTR_DISABLE;
+  channel_config.duty = (1 << USER_LED_LEDC_RESOLUTION) / 2;
+  ESP_ERROR_CHECK(ledc_channel_config(&channel_config));
+
+  registerEventHandler(EVENT_WIFI_STATE_CHANGED, [](const Event& event) {
+    updateLEDStatus();
+  });
+  // WiFi starts concurrently, so catch up on a state change posted before the handler existed
+  postEvent(EVENT_WIFI_STATE_CHANGED, getWiFiState());
+
+  log_i("User LED initialized (LEDC channel %d)", USER_LED_LEDC_CHANNEL);
+}
+
+/**
+ * Control tick: the only periodic esp_timer. Runs every task of tick_schedule whose
+ * divisor and phase select this tick, in table order
+ */
+static void IRAM_ATTR control_tick(void* arg) {
+  static uint32_t tick = 0;
+  int64_t tick_start = esp_timer_get_time();
+  recordControlLoopTick();
+
+  int64_t task_start = tick_start;
+  for (uint8_t i = 0; i < TICK_TASK_COUNT; i++) {
+    const TickTask& task = tick_schedule[i];
+    if (tick % task.divisor != task.phase) {
+      continue;
+    }
+    task.run(arg);
+    int64_t task_end = esp_timer_get_time();
+    tick_task_runs[i]++;
+    tick_task_max_us[i] = max(tick_task_max_us[i], (uint32_t)(task_end - task_start));
+    task_start = task_end;
+  }
+
+  uint32_t tick_us = (uint32_t)(task_start - tick_start);
+  tick_stats.max_tick_us = max(tick_stats.max_tick_us, tick_us);
+  if (tick_us > CONTROL_TICK_MS * 1000) {
+    tick_stats.overruns++;
+  }
+  tick_stats.ticks++;
+  tick++;
+}
+
+void setup_scheduler() {
+  esp_timer_create_args_t tick_timer_config = {};
+  tick_timer_config.callback = &control_tick;
+  tick_timer_config.name = "control_tick";
+
+  ESP_ERROR_CHECK(esp_timer_create(&tick_timer_config, &control_tick_timer));
+  ESP_ERROR_CHECK(esp_timer_start_periodic(control_tick_timer, CONTROL_TICK_MS * 1000));
+
+  log_i("Control tick started (%d ms, %u tasks)", CONTROL_TICK_MS, (unsigned)TICK_TASK_COUNT);
+}
+
+void get_tick_scheduler_stats(TickSchedulerStats& stats) {
+  stats = tick_stats;
+}
+
+uint8_t get_tick_task_count() {
+  return TICK_TASK_COUNT;
+}
+
+void get_tick_task_stats(uint8_t index, TickTaskStats& stats) {
+  const TickTask& task = tick_schedule[index];
+  stats.name = task.name;
+  stats.divisor = task.divisor;
+  stats.phase = task.phase;
+  stats.runs = tick_task_runs[index];
+  stats.max_run_us = tick_task_max_us[index];
 }
 
 void loop() {
-  // Process DNS requests for captive portal
-  handleDNS();
-  
-  // Central LED state management
-  updateLEDStatus();
-  
-  // Main loop is now mostly empty as the work is done by timers and async handlers
-  delay(10); // Short delay to prevent watchdog timeouts
+  // All work is done by timers, the event dispatcher and async handlers (captive DNS included);
+  // the LED follows EVENT_WIFI_STATE_CHANGED. Nothing is left to poll, so park the loop task
+  vTaskDelay(portMAX_DELAY);
 }
 
 void setup_pins() {
@@ -274,9 +440,27 @@ void reset_motor_control(){
   setup_mcpwm();
 }
 
-void IRAM_ATTR toggle_led(void* arg) {
-  led_state = !led_state;
-  digitalWrite(USER_LED_PIN, led_state);
+/**
+ * Copy the published parameter set, retrying if a writer was part way through it
+ */
+static void IRAM_ATTR read_motion_params(MotionParams& params, uint32_t& sequence) {
+  uint32_t before, after;
+  do {
+    before = params_sequence.load(std::memory_order_acquire);
+    params = published_params;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    after = params_sequence.load(std::memory_order_relaxed);
+  } while ((before & 1) || before != after);
+  sequence = before;
+}
+
+/**
+ * Pick up a newly published parameter set at a tick boundary
+ */
+static inline void IRAM_ATTR refresh_loop_params() {
+  if (params_sequence.load(std::memory_order_relaxed) != loop_params_sequence) {
+    read_motion_params(loop_params, loop_params_sequence);
+  }
 }
 
 void IRAM_ATTR update_encoder_status(void* arg) {
@@ -285,9 +469,12 @@ void IRAM_ATTR update_encoder_status(void* arg) {
   unsigned long time_diff = current_time - g_last_velocity_calc_time;
   static float last_encoder_velocity = 0;
   
+  refresh_loop_params();
+  const MotionParams& params = loop_params;
+  
   // Calculate velocity in counts per second
   if (time_diff > 0) {
-    g_encoder_velocity = (1 - motion_vel_filter_persistence) * ((float)(current_count - g_last_encoder_count) * 1000.0) / time_diff + last_encoder_velocity * motion_vel_filter_persistence;
+    g_encoder_velocity = params.vel_filter_gain * (float)(current_count - g_last_encoder_count) / time_diff + last_encoder_velocity * params.vel_filter_persistence;
     last_encoder_velocity = g_encoder_velocity;
   }
   
@@ -296,7 +483,23 @@ void IRAM_ATTR update_encoder_status(void* arg) {
   g_last_velocity_calc_time = current_time;
 }
 
+/**
+ * Record how the current move ended; target_position must still hold the move's target
+ */
+static void IRAM_ATTR finish_move_summary(MoveResult result, int64_t current_position) {
+  last_move.start_position = move_start_position;
+  last_move.target_position = target_position;
+  last_move.final_position = current_position;
+  last_move.duration_ms = (uint32_t)((esp_timer_get_time() - move_start_us) / 1000);
+  last_move.peak_pwm = move_peak_pwm;
+  last_move.result = result;
+  last_move.faults = move_faults;
+}
+
 void IRAM_ATTR update_motion_control(void* arg) {
+  refresh_loop_params();
+  const MotionParams& params = loop_params;
+
   if (!motion_active) {
     set_motor1_speed(0);
     debug_control_pwm_out = 0.0f;
@@ -314,7 +517,33 @@ void IRAM_ATTR update_motion_control(void* arg) {
   unsigned long current_time = millis();
   unsigned long dt_ms = current_time - last_motion_update_time;
   
-  if(abs(current_position - target_position) > (abs(g_last_position_error) + motion_position_hysteresis)) {
+  // Stop requested by stop_motion(): hold the current position
+  if (stop_requested) {
+    set_motor1_speed(0);
+    debug_control_pwm_out = 0.0f;
+    motion_active = false;
+    stop_requested = false;
+
+    // Reset PID control variables
+    speed_error_integral = 0;
+    speed_error_previous = 0;
+    last_target_velocity = 0;
+    last_speed_deriv_err = 0;
+    
+    // Reset debug variables
+    debug_speed_error = 0.0f;
+    debug_speed_error_integral = 0.0f;
+    debug_speed_error_derivative = 0.0f;
+
+    finish_move_summary(MOVE_RESULT_STOPPED, current_position);
+    target_position = current_position;
+
+    dlog_i(LOG_MODULE_MOTION, "Motion stopped at position %lld", current_position);
+    postEvent(EVENT_MOVE_COMPLETED, MOVE_RESULT_STOPPED);
+    return;
+  }
+
+  if(abs(current_position - target_position) > (abs(g_last_position_error) + params.position_hysteresis)) {
     set_motor1_speed(0);
     debug_control_pwm_out = 0.0f;
     motion_active = false;
@@ -330,14 +559,17 @@ void IRAM_ATTR update_motion_control(void* arg) {
     debug_speed_error_integral = 0.0f;
     debug_speed_error_derivative = 0.0f;
 
+    move_faults |= MOVE_FAULT_ERROR_GROWING;
+    finish_move_summary(MOVE_RESULT_ABORTED, current_position);
     target_position = current_position;
 
-    log_w("Motion Error increasing with time!  Motion stopped!");
+    dlog_w(LOG_MODULE_MOTION, "Motion Error increasing with time!  Motion stopped!");
+    postEvent(EVENT_MOVE_COMPLETED, MOVE_RESULT_ABORTED);
     return;
   }
 
   // Check if we've reached target position with hysteresis
-  if (abs(current_position - target_position) <= motion_position_hysteresis) {
+  if (abs(current_position - target_position) <= params.position_hysteresis) {
     // We've reached the target position, stop the motor
     set_motor1_speed(0);
     debug_control_pwm_out = 0.0f;
@@ -354,7 +586,10 @@ void IRAM_ATTR update_motion_control(void* arg) {
     debug_speed_error_integral = 0.0f;
     debug_speed_error_derivative = 0.0f;
 
-    log_i("Target position reached: %lld (current: %lld)", target_position, current_position);
+    finish_move_summary(MOVE_RESULT_REACHED, current_position);
+
+    dlog_i(LOG_MODULE_MOTION, "Target position reached: %lld (current: %lld)", target_position, current_position);
+    postEvent(EVENT_MOVE_COMPLETED, MOVE_RESULT_REACHED);
     return;
   }
   
@@ -363,8 +598,7 @@ void IRAM_ATTR update_motion_control(void* arg) {
     current_position, 
     target_position, 
     last_target_velocity, 
-    motion_max_speed, 
-    motion_acceleration, 
+    params, 
     dt_ms
   );
   last_target_velocity = target_velocity;
@@ -372,10 +606,10 @@ void IRAM_ATTR update_motion_control(void* arg) {
   // PID controller for velocity
   float speed_error = target_velocity - g_encoder_velocity;
   speed_error_integral += speed_error * dt_ms / 1000.0;
-  float speed_error_derivative = (1.0f - motion_spd_err_persistence) * (speed_error - speed_error_previous) / (dt_ms / 1000.0) + motion_spd_err_persistence * last_speed_deriv_err;
+  float speed_error_derivative = params.spd_err_gain * (speed_error - speed_error_previous) / dt_ms + params.spd_err_persistence * last_speed_deriv_err;
   last_speed_deriv_err = speed_error_derivative;
   speed_error_previous = speed_error;
-  float motor_speed = motion_vel_loop_p * speed_error + motion_vel_loop_i * speed_error_integral + motion_vel_loop_d * speed_error_derivative;
+  float motor_speed = params.vel_loop_p * speed_error + params.vel_loop_i * speed_error_integral + params.vel_loop_d * speed_error_derivative;
 
   // Update debug variables for WebSocket streaming
   debug_speed_error = speed_error;
@@ -389,6 +623,12 @@ void IRAM_ATTR update_motion_control(void* arg) {
 
   // Apply motor speed
   set_motor1_speed(-motor_speed);
+  float applied_pwm = fabsf(motor_speed);
+  if (applied_pwm > MAX_MOTOR_PWM_DUTY_CYCLE) {
+    move_faults |= MOVE_FAULT_PWM_SATURATED;
+    applied_pwm = MAX_MOTOR_PWM_DUTY_CYCLE;
+  }
+  move_peak_pwm = max(move_peak_pwm, applied_pwm);
   debug_control_pwm_out = -motor_speed;
   
   // Update timing for next cycle
@@ -400,32 +640,58 @@ bool is_motion_active(void){
   return motion_active;
 }
 
-void IRAM_ATTR check_auto_rotation(void* arg) {
-  processAutoRotation();
-  // log_i("WiFi RSSI: %d dBm", WiFi.RSSI());
+/**
+ * Auto-rotation timer callback
+ * Only posts an event; rotation (logging, NeoPixel update) runs in the dispatcher task
+ */
+void check_auto_rotation(void* arg) {
+  postEvent(EVENT_AUTO_ROTATION_TICK);
 }
 
 /**
  * Initiates a motion to a target position using a trapezoidal velocity profile
+ * Returns false (and does nothing) if a move is already in progress
  */
-void move_to_position(int64_t position) {
+bool move_to_position(int64_t position) {
   if(motion_active){
-    return;
+    return false;
   }
 
   // Set motion parameters
 
+  stop_requested = false;
   target_position = position;
-  g_last_position_error = encoder1.getCount() - target_position;
+  move_start_position = encoder1.getCount();
+  move_start_us = esp_timer_get_time();
+  move_peak_pwm = 0;
+  move_faults = 0;
+  g_last_position_error = move_start_position - target_position;
 
   // Reset motion control timing
   last_motion_update_time = millis();
 
   // Activate motion control
   motion_active = true;
+  postEvent(EVENT_MOVE_STARTED);
+
+  MotionParams params;
+  uint32_t sequence;
+  read_motion_params(params, sequence);
+  dlog_i(LOG_MODULE_MOTION, "Starting motion to position %lld, max speed: %.2f, accel: %.2f",
+         position, params.max_speed, params.acceleration);
+  return true;
+}
 
-  log_i("Starting motion to position %lld, max speed: %.2f, accel: %.2f",
-              position, motion_max_speed, motion_acceleration);
+/**
+ * Ask the control loop to stop the current move at its next cycle
+ * Returns false if no move is in progress
+ */
+bool stop_motion() {
+  if (!motion_active) {
+    return false;
+  }
+  stop_requested = true;
+  return true;
 }
 
 /**
@@ -433,8 +699,11 @@ void move_to_position(int64_t position) {
  * Returns the target velocity at this point in time
  */
 float generate_trapezoidal_profile(int64_t current_position, int64_t target_position,
-                                  float current_velocity, float max_speed,
-                                  float acceleration, unsigned long dt_ms) {
+                                  float current_velocity, const MotionParams& params,
+                                  unsigned long dt_ms) {
+  const float max_speed = params.max_speed;
+  const float speed_step = params.acceleration_per_ms * dt_ms;
+
   // Calculate distance to target
   float distance_remaining = target_position - current_position;
   
@@ -443,19 +712,19 @@ float generate_trapezoidal_profile(int64_t current_position, int64_t target_posi
   distance_remaining = abs(distance_remaining);
   
   // Calculate the distance needed to decelerate to stop
-  float decel_distance = (current_velocity * current_velocity) / (1.0f * acceleration);
+  float decel_distance = current_velocity * current_velocity * params.inv_acceleration;
   
   float target_velocity;
   
   // Check if we need to start decelerating
   if (distance_remaining <= decel_distance) {
     // Deceleration phase
-    target_velocity = max(0.0f, abs(current_velocity) - (acceleration * dt_ms / 1000.0f));
+    target_velocity = max(0.0f, abs(current_velocity) - speed_step);
   } else {
     // Acceleration or constant velocity phase
     if (abs(current_velocity) < max_speed) {
       // Acceleration phase
-      target_velocity = min(max_speed, abs(current_velocity) + (acceleration * dt_ms / 1000.0f));
+      target_velocity = min(max_speed, abs(current_velocity) + speed_step);
     } else {
       // Constant velocity phase
       target_velocity = max_speed;
@@ -532,8 +801,13 @@ void disable_motors() {
   mcpwm_set_duty(MCPWM_UNIT, MCPWM_TIMER_M2, MCPWM_OPR_B, 0);
 }
 
-void IRAM_ATTR send_debug_data_timer(void* arg) {
-  sendDebugData();
+/**
+ * Debug streaming timer callback, also drives the status push channel
+ * Only posts events; JSON serialization and WebSocket I/O run in the dispatcher task
+ */
+void send_debug_data_timer(void* arg) {
+  postEvent(EVENT_DEBUG_TICK);
+  postEvent(EVENT_STATUS_TICK);
 }
 
 /**
@@ -542,35 +816,54 @@ void IRAM_ATTR send_debug_data_timer(void* arg) {
 void getMotionControlConfig(uint32_t& position_hysteresis, float& max_speed, float& acceleration,
                            float& vel_loop_p, float& vel_loop_i, float& vel_loop_d,
                            float& vel_filter_persistence, float& spd_err_persistence) {
-    position_hysteresis = motion_position_hysteresis;
-    max_speed = motion_max_speed;
-    acceleration = motion_acceleration;
-    vel_loop_p = motion_vel_loop_p;
-    vel_loop_i = motion_vel_loop_i;
-    vel_loop_d = motion_vel_loop_d;
-    vel_filter_persistence = motion_vel_filter_persistence;
-    spd_err_persistence = motion_spd_err_persistence;
+    MotionParams params;
+    uint32_t sequence;
+    read_motion_params(params, sequence);
+    position_hysteresis = (uint32_t)params.position_hysteresis;
+    max_speed = params.max_speed;
+    acceleration = params.acceleration;
+    vel_loop_p = params.vel_loop_p;
+    vel_loop_i = params.vel_loop_i;
+    vel_loop_d = params.vel_loop_d;
+    vel_filter_persistence = params.vel_filter_persistence;
+    spd_err_persistence = params.spd_err_persistence;
 }
 
 /**
  * Set motion control configuration
+ * Builds the complete parameter set first, then publishes it in one short critical
+ * section; the control loop switches over at its next tick
  */
 void setMotionControlConfig(uint32_t position_hysteresis, float max_speed, float acceleration,
                            float vel_loop_p, float vel_loop_i, float vel_loop_d,
                            float vel_filter_persistence, float spd_err_persistence) {
-    motion_position_hysteresis = position_hysteresis;
-    motion_max_speed = max_speed;
-    motion_acceleration = acceleration;
-    motion_vel_loop_p = vel_loop_p;
-    motion_vel_loop_i = vel_loop_i;
-    motion_vel_loop_d = vel_loop_d;
-    motion_vel_filter_persistence = vel_filter_persistence;
-    motion_spd_err_persistence = spd_err_persistence;
+    MotionParams params;
+    params.position_hysteresis = position_hysteresis;
+    params.max_speed = max_speed;
+    params.acceleration = acceleration;
+    params.vel_loop_p = vel_loop_p;
+    params.vel_loop_i = vel_loop_i;
+    params.vel_loop_d = vel_loop_d;
+    params.vel_filter_persistence = vel_filter_persistence;
+    params.spd_err_persistence = spd_err_persistence;
+    params.inv_acceleration = acceleration > 0 ? 1.0f / acceleration : 0.0f;
+    params.acceleration_per_ms = acceleration / 1000.0f;
+    params.vel_filter_gain = (1.0f - vel_filter_persistence) * 1000.0f;
+    params.spd_err_gain = (1.0f - spd_err_persistence) * 1000.0f;
+
+    // The critical section keeps the esp_timer task on this core from preempting a
+    // half-written set (it would spin on the odd sequence)
+    portENTER_CRITICAL(&params_lock);
+    params_sequence.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    published_params = params;
+    params_sequence.fetch_add(1, std::memory_order_release);
+    portEXIT_CRITICAL(&params_lock);
     
-    log_i("Motion control config updated: hysteresis=%u, max_speed=%.1f, accel=%.1f", 
-          position_hysteresis, max_speed, acceleration);
-    log_i("PID gains updated: P=%.2e, I=%.2e, D=%.2e", vel_loop_p, vel_loop_i, vel_loop_d);
-    log_i("Filter paramters updated: velocity filter =%.2f, speed error filter=%.2f", vel_filter_persistence, spd_err_persistence);
+    dlog_i(LOG_MODULE_MOTION, "Motion control config updated: hysteresis=%u, max_speed=%.1f, accel=%.1f",
+         position_hysteresis, max_speed, acceleration);
+    dlog_i(LOG_MODULE_MOTION, "PID gains updated: P=%.2e, I=%.2e, D=%.2e", vel_loop_p, vel_loop_i, vel_loop_d);
+    dlog_i(LOG_MODULE_MOTION, "Filter paramters updated: velocity filter =%.2f, speed error filter=%.2f", vel_filter_persistence, spd_err_persistence);
 }
 
 int64_t get_current_position() {
@@ -590,18 +883,38 @@ MotionControlInfo get_motion_control_info() {
 }
 
 /**
- * Set LED blink rate based on system state
- * @param interval_ms Blink interval in milliseconds (0 = solid on, -1 = solid off)
+ * Copy the summary of the last finished move (read from the EVENT_MOVE_COMPLETED handlers)
  */
-void setLEDBlinkRate(uint32_t interval_ms) {
-  esp_timer_stop(led_timer);
-  if (interval_ms > 0) {
-    esp_timer_start_periodic(led_timer, interval_ms * 1000); // Convert to microseconds
-  } else if (interval_ms == 0) {
-    digitalWrite(USER_LED_PIN, HIGH); // Solid on
-  } else {
-    digitalWrite(USER_LED_PIN, LOW);  // Solid off
+void get_last_move_summary(MoveSummary& summary) {
+  summary = last_move;
+}
+
+/**
+ * Set the user LED pattern; the LEDC peripheral generates it with no CPU involvement
+ * @param frequency_hz Blinks per second (0 = steady; RC_FAST with 14 bits reaches ~2 Hz reliably)
+ * @param duty_percent On-time per blink (steady: 0 = off, anything else = on)
+ */
+void setLEDBlink(uint32_t frequency_hz, uint8_t duty_percent) {
+  const uint32_t full_duty = 1 << USER_LED_LEDC_RESOLUTION;
+  uint32_t duty = duty_percent ? full_duty : 0;
+
+  if (frequency_hz > 0) {
+    // The slow RC_FAST clock is needed to divide down to a few Hz
+    ledc_timer_config_t timer_config = {};
+    timer_config.speed_mode = LEDC_LOW_SPEED_MODE;
+    timer_config.duty_resolution = (ledc_timer_bit_t)USER_LED_LEDC_RESOLUTION;
+    timer_config.timer_num = USER_LED_LEDC_TIMER;
+    timer_config.freq_hz = frequency_hz;
+    timer_config.clk_cfg = LEDC_USE_RTC8M_CLK;
+    if (ledc_timer_config(&timer_config) != ESP_OK) {
+      log_w("User LED: %u Hz not reachable", frequency_hz);
+      return;
+    }
+    duty = full_duty * min(duty_percent, (uint8_t)100) / 100;
   }
+
+  ledc_set_duty(LEDC_LOW_SPEED_MODE, USER_LED_LEDC_CHANNEL, duty);
+  ledc_update_duty(LEDC_LOW_SPEED_MODE, USER_LED_LEDC_CHANNEL);
 }
 
 /**
@@ -615,26 +928,26 @@ void updateLEDStatus() {
   if (currentState != lastState) {
     switch (currentState) {
       case SYSTEM_BOOTING:
-        setLEDBlinkRate(100); // Very fast blink
+        setLEDBlink(5, 50); // Very fast blink
         break;
       case SYSTEM_WIFI_AP_MODE:
-        setLEDBlinkRate(200); // Fast blink
+        setLEDBlink(2, 50); // Even blink
         break;
       case SYSTEM_WIFI_CONNECTING:
-        setLEDBlinkRate(500); // Medium blink
+        setLEDBlink(2, 80); // Mostly on, short gaps
         break;
       case SYSTEM_WIFI_CONNECTED:
-        setLEDBlinkRate(1000); // Slow blink
+        setLEDBlink(2, 5); // Short flash
         break;
       case SYSTEM_WIFI_FAILED:
-        setLEDBlinkRate(150); // Very fast blink
+        setLEDBlink(3, 50); // Fast blink
         break;
       case SYSTEM_ERROR:
-        setLEDBlinkRate(0); // Solid on
+        setLEDBlink(0, 100); // Solid on
         break;
     }
     lastState = currentState;
-    log_i("LED state changed to: %d", currentState);
+    dlog_i(LOG_MODULE_SYSTEM, "LED state changed to: %d", currentState);
   }
 }
 
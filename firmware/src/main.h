@@ -3,24 +3,61 @@
 
 #include <ESP32Encoder.h>
 
-// Timer configuration
-#define LED_BLINK_INTERVAL_MS 250
+// Timer configuration; every interval must be a multiple of CONTROL_TICK_MS
+#define CONTROL_TICK_MS 10               // Period of the one esp_timer that drives the schedule
 #define ENCODER_UPDATE_INTERVAL_MS 10
 #define MOTION_CONTROL_INTERVAL_MS 10
 #define AUTO_ROTATION_CHECK_INTERVAL_MS 1000
 #define DEBUG_SEND_INTERVAL_MS 100       // 10Hz debug data streaming
+#define DEBUG_SEND_TICK_PHASE 5          // Tick offsets of the sub-rate tasks, chosen so they
+#define AUTO_ROTATION_TICK_PHASE 3       // never fall on the same tick as each other
+
+// User LED, blinked by the LEDC peripheral
+#define USER_LED_LEDC_TIMER LEDC_TIMER_0
+#define USER_LED_LEDC_CHANNEL LEDC_CHANNEL_0
+#define USER_LED_LEDC_RESOLUTION 14      // Duty bits; the most the S3 has, for the lowest frequency
 #define MAX_MOTOR_PWM_DUTY_CYCLE 1.0f
 
+// Network startup task (runs alongside the motion setup in setup())
+#define NETWORK_STARTUP_PRIORITY 3       // Below the event dispatcher (5)
+#define NETWORK_STARTUP_STACK_SIZE 8192  // Same as the Arduino loop task that used to run it
+#define NETWORK_STARTUP_CORE 0           // With the WiFi stack; setup() runs on core 1
+#define SPIFFS_BLANK_CHECK_YIELD_BYTES 65536  // Blank-partition scan yields this often
+
 // System state enumeration
 enum SystemState {
-    SYSTEM_BOOTING,           // Very fast blink during startup
-    SYSTEM_WIFI_AP_MODE,      // Fast blink - looking for connection
-    SYSTEM_WIFI_CONNECTING,   // Medium blink - attempting connection
-    SYSTEM_WIFI_CONNECTED,    // Slow blink - connected and ready
-    SYSTEM_WIFI_FAILED,       // Very fast blink - connection failed
+    SYSTEM_BOOTING,           // 5 Hz blink during startup
+    SYSTEM_WIFI_AP_MODE,      // 2 Hz blink - looking for connection
+    SYSTEM_WIFI_CONNECTING,   // 2 Hz, mostly on - attempting connection
+    SYSTEM_WIFI_CONNECTED,    // 2 Hz short flash - connected and ready
+    SYSTEM_WIFI_FAILED,       // 3 Hz blink - connection failed
     SYSTEM_ERROR,             // Solid on - system error
 };
 
+// Outcome of a move, carried as the arg of EVENT_MOVE_COMPLETED
+enum MoveResult {
+    MOVE_RESULT_REACHED,      // Target reached within hysteresis
+    MOVE_RESULT_ABORTED,      // Stopped because the position error kept growing
+    MOVE_RESULT_STOPPED,      // Stopped on request (stop_motion())
+};
+
+// Fault bits in MoveSummary::faults
+enum MoveFault : uint8_t {
+    MOVE_FAULT_ERROR_GROWING = 0x01,  // Position error grew beyond hysteresis (move aborted)
+    MOVE_FAULT_PWM_SATURATED = 0x02,  // The velocity loop asked for more than full duty
+};
+
+// The last finished move; filled in by the control loop just before EVENT_MOVE_COMPLETED
+struct MoveSummary {
+    int64_t start_position;
+    int64_t target_position;
+    int64_t final_position;
+    uint32_t duration_ms;
+    float peak_pwm;           // Largest |duty| applied, 0..MAX_MOTOR_PWM_DUTY_CYCLE
+    uint8_t result;           // MoveResult
+    uint8_t faults;           // MoveFault bits
+};
+
 // Structure for motion control information
 struct MotionControlInfo {
     bool motion_active;
@@ -37,6 +74,17 @@ int64_t get_current_position();
 float get_encoder_velocity();
 bool is_motion_active(void);
 MotionControlInfo get_motion_control_info();
+void get_last_move_summary(MoveSummary& summary);
+
+// Outcome of the SPIFFS mount at startup
+enum SpiffsMountState {
+    SPIFFS_MOUNT_PENDING,     // setup_spiffs() has not run yet
+    SPIFFS_MOUNT_OK,
+    SPIFFS_MOUNT_FORMATTED,   // The partition was blank and has been formatted
+    SPIFFS_MOUNT_FAILED,      // Not mounted; the partition holds data, so it was left alone
+};
+
+SpiffsMountState get_spiffs_mount_state();
 
 // Motion control configuration functions
 void getMotionControlConfig(uint32_t& position_hysteresis, float& max_speed, float& acceleration,
@@ -48,12 +96,32 @@ void setMotionControlConfig(uint32_t position_hysteresis, float max_speed, float
 void setFullRevolutionCount(int32_t full_revolution);
 
 // Function prototypes
-void move_to_position(int64_t target_position);
+bool move_to_position(int64_t target_position);
+bool stop_motion();
 
 void reset_motor_control();
 
+// Control tick scheduler counters (see setup_scheduler())
+struct TickSchedulerStats {
+    uint32_t ticks;                     // Base tick wakeups since boot
+    uint32_t overruns;                  // Ticks whose tasks ran longer than CONTROL_TICK_MS
+    uint32_t max_tick_us;               // Longest tick, all tasks included
+};
+
+struct TickTaskStats {
+    const char* name;
+    uint16_t divisor;                   // Runs every divisor ticks...
+    uint16_t phase;                     // ...on the ticks where tick % divisor == phase
+    uint32_t runs;
+    uint32_t max_run_us;
+};
+
+void get_tick_scheduler_stats(TickSchedulerStats& stats);
+uint8_t get_tick_task_count();
+void get_tick_task_stats(uint8_t index, TickTaskStats& stats);
+
 // LED control functions
-void setLEDBlinkRate(uint32_t interval_ms);
+void setLEDBlink(uint32_t frequency_hz, uint8_t duty_percent);
 void updateLEDStatus();
 SystemState determineSystemState();
 
@@ -0,0 +1,487 @@
+#include "metrics.h"
+#include "main.h"
+#include "event_bus.h"
+#include "wifi_manager.h"
+#include "status_push.h"
+#include "debug_stream.h"
+#include "api_response.h"
+#include "http_trace.h"
+#include "boot_profile.h"
+#include "history.h"
+#include <WiFi.h>
+#include <esp_timer.h>
+#include <math.h>
+#include <stdarg.h>
+
+#define METRICS_CONTENT_TYPE "text/plain; version=0.0.4; charset=utf-8"
+
+// Counters written by the dispatcher task (moves) and the WiFi event task
+struct MetricsCounters {
+    uint32_t moves_started;
+    uint32_t moves_reached;
+    uint32_t moves_aborted;
+    uint32_t moves_stopped;
+    uint32_t wifi_disconnects;
+    uint32_t wifi_reconnects;
+};
+
+static MetricsCounters counters = {};
+static int64_t moveStartedUs = 0;
+static bool wifiConnected = false;
+static bool wifiEverConnected = false;
+
+// Histograms (bucket bounds fixed at build time)
+static const float moveDurationBounds[] = { 0.25f, 0.5f, 1, 2, 4, 8, 16, 32 };                 // seconds
+static const float positionErrorBounds[] = { 1, 2, 5, 10, 20, 50, 100, 200 };                   // counts
+static const float loopJitterBounds[] = { 50, 100, 250, 500, 1000, 2500, 5000, 10000 };         // microseconds
+
+// Sums are 64-bit, so readers on the other core could see half an update without this
+static portMUX_TYPE histogramSumLock = portMUX_INITIALIZER_UNLOCKED;
+
+#define HISTOGRAM_BOUNDS(bounds) bounds, sizeof(bounds) / sizeof(bounds[0])
+
+static MetricsHistogram moveDuration = { HISTOGRAM_BOUNDS(moveDurationBounds) };
+static MetricsHistogram finalPositionError = { HISTOGRAM_BOUNDS(positionErrorBounds) };
+static MetricsHistogram controlLoopJitter = { HISTOGRAM_BOUNDS(loopJitterBounds) };
+
+/**
+ * Count a value into its bucket
+ */
+void observeHistogram(MetricsHistogram& histogram, float value) {
+    uint8_t bucket = 0;
+    while (bucket < histogram.bucket_count && value > histogram.bounds[bucket]) {
+        bucket++;
+    }
+    histogram.counts[bucket]++;
+    histogram.count++;
+    portENTER_CRITICAL(&histogramSumLock);
+    histogram.sum += value;
+    portEXIT_CRITICAL(&histogramSumLock);
+}
+
+/**
+ * Read a histogram's sum without tearing
+ */
+double getHistogramSum(const MetricsHistogram& histogram) {
+    portENTER_CRITICAL(&histogramSumLock);
+    double sum = histogram.sum;
+    portEXIT_CRITICAL(&histogramSumLock);
+    return sum;
+}
+
+/**
+ * Estimate a quantile (0..1) by interpolating inside the bucket that holds it
+ * Values in the +Inf bucket are reported as the largest finite bound
+ */
+float estimateHistogramQuantile(const MetricsHistogram& histogram, float quantile) {
+    if (histogram.count == 0) {
+        return 0;
+    }
+
+    float rank = quantile * histogram.count;
+    uint32_t cumulative = 0;
+    for (uint8_t i = 0; i < histogram.bucket_count; i++) {
+        uint32_t inBucket = histogram.counts[i];
+        if (inBucket && cumulative + inBucket >= rank) {
+            float lower = i == 0 ? 0 : histogram.bounds[i - 1];
+            return lower + (histogram.bounds[i] - lower) * (rank - cumulative) / inBucket;
+        }
+        cumulative += inBucket;
+    }
+    return histogram.bucket_count ? histogram.bounds[histogram.bucket_count - 1] : 0;
+}
+
+/**
+ * Record the period of the control tick; called at the start of every tick
+ * Jitter is the distance from the nominal CONTROL_TICK_MS period
+ */
+void recordControlLoopTick() {
+    static int64_t lastTickUs = 0;
+    int64_t now = esp_timer_get_time();
+
+    if (lastTickUs != 0) {
+        int64_t jitter = (now - lastTickUs) - CONTROL_TICK_MS * 1000;
+        observeHistogram(controlLoopJitter, (float)(jitter < 0 ? -jitter : jitter));
+    }
+    lastTickUs = now;
+}
+
+static void countMoveStarted(const Event& event) {
+    counters.moves_started++;
+    moveStartedUs = event.posted_us;
+}
+
+static void countMoveCompleted(const Event& event) {
+    switch (event.arg) {
+        case MOVE_RESULT_REACHED:
+            counters.moves_reached++;
+            break;
+        case MOVE_RESULT_ABORTED:
+            counters.moves_aborted++;
+            break;
+        case MOVE_RESULT_STOPPED:
+            counters.moves_stopped++;
+            break;
+    }
+
+    if (moveStartedUs != 0) {
+        observeHistogram(moveDuration, (event.posted_us - moveStartedUs) / 1e6f);
+        moveStartedUs = 0;
+    }
+
+    // Where the motor actually came to rest, relative to the target it was asked for
+    if (event.arg == MOVE_RESULT_REACHED) {
+        MotionControlInfo motionInfo = get_motion_control_info();
+        int64_t error = get_current_position() - motionInfo.target_position;
+        observeHistogram(finalPositionError, (float)(error < 0 ? -error : error));
+    }
+}
+
+static void onMetricsWiFiEvent(arduino_event_id_t event, arduino_event_info_t info) {
+    if (event == ARDUINO_EVENT_WIFI_STA_GOT_IP) {
+        if (wifiEverConnected) {
+            counters.wifi_reconnects++;
+        }
+        wifiConnected = true;
+        wifiEverConnected = true;
+    } else if (event == ARDUINO_EVENT_WIFI_STA_DISCONNECTED && wifiConnected) {
+        // Retries while disconnected report this event again; count the link loss once
+        counters.wifi_disconnects++;
+        wifiConnected = false;
+    }
+}
+
+// Single-valued metrics, read at scrape time
+struct ScalarMetric {
+    const char* name;                   // Family name, optionally followed by {labels}
+    const char* help;                   // NULL for further series of the previous family
+    const char* type;
+    double (*read)();                   // NAN omits the sample
+};
+
+static const ScalarMetric scalarMetrics[] = {
+    { "rotator_uptime_seconds", "Time since boot", "gauge",
+      []() -> double { return esp_timer_get_time() / 1e6; } },
+    { "rotator_position_counts", "Encoder position", "gauge",
+      []() -> double { return (double)get_current_position(); } },
+    { "rotator_motion_active", "1 while a move is running", "gauge",
+      []() -> double { return is_motion_active() ? 1 : 0; } },
+    { "rotator_moves_started_total", "Moves accepted by the motion controller", "counter",
+      []() -> double { return counters.moves_started; } },
+    { "rotator_moves_completed_total{result=\"reached\"}", "Moves ended, by outcome (aborted = position error kept growing)", "counter",
+      []() -> double { return counters.moves_reached; } },
+    { "rotator_moves_completed_total{result=\"aborted\"}", NULL, NULL,
+      []() -> double { return counters.moves_aborted; } },
+    { "rotator_moves_completed_total{result=\"stopped\"}", NULL, NULL,
+      []() -> double { return counters.moves_stopped; } },
+    { "rotator_heap_free_bytes", "Free internal heap", "gauge",
+      []() -> double { return ESP.getFreeHeap(); } },
+    { "rotator_heap_min_free_bytes", "Lowest free internal heap since boot", "gauge",
+      []() -> double { return ESP.getMinFreeHeap(); } },
+    { "rotator_psram_free_bytes", "Free PSRAM", "gauge",
+      []() -> double { return ESP.getFreePsram(); } },
+    { "rotator_psram_min_free_bytes", "Lowest free PSRAM since boot", "gauge",
+      []() -> double { return ESP.getMinFreePsram(); } },
+    { "rotator_wifi_rssi_dbm", "Station signal strength (absent when not connected)", "gauge",
+      []() -> double { return WiFi.isConnected() ? WiFi.RSSI() : NAN; } },
+    { "rotator_wifi_disconnects_total", "Station connections lost", "counter",
+      []() -> double { return counters.wifi_disconnects; } },
+    { "rotator_wifi_reconnects_total", "Station connections re-established", "counter",
+      []() -> double { return counters.wifi_reconnects; } },
+    { "rotator_wifi_boot_to_online_seconds", "Time from boot to the first station IP (absent until online)", "gauge",
+      []() -> double { WiFiConnectStats stats; getWiFiConnectStats(stats); return stats.boot_to_online_ms >= 0 ? stats.boot_to_online_ms / 1e3 : NAN; } },
+    { "rotator_wifi_last_connect_seconds", "Duration of the last station connection attempt", "gauge",
+      []() -> double { WiFiConnectStats stats; getWiFiConnectStats(stats); return stats.last_connect_ms / 1e3; } },
+    { "rotator_wifi_cached_connect_failures_total", "Cached BSSID connection attempts that fell back to a scan", "counter",
+      []() -> double { WiFiConnectStats stats; getWiFiConnectStats(stats); return stats.cached_failures; } },
+    { "rotator_boot_motor_ready_seconds", "Time from boot until the control loop was running", "gauge",
+      []() -> double { int64_t at_us = getBootMilestoneUs(BOOT_MILESTONE_MOTOR_READY); return at_us >= 0 ? at_us / 1e6 : NAN; } },
+    { "rotator_boot_network_ready_seconds", "Time from boot until WiFi and the web server were up", "gauge",
+      []() -> double { int64_t at_us = getBootMilestoneUs(BOOT_MILESTONE_NETWORK_READY); return at_us >= 0 ? at_us / 1e6 : NAN; } },
+    { "rotator_tick_wakeups_total", "Control tick timer wakeups (the only periodic esp_timer)", "counter",
+      []() -> double { TickSchedulerStats stats; get_tick_scheduler_stats(stats); return stats.ticks; } },
+    { "rotator_tick_overruns_total", "Control ticks whose tasks ran longer than the tick period", "counter",
+      []() -> double { TickSchedulerStats stats; get_tick_scheduler_stats(stats); return stats.overruns; } },
+    { "rotator_tick_max_run_seconds", "Longest control tick since boot, all scheduled tasks included", "gauge",
+      []() -> double { TickSchedulerStats stats; get_tick_scheduler_stats(stats); return stats.max_tick_us / 1e6; } },
+    { "rotator_history_records", "Moves stored in the on-flash history", "gauge",
+      []() -> double { HistoryStats stats; getHistoryStats(stats); return stats.records; } },
+    { "rotator_history_write_failures_total", "Move history appends that failed", "counter",
+      []() -> double { HistoryStats stats; getHistoryStats(stats); return stats.write_failures; } },
+    { "rotator_history_dropped_total", "Finished moves not recorded because the writer queue was full", "counter",
+      []() -> double { HistoryStats stats; getHistoryStats(stats); return stats.dropped; } },
+    { "rotator_config_save_requests_total", "Configuration changes queued for saving", "counter",
+      []() -> double { ConfigStoreStats stats; getConfigStoreStats(stats); return stats.save_requests; } },
+    { "rotator_config_flushes_total", "Configuration records written to flash", "counter",
+      []() -> double { ConfigStoreStats stats; getConfigStoreStats(stats); return stats.flushes; } },
+    { "rotator_config_flush_failures_total", "Configuration writes that failed", "counter",
+      []() -> double { ConfigStoreStats stats; getConfigStoreStats(stats); return stats.failures; } },
+    { "rotator_config_last_flush_seconds", "Duration of the last configuration write", "gauge",
+      []() -> double { ConfigStoreStats stats; getConfigStoreStats(stats); return stats.last_flush_us / 1e6; } },
+    { "rotator_websocket_clients{socket=\"status\"}", "Connected WebSocket clients", "gauge",
+      []() -> double { return statusWebSocket.count(); } },
+    { "rotator_websocket_clients{socket=\"debug\"}", NULL, NULL,
+      []() -> double { return debugWebSocket.count(); } },
+    { "rotator_debug_frames_sent_total", "Debug stream frames queued to clients", "counter",
+      []() -> double { uint32_t sent, dropped; getDebugStreamTotals(sent, dropped); return sent; } },
+    { "rotator_debug_frames_dropped_total", "Debug stream frames skipped for congested clients", "counter",
+      []() -> double { uint32_t sent, dropped; getDebugStreamTotals(sent, dropped); return dropped; } },
+    { "rotator_events_dropped_total", "Events lost because the dispatcher queue was full", "counter",
+      []() -> double {
+          EventBusStats stats;
+          getEventBusStats(stats);
+          uint32_t dropped = 0;
+          for (int i = 0; i < EVENT_TYPE_COUNT; i++) {
+              dropped += stats.types[i].dropped;
+          }
+          return dropped;
+      } },
+    { "rotator_http_pool_exhausted_total", "API requests answered 503 because every JSON buffer was in use", "counter",
+      []() -> double { JsonResponsePoolStats stats; getJsonResponsePoolStats(stats); return stats.exhausted; } },
+};
+
+#define SCALAR_METRIC_COUNT (sizeof(scalarMetrics) / sizeof(scalarMetrics[0]))
+
+struct HistogramMetric {
+    const char* name;
+    const char* help;
+    const MetricsHistogram* histogram;
+};
+
+static const HistogramMetric histogramMetrics[] = {
+    { "rotator_move_duration_seconds", "Time from move start to completion", &moveDuration },
+    { "rotator_move_final_error_counts", "Distance from the target when a move reached it", &finalPositionError },
+    { "rotator_control_loop_jitter_microseconds", "Deviation of the control tick period from nominal", &controlLoopJitter },
+};
+
+#define HISTOGRAM_METRIC_COUNT (sizeof(histogramMetrics) / sizeof(histogramMetrics[0]))
+
+// Position of the renderer in the exposition
+enum MetricsSection : uint8_t {
+    SECTION_SCALARS,
+    SECTION_HISTOGRAMS,
+    SECTION_ROUTES,
+    SECTION_ROUTE_DURATIONS,
+    SECTION_DONE
+};
+
+struct MetricsCursor {
+    MetricsSection section;
+    uint8_t item;
+    uint8_t step;
+};
+
+/**
+ * snprintf that appends at length and never runs past size
+ */
+static void appendf(char* line, size_t size, size_t& length, const char* format, ...) {
+    if (length >= size - 1) {
+        return;
+    }
+    va_list args;
+    va_start(args, format);
+    int written = vsnprintf(line + length, size - length, format, args);
+    va_end(args);
+    if (written > 0) {
+        length += min((size_t)written, size - 1 - length);
+    }
+}
+
+static void appendHeader(char* line, size_t size, size_t& length, const char* name, const char* help, const char* type) {
+    int familyLength = strcspn(name, "{");
+    appendf(line, size, length, "# HELP %.*s %s\n# TYPE %.*s %s\n", familyLength, name, help, familyLength, name, type);
+}
+
+static void appendValue(char* line, size_t size, size_t& length, double value) {
+    if (value == (double)(int64_t)value) {
+        appendf(line, size, length, " %lld\n", (long long)value);
+    } else {
+        appendf(line, size, length, " %.6g\n", value);
+    }
+}
+
+/**
+ * Render one histogram line: header, a cumulative bucket, the sum or the count
+ */
+static bool renderHistogramStep(const HistogramMetric& metric, uint8_t step, char* line, size_t size, size_t& length) {
+    const MetricsHistogram& histogram = *metric.histogram;
+
+    if (step == 0) {
+        appendHeader(line, size, length, metric.name, metric.help, "histogram");
+    } else if (step <= histogram.bucket_count + 1) {
+        uint8_t bucket = step - 1;
+        uint32_t cumulative = 0;
+        for (uint8_t i = 0; i <= bucket; i++) {
+            cumulative += histogram.counts[i];
+        }
+        if (bucket < histogram.bucket_count) {
+            appendf(line, size, length, "%s_bucket{le=\"%g\"} %u\n", metric.name, histogram.bounds[bucket], cumulative);
+        } else {
+            appendf(line, size, length, "%s_bucket{le=\"+Inf\"} %u\n", metric.name, cumulative);
+        }
+    } else if (step == histogram.bucket_count + 2) {
+        appendf(line, size, length, "%s_sum %.15g\n", metric.name, getHistogramSum(histogram));
+    } else if (step == histogram.bucket_count + 3) {
+        appendf(line, size, length, "%s_count %u\n", metric.name, histogram.count);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+static void renderRouteResponses(const HttpRouteStats& route, char* line, size_t size, size_t& length) {
+    for (int i = 0; i < 5; i++) {
+        if (route.responses[i]) {
+            appendf(line, size, length, "rotator_http_requests_total{route=\"%s\",code=\"%dxx\"} %u\n",
+                    route.route, i + 1, route.responses[i]);
+        }
+    }
+}
+
+static void renderRouteDuration(const HttpRouteStats& route, char* line, size_t size, size_t& length) {
+    if (route.total_ms.count) {
+        appendf(line, size, length, "rotator_http_request_duration_seconds_sum{route=\"%s\"} %.15g\n",
+                route.route, getHistogramSum(route.total_ms) / 1000.0);
+        appendf(line, size, length, "rotator_http_request_duration_seconds_count{route=\"%s\"} %u\n",
+                route.route, route.total_ms.count);
+    }
+}
+
+/**
+ * Render the next piece of the exposition into line; returns 0 at the end
+ */
+static size_t renderNextLine(MetricsCursor& cursor, char* line, size_t size) {
+    size_t length = 0;
+
+    while (length == 0 && cursor.section != SECTION_DONE) {
+        switch (cursor.section) {
+            case SECTION_SCALARS: {
+                if (cursor.item >= SCALAR_METRIC_COUNT) {
+                    cursor.section = SECTION_HISTOGRAMS;
+                    cursor.item = 0;
+                    break;
+                }
+                const ScalarMetric& metric = scalarMetrics[cursor.item++];
+                if (metric.help) {
+                    appendHeader(line, size, length, metric.name, metric.help, metric.type);
+                }
+                double value = metric.read();
+                if (!isnan(value)) {
+                    appendf(line, size, length, "%s", metric.name);
+                    appendValue(line, size, length, value);
+                }
+                break;
+            }
+
+            case SECTION_HISTOGRAMS:
+                if (cursor.item >= HISTOGRAM_METRIC_COUNT) {
+                    cursor.section = SECTION_ROUTES;
+                    cursor.item = 0;
+                    cursor.step = 0;
+                    break;
+                }
+                if (renderHistogramStep(histogramMetrics[cursor.item], cursor.step, line, size, length)) {
+                    cursor.step++;
+                } else {
+                    cursor.item++;
+                    cursor.step = 0;
+                }
+                break;
+
+            case SECTION_ROUTES:
+            case SECTION_ROUTE_DURATIONS: {
+                // Item 0 is the header, then one item per route, the last being the overflow slot
+                bool responses = (cursor.section == SECTION_ROUTES);
+                if (cursor.item == 0) {
+                    if (responses) {
+                        appendHeader(line, size, length, "rotator_http_requests_total",
+                                     "HTTP responses by path and status class", "counter");
+                    } else {
+                        appendHeader(line, size, length, "rotator_http_request_duration_seconds",
+                                     "Time from request headers to the connection closing after the response", "summary");
+                    }
+                } else if (cursor.item <= getHttpRouteCount() + 1) {
+                    const HttpRouteStats* route = getHttpRoute(cursor.item - 1);
+                    if (route && responses) {
+                        renderRouteResponses(*route, line, size, length);
+                    } else if (route) {
+                        renderRouteDuration(*route, line, size, length);
+                    }
+                } else {
+                    cursor.section = responses ? SECTION_ROUTE_DURATIONS : SECTION_DONE;
+                    cursor.item = 0;
+                    break;
+                }
+                cursor.item++;
+                break;
+            }
+
+            case SECTION_DONE:
+                break;
+        }
+    }
+    return length;
+}
+
+/**
+ * Streams the exposition straight from the live counters, one line group at a time,
+ * so a scrape needs no buffer beyond the response object itself
+ */
+class MetricsResponse : public AsyncAbstractResponse {
+public:
+    MetricsResponse(bool chunked) : _cursor{ SECTION_SCALARS, 0, 0 }, _lineLength(0), _lineOffset(0) {
+        _code = 200;
+        _contentType = METRICS_CONTENT_TYPE;
+        _sendContentLength = false;
+        _chunked = chunked;             // HTTP/1.0 clients read until the connection closes
+    }
+
+    bool _sourceValid() const override {
+        return true;
+    }
+
+    size_t _fillBuffer(uint8_t* buf, size_t maxLen) override {
+        size_t written = 0;
+        while (written < maxLen) {
+            if (_lineOffset == _lineLength) {
+                _lineLength = renderNextLine(_cursor, _line, sizeof(_line));
+                _lineOffset = 0;
+                if (_lineLength == 0) {
+                    break;
+                }
+            }
+            size_t count = min(_lineLength - _lineOffset, maxLen - written);
+            memcpy(buf + written, _line + _lineOffset, count);
+            _lineOffset += count;
+            written += count;
+        }
+        return written;
+    }
+
+private:
+    MetricsCursor _cursor;
+    char _line[METRICS_LINE_SIZE];
+    size_t _lineLength;
+    size_t _lineOffset;
+};
+
+/**
+ * Register /metrics and the move/WiFi event hooks
+ * Must be called before webServer.begin()
+ */
+void setupMetrics() {
+    wifiConnected = WiFi.isConnected();
+    wifiEverConnected = wifiConnected;
+    WiFi.onEvent(onMetricsWiFiEvent, ARDUINO_EVENT_WIFI_STA_GOT_IP);
+    WiFi.onEvent(onMetricsWiFiEvent, ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+
+    registerEventHandler(EVENT_MOVE_STARTED, countMoveStarted);
+    registerEventHandler(EVENT_MOVE_COMPLETED, countMoveCompleted);
+
+    // Prometheus text exposition format
+    webServer.on("/metrics", HTTP_GET, [](AsyncWebServerRequest *request) {
+        request->send(new MetricsResponse(request->version() != 0));
+    });
+
+    log_i("Metrics setup complete");
+}
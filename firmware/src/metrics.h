@@ -0,0 +1,26 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <Arduino.h>
+
+// Metrics configuration
+#define METRICS_MAX_BUCKETS 10          // Finite histogram buckets (+Inf is implicit)
+#define METRICS_LINE_SIZE 512           // Longest rendered piece of the exposition (one HELP/TYPE/sample group)
+
+// Fixed-bucket histogram; counts are per bucket (not cumulative), counts[bucket_count] is +Inf
+struct MetricsHistogram {
+    const float* bounds;                // Upper bounds, ascending
+    uint8_t bucket_count;
+    uint32_t counts[METRICS_MAX_BUCKETS + 1];
+    uint32_t count;
+    double sum;                         // double: 100 observations/s would stall a float within days
+};
+
+// Function prototypes
+void setupMetrics();
+void observeHistogram(MetricsHistogram& histogram, float value);
+double getHistogramSum(const MetricsHistogram& histogram);
+void recordControlLoopTick();
+float estimateHistogramQuantile(const MetricsHistogram& histogram, float quantile);
+
+#endif // METRICS_H
@@ -1,38 +1,203 @@
 #include "neopixel.h"
+#include "main.h"
+#include "rotator.h"
+#include <driver/rmt.h>
 
-// Create NeoPixel instance - 1 pixel on specified pin
-Adafruit_NeoPixel neopixel(1, NEOPIX_PIN, NEO_GRB + NEO_KHZ800);
+// WS2812 bit timing in RMT ticks (APB 80 MHz / 2 = 25 ns)
+#define WS2812_RMT_CLK_DIV 2
+#define WS2812_T0H 16                   // 0.40 us
+#define WS2812_T0L 34                   // 0.85 us
+#define WS2812_T1H 32                   // 0.80 us
+#define WS2812_T1L 18                   // 0.45 us
+
+enum NeoPixelMode : uint8_t {
+    NEOPIXEL_SOLID,
+    NEOPIXEL_FADE,
+    NEOPIXEL_BLINK
+};
+
+// Latest request from setNeoPixelColor()/fadeNeoPixelTo()/blinkNeoPixel(); a newer one replaces it
+struct NeoPixelCommand {
+    NeoPixelMode mode;
+    uint32_t color;
+    uint32_t duration_ms;               // Fade time or blink period
+};
+
+static QueueHandle_t commandMailbox = NULL;
+static volatile uint8_t brightness = NEOPIXEL_DEFAULT_BRIGHTNESS;
+static volatile bool redraw = false;
+
+// Read by the RMT driver while a frame is going out, so it must outlive rmt_write_items()
+static rmt_item32_t frameItems[24];
+
+static uint8_t channel(uint32_t color, int shift) {
+    return (color >> shift) & 0xFF;
+}
+
+/**
+ * Mix two 0xRRGGBB colours; weight 0 gives from, 256 gives to
+ */
+uint32_t blendColor(uint32_t from, uint32_t to, uint32_t weight) {
+    uint32_t result = 0;
+    for (int shift = 0; shift <= 16; shift += 8) {
+        int32_t a = channel(from, shift);
+        int32_t b = channel(to, shift);
+        result |= (uint32_t)(a + (b - a) * (int32_t)weight / 256) << shift;
+    }
+    return result;
+}
 
 /**
- * Initialize the NeoPixel
+ * Hand one pixel to the RMT peripheral and return; the transfer takes ~30 us in hardware
+ */
+static void sendFrame(uint32_t color) {
+    uint32_t scale = brightness + 1;
+    uint8_t grb[3] = {
+        (uint8_t)(channel(color, 8) * scale >> 8),
+        (uint8_t)(channel(color, 16) * scale >> 8),
+        (uint8_t)(channel(color, 0) * scale >> 8),
+    };
+
+    // Frames are 20 ms apart, so the previous one has long finished
+    if (rmt_wait_tx_done(NEOPIXEL_RMT_CHANNEL, 0) != ESP_OK) {
+        return;
+    }
+
+    for (int i = 0; i < 24; i++) {
+        bool one = grb[i / 8] & (0x80 >> (i % 8));
+        frameItems[i].level0 = 1;
+        frameItems[i].duration0 = one ? WS2812_T1H : WS2812_T0H;
+        frameItems[i].level1 = 0;
+        frameItems[i].duration1 = one ? WS2812_T1L : WS2812_T0L;
+    }
+    rmt_write_items(NEOPIXEL_RMT_CHANNEL, frameItems, 24, false);
+}
+
+/**
+ * Animation task: evaluates the current animation once per frame and sends only changed colours
+ * While a move runs, the colour follows the live angle between the configured position colours;
+ * when it ends, the pixel fades to the resting colour (or blinks it if the move was aborted)
+ */
+static void neoPixelTask(void* arg) {
+    NeoPixelCommand animation = { NEOPIXEL_SOLID, 0, 0 };
+    uint32_t fromColor = 0;
+    uint32_t startMs = millis();
+    uint32_t shownColor = 0;
+    bool tracking = false;
+    bool shownValid = false;
+
+    TickType_t lastWake = xTaskGetTickCount();
+    for (;;) {
+        vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(NEOPIXEL_FRAME_MS));
+        uint32_t now = millis();
+
+        NeoPixelCommand command;
+        if (xQueueReceive(commandMailbox, &command, 0) == pdTRUE) {
+            animation = command;
+            fromColor = shownColor;
+            startMs = now;
+        }
+
+        uint32_t color;
+        if (is_motion_active() && config.full_rotation_count > 0) {
+            tracking = true;
+            color = getColorForAngle(positionToAngle(get_current_position()));
+        } else {
+            if (tracking) {
+                // Move finished: settle on the colour of the position it ended at
+                MoveSummary move;
+                get_last_move_summary(move);
+                uint32_t resting = getColorForNearestAngle(positionToAngle(move.final_position));
+                if (move.result == MOVE_RESULT_ABORTED) {
+                    animation = { NEOPIXEL_BLINK, resting, NEOPIXEL_FAULT_BLINK_MS };
+                } else {
+                    animation = { NEOPIXEL_FADE, resting, NEOPIXEL_FADE_MS };
+                }
+                fromColor = shownColor;
+                startMs = now;
+                tracking = false;
+            }
+
+            uint32_t elapsed = now - startMs;
+            switch (animation.mode) {
+                case NEOPIXEL_FADE:
+                    color = elapsed >= animation.duration_ms ? animation.color :
+                            blendColor(fromColor, animation.color, elapsed * 256 / animation.duration_ms);
+                    break;
+                case NEOPIXEL_BLINK:
+                    color = (elapsed % animation.duration_ms) < animation.duration_ms / 2 ? animation.color : 0;
+                    break;
+                case NEOPIXEL_SOLID:
+                default:
+                    color = animation.color;
+                    break;
+            }
+        }
+
+        if (!shownValid || color != shownColor || redraw) {
+            redraw = false;
+            sendFrame(color);
+            shownColor = color;
+            shownValid = true;
+        }
+    }
+}
+
+static void postCommand(NeoPixelMode mode, uint32_t color, uint32_t duration_ms) {
+    NeoPixelCommand command = { mode, color & 0xFFFFFF, max(duration_ms, (uint32_t)1) };
+    if (commandMailbox) {
+        xQueueOverwrite(commandMailbox, &command);
+    }
+}
+
+/**
+ * Initialize the RMT channel and start the animation task
  */
 void setupNeoPixel() {
-    neopixel.begin();
-    neopixel.setBrightness(50); // Set to 50% brightness
-    neopixel.clear();
-    neopixel.show();
-    log_i("NeoPixel initialized");
+    rmt_config_t rmtConfig = RMT_DEFAULT_CONFIG_TX((gpio_num_t)NEOPIX_PIN, NEOPIXEL_RMT_CHANNEL);
+    rmtConfig.clk_div = WS2812_RMT_CLK_DIV;
+    ESP_ERROR_CHECK(rmt_config(&rmtConfig));
+    ESP_ERROR_CHECK(rmt_driver_install(NEOPIXEL_RMT_CHANNEL, 0, 0));
+
+    commandMailbox = xQueueCreate(1, sizeof(NeoPixelCommand));
+    xTaskCreatePinnedToCore(neoPixelTask, "neopixel", NEOPIXEL_TASK_STACK_SIZE,
+                            NULL, NEOPIXEL_TASK_PRIORITY, NULL, NEOPIXEL_TASK_CORE);
+    log_i("NeoPixel initialized (RMT channel %d, %d fps)", NEOPIXEL_RMT_CHANNEL, 1000 / NEOPIXEL_FRAME_MS);
 }
 
 /**
- * Set the NeoPixel color using a 32-bit packed color value
+ * Show a 24-bit 0xRRGGBB colour from the next frame on
+ * Never blocks; the animation task does the output
  */
 void setNeoPixelColor(uint32_t color) {
-    neopixel.setPixelColor(0, color);
-    neopixel.show();
+    postCommand(NEOPIXEL_SOLID, color, 0);
+}
+
+/**
+ * Fade from the colour shown now to color over duration_ms
+ */
+void fadeNeoPixelTo(uint32_t color, uint32_t duration_ms) {
+    postCommand(NEOPIXEL_FADE, color, duration_ms);
+}
+
+/**
+ * Blink color on and off with the given period
+ */
+void blinkNeoPixel(uint32_t color, uint32_t period_ms) {
+    postCommand(NEOPIXEL_BLINK, color, period_ms);
 }
 
 /**
  * Set the NeoPixel brightness (0-255)
  */
-void setNeoPixelBrightness(uint8_t brightness) {
-    neopixel.setBrightness(brightness);
-    neopixel.show();
+void setNeoPixelBrightness(uint8_t level) {
+    brightness = level;
+    redraw = true;
 }
 
 /**
  * Convert RGB values to a 32-bit packed color value
  */
 uint32_t convertRGB(uint8_t r, uint8_t g, uint8_t b) {
-    return neopixel.Color(r, g, b);
-} 
\ No newline at end of file
+    return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+}
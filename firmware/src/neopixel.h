@@ -2,19 +2,28 @@
 #define NEOPIXEL_H
 
 #include <Arduino.h>
-#include <Adafruit_NeoPixel.h>
 #include "config.h"
 
 // Pin definitions
 #define NEOPIX_PIN 13
 
+// NeoPixel driver and animation configuration
+#define NEOPIXEL_RMT_CHANNEL RMT_CHANNEL_0
+#define NEOPIXEL_DEFAULT_BRIGHTNESS 50      // 0-255
+#define NEOPIXEL_FRAME_MS 20                // 50 fps animation task
+#define NEOPIXEL_FADE_MS 400                // Fade to the resting colour after a move
+#define NEOPIXEL_FAULT_BLINK_MS 500         // Blink period after an aborted move
+#define NEOPIXEL_TASK_PRIORITY 1            // Below everything but idle; never delays the control loop
+#define NEOPIXEL_TASK_STACK_SIZE 3072
+#define NEOPIXEL_TASK_CORE 1                // Away from the esp_timer task (core 0)
+
 // Function prototypes
 void setupNeoPixel();
 void setNeoPixelColor(uint32_t color);
+void fadeNeoPixelTo(uint32_t color, uint32_t duration_ms);
+void blinkNeoPixel(uint32_t color, uint32_t period_ms);
 void setNeoPixelBrightness(uint8_t brightness);
 uint32_t convertRGB(uint8_t r, uint8_t g, uint8_t b);
+uint32_t blendColor(uint32_t from, uint32_t to, uint32_t weight);
 
-// Global NeoPixel instance
-extern Adafruit_NeoPixel neopixel;
-
-#endif // NEOPIXEL_H 
\ No newline at end of file
+#endif // NEOPIXEL_H
@@ -0,0 +1,300 @@
+#include "ota_delta.h"
+#include "ota_update.h"
+#include <esp_ota_ops.h>
+#include <mbedtls/sha256.h>
+#include <esp32s3/rom/miniz.h>
+
+// Patch application state; lives in PSRAM for the duration of one upload
+struct DeltaSession {
+    tinfl_decompressor inflator;
+    uint8_t dictionary[TINFL_LZ_DICT_SIZE];  // Inflate output window (circular)
+    size_t dictionary_offset;
+    bool stream_done;
+
+    uint8_t header[DELTA_HEADER_SIZE];
+    size_t header_length;
+    uint32_t old_size;
+    uint32_t new_size;
+    uint32_t produced;
+
+    uint8_t op[9];              // Op header being collected
+    size_t op_length;
+    uint32_t op_remaining;      // Payload bytes left in the current op
+    uint32_t old_offset;        // Next running-image byte for ADD
+
+    uint8_t old_chunk[DELTA_OLD_CHUNK_SIZE];
+};
+
+static DeltaSession* session = NULL;
+static const esp_partition_t* runningPartition = NULL;
+
+// SHA-256 of the running image, computed once per size (the running image never changes)
+static uint8_t runningHash[32];
+static uint32_t runningHashSize = 0;
+
+static uint32_t readLE32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/**
+ * Hash the first size bytes of the running partition
+ */
+static bool hashRunningImage(uint32_t size, uint8_t* digest) {
+    if (runningHashSize == size) {
+        memcpy(digest, runningHash, sizeof(runningHash));
+        return true;
+    }
+
+    mbedtls_sha256_context sha;
+    mbedtls_sha256_init(&sha);
+    mbedtls_sha256_starts(&sha, 0);
+
+    for (uint32_t offset = 0; offset < size; offset += DELTA_OLD_CHUNK_SIZE) {
+        size_t count = min((uint32_t)DELTA_OLD_CHUNK_SIZE, size - offset);
+        if (esp_partition_read(runningPartition, offset, session->old_chunk, count) != ESP_OK) {
+            mbedtls_sha256_free(&sha);
+            return false;
+        }
+        mbedtls_sha256_update(&sha, session->old_chunk, count);
+    }
+
+    mbedtls_sha256_finish(&sha, digest);
+    mbedtls_sha256_free(&sha);
+
+    memcpy(runningHash, digest, sizeof(runningHash));
+    runningHashSize = size;
+    return true;
+}
+
+/**
+ * Validate the patch header against the running image and open the OTA session
+ */
+static bool applyHeader(const char** error) {
+    const uint8_t* header = session->header;
+
+    if (memcmp(header, DELTA_MAGIC, 4) != 0) {
+        *error = "Not a delta patch";
+        return false;
+    }
+    if ((header[4] | (header[5] << 8)) != DELTA_VERSION) {
+        *error = "Unsupported delta patch version";
+        return false;
+    }
+
+    session->old_size = readLE32(header + 8);
+    session->new_size = readLE32(header + 12);
+    const uint8_t* oldHash = header + 16;
+    const uint8_t* newHash = header + 48;
+
+    if (session->old_size > runningPartition->size) {
+        *error = "Patch does not match running firmware";
+        return false;
+    }
+
+    uint8_t digest[32];
+    if (!hashRunningImage(session->old_size, digest)) {
+        *error = "Failed to read running firmware";
+        return false;
+    }
+    if (memcmp(digest, oldHash, sizeof(digest)) != 0) {
+        *error = "Patch does not match running firmware";
+        return false;
+    }
+
+    // The reconstructed image is checked against the new image's digest
+    char newHashHex[65];
+    for (int i = 0; i < 32; i++) {
+        sprintf(newHashHex + i * 2, "%02x", newHash[i]);
+    }
+
+    log_i("Applying delta patch: %u -> %u bytes", session->old_size, session->new_size);
+    return otaBegin(session->new_size, newHashHex, error);
+}
+
+/**
+ * Run inflated patch bytes through the op decoder, writing new image bytes to the OTA pipeline
+ */
+static bool applyOps(const uint8_t* data, size_t len, const char** error) {
+    while (len > 0) {
+        if (session->op_remaining == 0) {
+            // Collect the op header
+            session->op[session->op_length++] = *data++;
+            len--;
+
+            uint8_t type = session->op[0];
+            size_t headerSize;
+            if (type == DELTA_OP_ADD) {
+                headerSize = 9;
+            } else if (type == DELTA_OP_INSERT) {
+                headerSize = 5;
+            } else {
+                *error = "Corrupt delta patch";
+                return false;
+            }
+            if (session->op_length < headerSize) {
+                continue;
+            }
+
+            session->op_remaining = readLE32(session->op + 1);
+            session->op_length = 0;
+
+            if (session->op_remaining > session->new_size - session->produced) {
+                *error = "Delta patch overruns new image";
+                return false;
+            }
+            if (type == DELTA_OP_ADD) {
+                session->old_offset = readLE32(session->op + 5);
+                if (session->old_offset > session->old_size ||
+                    session->op_remaining > session->old_size - session->old_offset) {
+                    *error = "Delta patch reads past running image";
+                    return false;
+                }
+            }
+            continue;
+        }
+
+        size_t count = min((size_t)session->op_remaining, min(len, (size_t)DELTA_OLD_CHUNK_SIZE));
+        const uint8_t* output = data;
+
+        if (session->op[0] == DELTA_OP_ADD) {
+            if (esp_partition_read(runningPartition, session->old_offset, session->old_chunk, count) != ESP_OK) {
+                *error = "Failed to read running firmware";
+                return false;
+            }
+            for (size_t i = 0; i < count; i++) {
+                session->old_chunk[i] += data[i];
+            }
+            session->old_offset += count;
+            output = session->old_chunk;
+        }
+
+        if (!otaWrite(output, count)) {
+            *error = "Flash write failed";
+            return false;
+        }
+
+        session->produced += count;
+        session->op_remaining -= count;
+        data += count;
+        len -= count;
+    }
+    return true;
+}
+
+/**
+ * Inflate compressed patch bytes through the circular dictionary
+ */
+static bool inflatePatch(const uint8_t* data, size_t len, const char** error) {
+    while (!session->stream_done) {
+        size_t inBytes = len;
+        size_t outBytes = TINFL_LZ_DICT_SIZE - session->dictionary_offset;
+        uint8_t* out = session->dictionary + session->dictionary_offset;
+
+        tinfl_status status = tinfl_decompress(&session->inflator, data, &inBytes,
+                                               session->dictionary, out, &outBytes,
+                                               TINFL_FLAG_PARSE_ZLIB_HEADER | TINFL_FLAG_HAS_MORE_INPUT);
+        data += inBytes;
+        len -= inBytes;
+
+        if (outBytes > 0) {
+            if (!applyOps(out, outBytes, error)) {
+                return false;
+            }
+            session->dictionary_offset = (session->dictionary_offset + outBytes) & (TINFL_LZ_DICT_SIZE - 1);
+        }
+
+        if (status < TINFL_STATUS_DONE) {
+            *error = "Corrupt delta patch";
+            return false;
+        }
+        if (status == TINFL_STATUS_DONE) {
+            session->stream_done = true;
+        } else if (status == TINFL_STATUS_NEEDS_MORE_INPUT && len == 0) {
+            break;
+        }
+    }
+
+    if (session->stream_done && len > 0) {
+        *error = "Trailing data after delta patch";
+        return false;
+    }
+    return true;
+}
+
+static void releaseDeltaSession() {
+    free(session);
+    session = NULL;
+}
+
+static bool beginDelta(AsyncWebServerRequest *request, const char** error) {
+    releaseDeltaSession();
+
+    runningPartition = esp_ota_get_running_partition();
+    if (!runningPartition) {
+        *error = "No running partition";
+        return false;
+    }
+
+    session = static_cast<DeltaSession*>(psramFound() ? ps_malloc(sizeof(DeltaSession)) : malloc(sizeof(DeltaSession)));
+    if (!session) {
+        *error = "Out of memory";
+        return false;
+    }
+    tinfl_init(&session->inflator);
+    session->dictionary_offset = 0;
+    session->stream_done = false;
+    session->header_length = 0;
+    session->old_size = 0;
+    session->new_size = 0;
+    session->produced = 0;
+    session->op_length = 0;
+    session->op_remaining = 0;
+    return true;
+}
+
+static bool writeDelta(const uint8_t* data, size_t len, const char** error) {
+    if (session->header_length < DELTA_HEADER_SIZE) {
+        size_t count = min(len, DELTA_HEADER_SIZE - session->header_length);
+        memcpy(session->header + session->header_length, data, count);
+        session->header_length += count;
+        data += count;
+        len -= count;
+
+        if (session->header_length == DELTA_HEADER_SIZE && !applyHeader(error)) {
+            return false;
+        }
+    }
+
+    if (len == 0) {
+        return true;
+    }
+    return inflatePatch(data, len, error);
+}
+
+static bool finishDelta(const char** error) {
+    bool complete = session->header_length == DELTA_HEADER_SIZE && session->stream_done &&
+                    session->produced == session->new_size &&
+                    session->op_remaining == 0 && session->op_length == 0;
+    releaseDeltaSession();
+
+    if (!complete) {
+        *error = "Delta patch truncated";
+        return false;
+    }
+    return otaFinish(error);
+}
+
+static const OtaUploadFormat deltaUpload = {
+    beginDelta,
+    writeDelta,
+    finishDelta,
+    releaseDeltaSession
+};
+
+/**
+ * Register the delta patch endpoint on the OTA pipeline
+ */
+void setupDeltaOTA() {
+    registerOtaUpload("/update/delta", &deltaUpload);
+    log_i("Delta OTA handler setup complete");
+}
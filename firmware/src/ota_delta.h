@@ -0,0 +1,17 @@
+#ifndef OTA_DELTA_H
+#define OTA_DELTA_H
+
+#include <Arduino.h>
+
+// Delta patch format (see tools/make_delta.py)
+#define DELTA_MAGIC "RDLT"
+#define DELTA_VERSION 1
+#define DELTA_HEADER_SIZE 80        // magic, version, flags, old/new size, old/new SHA-256
+#define DELTA_OP_ADD 1              // u32 length, u32 old offset, then length diff bytes
+#define DELTA_OP_INSERT 2           // u32 length, then length literal bytes
+#define DELTA_OLD_CHUNK_SIZE 1024   // Running-image bytes read per step when applying ADD
+
+// Function prototypes
+void setupDeltaOTA();
+
+#endif // OTA_DELTA_H
@@ -0,0 +1,683 @@
+#include "ota_update.h"
+#include "event_bus.h"
+#include "api_response.h"
+#include "wifi_manager.h"
+#include "main.h"
+#include <esp_ota_ops.h>
+#include <esp_timer.h>
+#include <mbedtls/sha256.h>
+
+bool otaInProgress = false;
+
+// A filled sector buffer handed to the writer task
+// A chunk with last set (data may be NULL) marks the end of the stream
+struct OtaChunk {
+    uint8_t* data;
+    uint16_t length;
+    bool last;
+};
+
+// Writer pipeline: the receiver fills buffers from freeBuffers and queues them on
+// filledBuffers; the writer task hashes and flashes them, then returns them
+static QueueHandle_t freeBuffers = NULL;
+static QueueHandle_t filledBuffers = NULL;
+static SemaphoreHandle_t writerDone = NULL;
+static uint8_t* sectorBuffers[OTA_BUFFER_COUNT] = {};
+
+// Session state (receiver side, async_tcp task)
+static esp_ota_handle_t otaHandle = 0;
+static const esp_partition_t* otaPartition = NULL;
+static uint8_t* fillBuffer = NULL;
+static size_t fillLength = 0;
+static uint8_t expectedHash[32];
+static bool hashExpected = false;
+
+// Writer side; only read by the receiver after the writer has drained
+static mbedtls_sha256_context shaContext;
+static volatile bool writeFailed = false;
+static esp_err_t writeError = ESP_OK;
+
+// Status shared with the dispatcher (progress push) and HTTP handlers
+static portMUX_TYPE statusLock = portMUX_INITIALIZER_UNLOCKED;
+static OtaStatus currentStatus = { OTA_IDLE, 0, 0, false, NULL };
+
+// Upload currently feeding the pipeline
+static AsyncWebServerRequest* otaOwner = NULL;
+static bool uploadFailed = false;
+static bool uploadFinished = false;
+
+static esp_timer_handle_t restartTimer = NULL;
+
+static const char* const otaStateNames[] = {
+    "idle",
+    "receiving",
+    "verifying",
+    "success",
+    "failed",
+};
+
+/**
+ * Update the shared status and announce the change
+ */
+static void setOtaState(OtaState state, const char* error) {
+    portENTER_CRITICAL(&statusLock);
+    currentStatus.state = state;
+    currentStatus.error = error;
+    portEXIT_CRITICAL(&statusLock);
+
+    postEvent(EVENT_OTA_PROGRESS, state);
+}
+
+/**
+ * Writer task: hashes and flashes each sector while the receiver fills the next one
+ */
+static void otaWriterTask(void* arg) {
+    OtaChunk chunk;
+    uint32_t nextProgress = OTA_PROGRESS_STEP;
+
+    for (;;) {
+        xQueueReceive(filledBuffers, &chunk, portMAX_DELAY);
+
+        if (chunk.length > 0 && !writeFailed) {
+            mbedtls_sha256_update(&shaContext, chunk.data, chunk.length);
+
+            // Sequential-write mode erases each sector just before it is written
+            esp_err_t err = esp_ota_write(otaHandle, chunk.data, chunk.length);
+            if (err != ESP_OK) {
+                writeError = err;
+                writeFailed = true;
+            } else {
+                portENTER_CRITICAL(&statusLock);
+                currentStatus.written += chunk.length;
+                uint32_t written = currentStatus.written;
+                portEXIT_CRITICAL(&statusLock);
+
+                if (written >= nextProgress) {
+                    postEvent(EVENT_OTA_PROGRESS, OTA_RECEIVING);
+                    nextProgress = written + OTA_PROGRESS_STEP;
+                }
+            }
+        }
+
+        if (chunk.data) {
+            xQueueSend(freeBuffers, &chunk.data, 0);
+        }
+        if (chunk.last) {
+            nextProgress = OTA_PROGRESS_STEP;
+            xSemaphoreGive(writerDone);
+        }
+    }
+}
+
+/**
+ * Queue an end-of-stream marker and wait for the writer to finish everything before it
+ */
+static bool drainWriter() {
+    OtaChunk marker = { fillBuffer, (uint16_t)fillLength, true };
+    fillBuffer = NULL;
+    fillLength = 0;
+
+    if (xQueueSend(filledBuffers, &marker, pdMS_TO_TICKS(OTA_BUFFER_TIMEOUT_MS)) != pdTRUE) {
+        return false;
+    }
+    return xSemaphoreTake(writerDone, pdMS_TO_TICKS(OTA_BUFFER_TIMEOUT_MS)) == pdTRUE;
+}
+
+/**
+ * Release the sector buffers once the writer is idle
+ */
+static void freeSectorBuffers() {
+    xQueueReset(freeBuffers);
+    for (int i = 0; i < OTA_BUFFER_COUNT; i++) {
+        free(sectorBuffers[i]);
+        sectorBuffers[i] = NULL;
+    }
+}
+
+/**
+ * Parse a 64-character hex SHA-256 digest
+ */
+static bool parseSha256Hex(const char* hex, uint8_t* digest) {
+    if (!hex || strlen(hex) != 64) {
+        return false;
+    }
+
+    for (int i = 0; i < 32; i++) {
+        uint8_t byte = 0;
+        for (int j = 0; j < 2; j++) {
+            char c = hex[i * 2 + j];
+            byte <<= 4;
+            if (c >= '0' && c <= '9') {
+                byte |= c - '0';
+            } else if (c >= 'a' && c <= 'f') {
+                byte |= c - 'a' + 10;
+            } else if (c >= 'A' && c <= 'F') {
+                byte |= c - 'A' + 10;
+            } else {
+                return false;
+            }
+        }
+        digest[i] = byte;
+    }
+    return true;
+}
+
+/**
+ * Start an update session into the inactive app partition
+ * total_size is only used for progress reporting (0 if unknown)
+ */
+bool otaBegin(uint32_t total_size, const char* expected_sha256_hex, const char** error) {
+    if (otaInProgress) {
+        *error = "Update already in progress";
+        return false;
+    }
+
+    hashExpected = expected_sha256_hex && expected_sha256_hex[0];
+    if (hashExpected && !parseSha256Hex(expected_sha256_hex, expectedHash)) {
+        *error = "Invalid SHA-256 digest";
+        return false;
+    }
+    if (OTA_REQUIRE_SHA256 && !hashExpected) {
+        *error = "Missing " OTA_SHA256_HEADER " header";
+        return false;
+    }
+
+    otaPartition = esp_ota_get_next_update_partition(NULL);
+    if (!otaPartition) {
+        *error = "No OTA partition available";
+        return false;
+    }
+    if (total_size > otaPartition->size) {
+        *error = "Firmware too large for OTA partition";
+        return false;
+    }
+
+    for (int i = 0; i < OTA_BUFFER_COUNT; i++) {
+        sectorBuffers[i] = (uint8_t*)heap_caps_malloc(OTA_SECTOR_SIZE, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if (!sectorBuffers[i]) {
+            freeSectorBuffers();
+            *error = "Out of memory";
+            return false;
+        }
+    }
+
+    esp_err_t err = esp_ota_begin(otaPartition, OTA_WITH_SEQUENTIAL_WRITES, &otaHandle);
+    if (err != ESP_OK) {
+        log_e("esp_ota_begin failed: %s", esp_err_to_name(err));
+        freeSectorBuffers();
+        *error = "OTA begin failed";
+        return false;
+    }
+
+    xQueueReset(freeBuffers);
+    xQueueReset(filledBuffers);
+    xSemaphoreTake(writerDone, 0);
+    for (int i = 0; i < OTA_BUFFER_COUNT; i++) {
+        xQueueSend(freeBuffers, &sectorBuffers[i], 0);
+    }
+    xQueueReceive(freeBuffers, &fillBuffer, 0);
+    fillLength = 0;
+
+    mbedtls_sha256_init(&shaContext);
+    mbedtls_sha256_starts(&shaContext, 0);
+    writeFailed = false;
+    writeError = ESP_OK;
+
+    portENTER_CRITICAL(&statusLock);
+    currentStatus.written = 0;
+    currentStatus.total = total_size;
+    currentStatus.hash_verified = false;
+    portEXIT_CRITICAL(&statusLock);
+
+    otaInProgress = true;
+    setOtaState(OTA_RECEIVING, NULL);
+
+    log_i("OTA update started into %s (%u bytes expected)", otaPartition->label, total_size);
+    return true;
+}
+
+/**
+ * Append received data, handing each full sector to the writer task
+ * Blocks only when every sector buffer is waiting to be flashed
+ */
+bool otaWrite(const uint8_t* data, size_t len) {
+    if (!otaInProgress) {
+        return false;
+    }
+
+    while (len > 0) {
+        if (writeFailed) {
+            log_e("OTA flash write failed: %s", esp_err_to_name(writeError));
+            otaAbort("Flash write failed");
+            return false;
+        }
+
+        size_t count = min(len, (size_t)(OTA_SECTOR_SIZE - fillLength));
+        memcpy(fillBuffer + fillLength, data, count);
+        fillLength += count;
+        data += count;
+        len -= count;
+
+        if (fillLength == OTA_SECTOR_SIZE) {
+            OtaChunk chunk = { fillBuffer, OTA_SECTOR_SIZE, false };
+            fillBuffer = NULL;
+            fillLength = 0;
+            xQueueSend(filledBuffers, &chunk, portMAX_DELAY);
+
+            if (xQueueReceive(freeBuffers, &fillBuffer, pdMS_TO_TICKS(OTA_BUFFER_TIMEOUT_MS)) != pdTRUE) {
+                otaAbort("Flash writer stalled");
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * Flush the last partial sector, verify the image and its digest, and select it for boot
+ */
+bool otaFinish(const char** error) {
+    if (!otaInProgress) {
+        *error = "No update in progress";
+        return false;
+    }
+
+    setOtaState(OTA_VERIFYING, NULL);
+
+    if (!drainWriter()) {
+        otaAbort("Flash writer stalled");
+        *error = "Flash writer stalled";
+        return false;
+    }
+    freeSectorBuffers();
+
+    if (writeFailed) {
+        log_e("OTA flash write failed: %s", esp_err_to_name(writeError));
+        otaAbort("Flash write failed");
+        *error = "Flash write failed";
+        return false;
+    }
+
+    uint8_t digest[32];
+    mbedtls_sha256_finish(&shaContext, digest);
+    mbedtls_sha256_free(&shaContext);
+
+    if (hashExpected && memcmp(digest, expectedHash, sizeof(digest)) != 0) {
+        otaAbort("SHA-256 mismatch");
+        *error = "SHA-256 mismatch";
+        return false;
+    }
+
+    // Validates the image header, segments and appended checksum
+    esp_err_t err = esp_ota_end(otaHandle);
+    otaHandle = 0;
+    if (err != ESP_OK) {
+        log_e("esp_ota_end failed: %s", esp_err_to_name(err));
+        *error = (err == ESP_ERR_OTA_VALIDATE_FAILED) ? "Image validation failed" : "OTA end failed";
+        otaInProgress = false;
+        setOtaState(OTA_FAILED, *error);
+        return false;
+    }
+
+    err = esp_ota_set_boot_partition(otaPartition);
+    if (err != ESP_OK) {
+        log_e("esp_ota_set_boot_partition failed: %s", esp_err_to_name(err));
+        *error = "Failed to select boot partition";
+        otaInProgress = false;
+        setOtaState(OTA_FAILED, *error);
+        return false;
+    }
+
+    portENTER_CRITICAL(&statusLock);
+    currentStatus.hash_verified = hashExpected;
+    uint32_t written = currentStatus.written;
+    portEXIT_CRITICAL(&statusLock);
+
+    otaInProgress = false;
+    setOtaState(OTA_SUCCESS, NULL);
+    log_i("OTA update successful: %u bytes written to %s%s", written, otaPartition->label,
+          hashExpected ? ", SHA-256 verified" : "");
+    return true;
+}
+
+/**
+ * Abandon the current session; the inactive partition is left unbootable
+ * Safe to call when no update is running
+ */
+void otaAbort(const char* reason) {
+    if (!otaInProgress) {
+        return;
+    }
+
+    log_e("OTA update aborted: %s", reason);
+
+    // The writer must be idle before the handle is released
+    if (drainWriter()) {
+        freeSectorBuffers();
+        mbedtls_sha256_free(&shaContext);
+        if (otaHandle) {
+            esp_ota_abort(otaHandle);
+            otaHandle = 0;
+        }
+    } else {
+        log_e("OTA writer did not drain; leaking update handle");
+    }
+
+    otaInProgress = false;
+    setOtaState(OTA_FAILED, reason);
+}
+
+/**
+ * Snapshot the current (or last) update session
+ */
+void getOtaStatus(OtaStatus& status) {
+    portENTER_CRITICAL(&statusLock);
+    status = currentStatus;
+    portEXIT_CRITICAL(&statusLock);
+}
+
+/**
+ * Get a printable name for an OTA state
+ */
+const char* otaStateName(OtaState state) {
+    if (state > OTA_FAILED) {
+        return "unknown";
+    }
+    return otaStateNames[state];
+}
+
+static void restartTimerCallback(void* arg) {
+    esp_restart();
+}
+
+/**
+ * Restart the device after a delay without blocking the caller
+ */
+void scheduleRestart(uint32_t delay_ms) {
+    if (!restartTimer) {
+        esp_timer_create_args_t restart_timer_config = {};
+        restart_timer_config.callback = &restartTimerCallback;
+        restart_timer_config.name = "restart_timer";
+        ESP_ERROR_CHECK(esp_timer_create(&restart_timer_config, &restartTimer));
+    }
+
+    esp_timer_stop(restartTimer);
+    esp_timer_start_once(restartTimer, (uint64_t)delay_ms * 1000);
+    log_i("Restarting in %u ms", delay_ms);
+}
+
+/**
+ * Forget the previous session's outcome before a new upload starts
+ */
+static void resetOtaStatus() {
+    portENTER_CRITICAL(&statusLock);
+    currentStatus = { OTA_IDLE, 0, 0, false, NULL };
+    portEXIT_CRITICAL(&statusLock);
+}
+
+/**
+ * Abandon the owner's upload and record why, unless a lower layer already did
+ */
+static void failUpload(const OtaUploadFormat* format, const char* error) {
+    uploadFailed = true;
+    if (format->cleanup) {
+        format->cleanup();
+    }
+
+    if (otaInProgress) {
+        otaAbort(error);
+        return;
+    }
+
+    OtaStatus status;
+    getOtaStatus(status);
+    if (status.state != OTA_FAILED) {
+        log_e("OTA update failed: %s", error);
+        setOtaState(OTA_FAILED, error);
+    }
+}
+
+/**
+ * Feed one chunk of an upload to its format; the first upload to arrive owns the pipeline
+ */
+static void handleUploadChunk(const OtaUploadFormat* format, AsyncWebServerRequest *request, const String& filename, size_t index, uint8_t *data, size_t len, bool final) {
+    if (!index) {
+        if (otaOwner || otaInProgress) {
+            log_w("Rejecting OTA upload: update already in progress");
+            return;
+        }
+
+        otaOwner = request;
+        uploadFailed = false;
+        uploadFinished = false;
+        resetOtaStatus();
+
+        request->onDisconnect([request, format]() {
+            if (otaOwner == request) {
+                otaOwner = NULL;
+                if (!uploadFailed && !uploadFinished) {
+                    failUpload(format, "Client disconnected");
+                }
+            }
+        });
+
+        log_i("OTA upload started: %s on %s", filename.c_str(), request->url().c_str());
+        const char* error = NULL;
+        if (!format->begin(request, &error)) {
+            failUpload(format, error);
+            return;
+        }
+    }
+
+    // Ignore the rest of a rejected or failed upload
+    if (request != otaOwner || uploadFailed) {
+        return;
+    }
+
+    const char* error = NULL;
+    if (len && !format->write(data, len, &error)) {
+        failUpload(format, error);
+        return;
+    }
+
+    if (final) {
+        if (!format->finish(&error)) {
+            failUpload(format, error);
+            return;
+        }
+        uploadFinished = true;
+
+        // Leaves time for the response below to go out
+        scheduleRestart(OTA_REBOOT_DELAY_MS);
+    }
+}
+
+/**
+ * Report the outcome once the upload body has been consumed
+ */
+static void handleUploadRequest(const OtaUploadFormat* format, AsyncWebServerRequest *request) {
+    if (request != otaOwner) {
+        if (otaOwner || otaInProgress) {
+            sendText(request, 409, "Update already in progress");
+        } else {
+            sendText(request, 400, "No firmware uploaded");
+        }
+        return;
+    }
+    otaOwner = NULL;
+
+    // Body ended without a final chunk
+    if (!uploadFailed && !uploadFinished) {
+        failUpload(format, "Upload incomplete");
+    }
+
+    OtaStatus status;
+    getOtaStatus(status);
+
+    if (status.state == OTA_SUCCESS) {
+        AsyncWebServerResponse *response = request->beginResponse(200, "text/plain", "Update complete, rebooting...");
+        response->addHeader("Connection", "close");
+        request->send(response);
+    } else {
+        sendText(request, 400, status.error ? status.error : "Update failed");
+    }
+}
+
+/**
+ * Register an upload endpoint that streams through the OTA pipeline
+ */
+void registerOtaUpload(const char* uri, const OtaUploadFormat* format) {
+    webServer.on(uri, HTTP_POST,
+        [format](AsyncWebServerRequest *request) {
+            handleUploadRequest(format, request);
+        },
+        [format](AsyncWebServerRequest *request, const String& filename, size_t index, uint8_t *data, size_t len, bool final) {
+            handleUploadChunk(format, request, filename, index, data, len, final);
+        }
+    );
+}
+
+/**
+ * Full image upload: the digest and size come from request headers
+ */
+static bool beginFullImage(AsyncWebServerRequest *request, const char** error) {
+    const char* expectedSha = NULL;
+    if (request->hasHeader(OTA_SHA256_HEADER)) {
+        expectedSha = request->getHeader(OTA_SHA256_HEADER)->value().c_str();
+    } else {
+        expectedSha = getParamValue(request, "sha256", false);
+    }
+
+    uint32_t totalSize = 0;
+    if (request->hasHeader(OTA_SIZE_HEADER)) {
+        totalSize = strtoul(request->getHeader(OTA_SIZE_HEADER)->value().c_str(), NULL, 10);
+    }
+
+    return otaBegin(totalSize, expectedSha, error);
+}
+
+static bool writeFullImage(const uint8_t* data, size_t len, const char** error) {
+    if (!otaWrite(data, len)) {
+        *error = "Flash write failed";
+        return false;
+    }
+    return true;
+}
+
+static const OtaUploadFormat fullImageUpload = {
+    beginFullImage,
+    writeFullImage,
+    otaFinish,
+    NULL
+};
+
+/**
+ * Handle GET request for OTA status and partition information
+ */
+static void handleOtaStatus(AsyncWebServerRequest *request) {
+    JsonResponseSlot *slot = beginJsonResponse(request);
+    if (!slot) return;
+    JsonDocument &doc = slot->doc;
+
+    OtaStatus status;
+    getOtaStatus(status);
+
+    doc["state"] = otaStateName(status.state);
+    doc["written"] = status.written;
+    doc["total"] = status.total;
+    doc["hashVerified"] = status.hash_verified;
+    if (status.error) {
+        doc["error"] = status.error;
+    }
+
+    const esp_partition_t* running = esp_ota_get_running_partition();
+    const esp_partition_t* next = esp_ota_get_next_update_partition(NULL);
+    doc["runningPartition"] = running ? running->label : "";
+    doc["nextPartition"] = next ? next->label : "";
+
+    esp_ota_img_states_t imageState;
+    if (running && esp_ota_get_state_partition(running, &imageState) == ESP_OK) {
+        doc["pendingVerify"] = (imageState == ESP_OTA_IMG_PENDING_VERIFY);
+    }
+
+    sendJsonSlot(request, slot);
+}
+
+/**
+ * Setup the OTA writer task and HTTP handlers
+ */
+void setupOTA() {
+    freeBuffers = xQueueCreate(OTA_BUFFER_COUNT, sizeof(uint8_t*));
+    filledBuffers = xQueueCreate(OTA_BUFFER_COUNT + 1, sizeof(OtaChunk));
+    writerDone = xSemaphoreCreateBinary();
+
+    xTaskCreatePinnedToCore(otaWriterTask, "ota_writer", OTA_WRITER_STACK_SIZE,
+                            NULL, OTA_WRITER_PRIORITY, NULL, OTA_WRITER_CORE);
+
+    registerOtaUpload("/update", &fullImageUpload);
+    webServer.on("/api/ota/status", HTTP_GET, handleOtaStatus);
+
+#ifndef CONFIG_BOOTLOADER_APP_ROLLBACK_ENABLE
+    log_w("Bootloader rollback is disabled; a faulty update will not be reverted automatically");
+#endif
+
+    log_i("OTA update handler setup complete");
+}
+
+/**
+ * Keep a freshly updated image in the pending-verify state until the self-test runs
+ * (overrides the weak Arduino core hook, which would otherwise mark it valid at boot)
+ */
+extern "C" bool verifyRollbackLater() {
+    return true;
+}
+
+/**
+ * Boot self-test for an image that has not been confirmed yet
+ * Returns a failure description, or NULL if the image looks healthy
+ */
+static const char* runBootSelfTest() {
+    // Not fatal: setup_spiffs() leaves a partition holding data unmounted after a failed
+    // mount, which may be transient, and the previous image would see the same flash
+    if (get_spiffs_mount_state() == SPIFFS_MOUNT_FAILED) {
+        log_w("Self-test: SPIFFS not mounted, move history is disabled");
+    }
+
+    WiFiState wifiState = getWiFiState();
+    if (wifiState == WIFI_CONNECTION_FAILED || wifiState == WIFI_DISCONNECTED) {
+        return "WiFi failed to start";
+    }
+
+    if (ESP.getFreeHeap() < OTA_SELF_TEST_MIN_FREE_HEAP) {
+        return "Free heap below minimum";
+    }
+
+    return NULL;
+}
+
+/**
+ * Confirm or roll back the running image after an update
+ * Call once startup has finished; a crash before this point also rolls back,
+ * since the bootloader abandons images that reboot while pending verification
+ */
+void confirmRunningFirmware() {
+    const esp_partition_t* running = esp_ota_get_running_partition();
+    esp_ota_img_states_t imageState;
+
+    if (esp_ota_get_state_partition(running, &imageState) != ESP_OK ||
+        imageState != ESP_OTA_IMG_PENDING_VERIFY) {
+        return;
+    }
+
+    log_i("Firmware in %s is pending verification, running self-test", running->label);
+
+    const char* failure = runBootSelfTest();
+    if (failure) {
+        log_e("Self-test failed (%s), rolling back to previous firmware", failure);
+        esp_ota_mark_app_invalid_rollback_and_reboot();
+        return;
+    }
+
+    esp_ota_mark_app_valid_cancel_rollback();
+    log_i("Self-test passed, firmware in %s confirmed", running->label);
+}
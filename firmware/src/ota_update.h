@@ -0,0 +1,64 @@
+#ifndef OTA_UPDATE_H
+#define OTA_UPDATE_H
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+
+// OTA write pipeline configuration
+#define OTA_SECTOR_SIZE 4096              // Flash sector size; incoming data is coalesced into whole sectors
+#define OTA_BUFFER_COUNT 4                // Sector buffers in flight between the receiver and the writer task
+#define OTA_WRITER_PRIORITY 6             // Above the event dispatcher, below async_tcp
+#define OTA_WRITER_STACK_SIZE 4096
+#define OTA_WRITER_CORE 1
+#define OTA_BUFFER_TIMEOUT_MS 5000        // Give up if the writer does not free a buffer in time
+#define OTA_PROGRESS_STEP 65536           // Bytes written between progress events
+#define OTA_REBOOT_DELAY_MS 1000          // Time for the HTTP response to flush before restarting
+#define OTA_REQUIRE_SHA256 1              // Reject uploads that do not carry an expected SHA-256
+#define OTA_SELF_TEST_MIN_FREE_HEAP 32768 // Boot self-test fails below this much free heap
+
+// Client-supplied integrity and size hints for /update
+#define OTA_SHA256_HEADER "X-Firmware-SHA256"
+#define OTA_SIZE_HEADER "X-Firmware-Size"
+
+enum OtaState : uint8_t {
+    OTA_IDLE,
+    OTA_RECEIVING,
+    OTA_VERIFYING,
+    OTA_SUCCESS,
+    OTA_FAILED
+};
+
+// Snapshot of the current (or last) update session
+struct OtaStatus {
+    OtaState state;
+    uint32_t written;      // Bytes written to flash so far
+    uint32_t total;        // Expected image size, 0 if unknown
+    bool hash_verified;    // SHA-256 matched the client-supplied digest
+    const char* error;     // Static failure description, NULL if none
+};
+
+// An upload format accepted on an OTA endpoint (full image, delta patch)
+// Hooks run in the async_tcp task and report failures as a static string in *error
+struct OtaUploadFormat {
+    bool (*begin)(AsyncWebServerRequest* request, const char** error);
+    bool (*write)(const uint8_t* data, size_t len, const char** error);
+    bool (*finish)(const char** error);
+    void (*cleanup)();  // Optional; releases format state after a failure
+};
+
+// Function prototypes
+void setupOTA();
+void confirmRunningFirmware();
+bool otaBegin(uint32_t total_size, const char* expected_sha256_hex, const char** error);
+bool otaWrite(const uint8_t* data, size_t len);
+bool otaFinish(const char** error);
+void otaAbort(const char* reason);
+void getOtaStatus(OtaStatus& status);
+const char* otaStateName(OtaState state);
+void scheduleRestart(uint32_t delay_ms);
+void registerOtaUpload(const char* uri, const OtaUploadFormat* format);
+
+// External declarations
+extern bool otaInProgress;
+
+#endif // OTA_UPDATE_H
@@ -1,6 +1,8 @@
 #include "rotator.h"
 #include "neopixel.h"
 #include "main.h"
+#include "event_bus.h"
+#include "deferred_log.h"
 
 
 // Global rotator state
@@ -15,6 +17,11 @@ void setupRotator() {
     // Initialize the rotation timer
     last_rotation_time = millis();
 
+    // Auto-rotation checks are posted by the timer and handled in the dispatcher task
+    registerEventHandler(EVENT_AUTO_ROTATION_TICK, [](const Event& event) {
+        processAutoRotation();
+    });
+
     // Set initial color based on current position
     int currentAngle = positionToAngle(get_current_position());
     setNeoPixelForAngle(currentAngle);
@@ -127,8 +134,9 @@ int64_t calculateCircularDistance(int64_t count, int64_t target_pos) {
 /**
  * Rotate to a specific angle (0, 90, 180, 270 degrees)
  * Takes the shortest path to the target angle
+ * Returns false if a move is already in progress
  */
-void rotateToAngle(int angle) {
+bool rotateToAngle(int angle) {
     int64_t currentPosition = get_current_position();
 
     // Convert target angle to position offset
@@ -140,17 +148,18 @@ void rotateToAngle(int angle) {
     // Final target = current position + shortest distance
     int64_t finalTarget = currentPosition + distance;
 
-    log_i("Rotating to %d°, encoder: %lld -> %lld (distance: %lld)",
-          angle, currentPosition, finalTarget, distance);
+    dlog_i(LOG_MODULE_MOTION, "Rotating to %d°, encoder: %lld -> %lld (distance: %lld)",
+           angle, currentPosition, finalTarget, distance);
 
     // Command the motor to move to the target position
-    move_to_position(finalTarget);
-
-    // Set the NeoPixel color based on the angle
-    setNeoPixelForAngle(angle);
+    if (!move_to_position(finalTarget)) {
+        dlog_w(LOG_MODULE_MOTION, "Rotation to %d° ignored, motion already active", angle);
+        return false;
+    }
 
     // Update timing for auto-rotation
     last_rotation_time = millis();
+    return true;
 }
 
 /**
@@ -167,7 +176,7 @@ void processAutoRotation() {
     unsigned long elapsedTime = (currentTime - last_rotation_time) / 1000; // in seconds
     
     if (elapsedTime >= config.rotation_interval) {
-        log_i("Auto-rotation triggered after %u seconds", elapsedTime);
+        dlog_i(LOG_MODULE_MOTION, "Auto-rotation triggered after %u seconds", elapsedTime);
         moveToNextPosition();
     }
 }
@@ -217,8 +226,40 @@ void setNeoPixelForAngle(int angle) {
             return;
     }
     
-    // Set the NeoPixel color
-    setNeoPixelColor(color);
+    // Fade the NeoPixel to the position colour (the animation task does the output)
+    fadeNeoPixelTo(color, NEOPIXEL_FADE_MS);
+}
+
+/**
+ * Get the configured color of the 90-degree position nearest to an angle
+ */
+uint32_t getColorForNearestAngle(int angle) {
+    int snapped = ((angle + 45) / 90) * 90;
+    if (snapped >= 360) snapped = 0;
+
+    switch (snapped) {
+        case 90:
+            return config.color_90;
+        case 180:
+            return config.color_180;
+        case 270:
+            return config.color_270;
+        case 0:
+        default:
+            return config.color_0;
+    }
+}
+
+/**
+ * Blend the configured colours of the 90-degree positions on either side of an angle
+ * (the NeoPixel shows this while a move is running)
+ */
+uint32_t getColorForAngle(int angle) {
+    const uint32_t colors[4] = { config.color_0, config.color_90, config.color_180, config.color_270 };
+    angle = ((angle % 360) + 360) % 360;
+    uint32_t from = colors[angle / 90];
+    uint32_t to = colors[(angle / 90 + 1) % 4];
+    return blendColor(from, to, (angle % 90) * 256 / 90);
 }
 
 /**
@@ -11,10 +11,12 @@ extern volatile bool motion_active;
 
 // Function prototypes
 void setupRotator();
-void rotateToAngle(int angle);
+bool rotateToAngle(int angle);
 void processAutoRotation();
 void moveToNextPosition();
 void setNeoPixelForAngle(int angle);
+uint32_t getColorForNearestAngle(int angle);
+uint32_t getColorForAngle(int angle);
 void updateMotionControlCalibration();
 
 // Helper functions for angle/position conversion
@@ -0,0 +1,258 @@
+#include "status_push.h"
+#include "event_bus.h"
+#include "ota_update.h"
+#include "wifi_jobs.h"
+#include "config.h"
+#include "rotator.h"
+#include "main.h"
+#include "wifi_manager.h"
+
+// Push channel for status deltas and motion events
+AsyncWebSocket statusWebSocket("/ws/status");
+
+// Last snapshot broadcast to all clients (owned by the dispatcher task)
+static StatusSnapshot lastSentStatus;
+static bool lastSentValid = false;
+
+// Status ticks between WebSocket client cleanups (100ms tick -> 1s)
+#define STATUS_CLEANUP_TICKS 10
+
+/**
+ * Capture the current status fields
+ */
+void captureStatus(StatusSnapshot& snapshot) {
+    MotionControlInfo motionInfo = get_motion_control_info();
+
+    snapshot.current_position = get_current_position();
+    snapshot.target_position = motionInfo.target_position;
+    snapshot.current_angle = positionToAngle(snapshot.current_position);
+    snapshot.motion_active = motionInfo.motion_active;
+    snapshot.auto_rotation_enabled = config.auto_rotation_enabled;
+    snapshot.auto_rotate_forward = config.auto_rotate_forward;
+    snapshot.current_color = getColorForNearestAngle(snapshot.current_angle);
+}
+
+/**
+ * Write status fields into a JSON object
+ * With a previous snapshot only the fields that differ from it are written
+ */
+void writeStatusJson(JsonObject obj, const StatusSnapshot& snapshot, const StatusSnapshot* previous) {
+    if (!previous || snapshot.current_position != previous->current_position) {
+        obj["currentPosition"] = snapshot.current_position;
+    }
+    if (!previous || snapshot.target_position != previous->target_position) {
+        obj["targetPosition"] = snapshot.target_position;
+    }
+    if (!previous || snapshot.current_angle != previous->current_angle) {
+        obj["currentAngle"] = snapshot.current_angle;
+    }
+    if (!previous || snapshot.motion_active != previous->motion_active) {
+        obj["motionActive"] = snapshot.motion_active;
+    }
+    if (!previous || snapshot.auto_rotation_enabled != previous->auto_rotation_enabled) {
+        obj["autoRotationEnabled"] = snapshot.auto_rotation_enabled;
+    }
+    if (!previous || snapshot.auto_rotate_forward != previous->auto_rotate_forward) {
+        obj["autoRotateForward"] = snapshot.auto_rotate_forward;
+    }
+    if (!previous || snapshot.current_color != previous->current_color) {
+        obj["currentColor"] = snapshot.current_color;
+    }
+}
+
+/**
+ * Broadcast a JSON document to all status clients
+ */
+static void broadcastStatusDocument(const JsonDocument& doc) {
+    char buffer[256];
+    size_t len = serializeJson(doc, buffer, sizeof(buffer));
+    statusWebSocket.textAll(buffer, len);
+}
+
+/**
+ * Broadcast the fields that changed since the last push, if any
+ */
+static void pushStatusDelta() {
+    StatusSnapshot snapshot;
+    captureStatus(snapshot);
+
+    StaticJsonDocument<256> doc;
+    doc["type"] = "status";
+    writeStatusJson(doc.as<JsonObject>(), snapshot, lastSentValid ? &lastSentStatus : nullptr);
+
+    // Only the "type" key means nothing changed
+    if (doc.size() > 1) {
+        broadcastStatusDocument(doc);
+    }
+
+    lastSentStatus = snapshot;
+    lastSentValid = true;
+}
+
+/**
+ * Handle WebSocket events for the status channel
+ */
+static void onStatusWebSocketEvent(AsyncWebSocket *server, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len) {
+    switch (type) {
+        case WS_EVT_CONNECT: {
+            log_i("Status WebSocket client #%u connected from %s", client->id(), client->remoteIP().toString().c_str());
+
+            // New subscribers start from a full snapshot, then receive deltas
+            StatusSnapshot snapshot;
+            captureStatus(snapshot);
+
+            StaticJsonDocument<256> doc;
+            doc["type"] = "status";
+            writeStatusJson(doc.as<JsonObject>(), snapshot, nullptr);
+
+            char buffer[256];
+            size_t jsonLen = serializeJson(doc, buffer, sizeof(buffer));
+            client->text(buffer, jsonLen);
+            break;
+        }
+
+        case WS_EVT_DISCONNECT:
+            log_i("Status WebSocket client #%u disconnected", client->id());
+            break;
+
+        case WS_EVT_DATA:
+        case WS_EVT_PONG:
+        case WS_EVT_ERROR:
+            break;
+    }
+}
+
+/**
+ * Status tick: push a delta when something changed
+ */
+static void onStatusTick(const Event& event) {
+    static uint32_t ticksSinceCleanup = 0;
+    if (++ticksSinceCleanup >= STATUS_CLEANUP_TICKS) {
+        statusWebSocket.cleanupClients();
+        ticksSinceCleanup = 0;
+    }
+
+    if (statusWebSocket.count() == 0) {
+        lastSentValid = false;
+        return;
+    }
+
+    pushStatusDelta();
+}
+
+/**
+ * Motion started: announce it and push the new target right away
+ */
+static void onMoveStarted(const Event& event) {
+    if (statusWebSocket.count() == 0) {
+        return;
+    }
+
+    MotionControlInfo motionInfo = get_motion_control_info();
+
+    StaticJsonDocument<128> doc;
+    doc["type"] = "move-start";
+    doc["position"] = get_current_position();
+    doc["targetPosition"] = motionInfo.target_position;
+    broadcastStatusDocument(doc);
+
+    pushStatusDelta();
+}
+
+/**
+ * Motion finished: announce the outcome and push the final position
+ */
+static void onMoveCompleted(const Event& event) {
+    if (statusWebSocket.count() == 0) {
+        return;
+    }
+
+    MotionControlInfo motionInfo = get_motion_control_info();
+
+    StaticJsonDocument<128> doc;
+    doc["type"] = "move-complete";
+    doc["position"] = get_current_position();
+    doc["targetPosition"] = motionInfo.target_position;
+    doc["aborted"] = (event.arg == MOVE_RESULT_ABORTED);
+    doc["stopped"] = (event.arg == MOVE_RESULT_STOPPED);
+    broadcastStatusDocument(doc);
+
+    pushStatusDelta();
+}
+
+/**
+ * Configuration saved: tell clients to refresh their config view
+ */
+static void onConfigChanged(const Event& event) {
+    if (statusWebSocket.count() == 0) {
+        return;
+    }
+
+    StaticJsonDocument<32> doc;
+    doc["type"] = "config";
+    broadcastStatusDocument(doc);
+
+    pushStatusDelta();
+}
+
+/**
+ * OTA state change or progress step: forward it so the UI can follow flash writes
+ */
+static void onOtaProgress(const Event& event) {
+    if (statusWebSocket.count() == 0) {
+        return;
+    }
+
+    OtaStatus status;
+    getOtaStatus(status);
+
+    StaticJsonDocument<192> doc;
+    doc["type"] = "ota";
+    doc["state"] = otaStateName(status.state);
+    doc["written"] = status.written;
+    doc["total"] = status.total;
+    if (status.state == OTA_SUCCESS) {
+        doc["hashVerified"] = status.hash_verified;
+    }
+    if (status.error) {
+        doc["error"] = status.error;
+    }
+    broadcastStatusDocument(doc);
+}
+
+/**
+ * WiFi test/connect job changed state: push it so clients need not poll /api/wifi/job
+ */
+static void onWiFiJobUpdated(const Event& event) {
+    if (statusWebSocket.count() == 0) {
+        return;
+    }
+
+    WiFiJob job;
+    if (!getWiFiJob(event.arg, job)) {
+        return;
+    }
+
+    StaticJsonDocument<256> doc;
+    doc["type"] = "wifi-job";
+    writeWiFiJobJson(doc.as<JsonObject>(), job);
+    broadcastStatusDocument(doc);
+}
+
+/**
+ * Setup the status push WebSocket and its event handlers
+ * Must be called before webServer.begin()
+ */
+void setupStatusPush() {
+    statusWebSocket.onEvent(onStatusWebSocketEvent);
+    webServer.addHandler(&statusWebSocket);
+
+    registerEventHandler(EVENT_STATUS_TICK, onStatusTick);
+    registerEventHandler(EVENT_MOVE_STARTED, onMoveStarted);
+    registerEventHandler(EVENT_MOVE_COMPLETED, onMoveCompleted);
+    registerEventHandler(EVENT_CONFIG_CHANGED, onConfigChanged);
+    registerEventHandler(EVENT_OTA_PROGRESS, onOtaProgress);
+    registerEventHandler(EVENT_WIFI_JOB_UPDATED, onWiFiJobUpdated);
+
+    log_i("Status push WebSocket handler setup complete");
+}
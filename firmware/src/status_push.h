@@ -0,0 +1,27 @@
+#ifndef STATUS_PUSH_H
+#define STATUS_PUSH_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <ESPAsyncWebServer.h>
+
+// Status fields shared by /api/status and the /ws/status push channel
+struct StatusSnapshot {
+    int64_t current_position;
+    int64_t target_position;
+    int current_angle;
+    bool motion_active;
+    bool auto_rotation_enabled;
+    bool auto_rotate_forward;
+    uint32_t current_color;
+};
+
+// Function prototypes
+void setupStatusPush();
+void captureStatus(StatusSnapshot& snapshot);
+void writeStatusJson(JsonObject obj, const StatusSnapshot& snapshot, const StatusSnapshot* previous);
+
+// External declarations
+extern AsyncWebSocket statusWebSocket;
+
+#endif // STATUS_PUSH_H
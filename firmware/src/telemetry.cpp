@@ -0,0 +1,315 @@
+#include "telemetry.h"
+#include "main.h"
+#include "event_bus.h"
+#include "wifi_manager.h"
+#include "api_response.h"
+#include <esp_timer.h>
+#include <time.h>
+#include <math.h>
+
+// Bucket being filled; merged into the next coarser tier when it closes
+struct TelemetryAccumulator {
+    float min[TELEMETRY_CHANNEL_COUNT];
+    float max[TELEMETRY_CHANNEL_COUNT];
+    double sum[TELEMETRY_CHANNEL_COUNT];  // Coarse tiers add millions of samples; a float sum stops growing
+    uint32_t samples;
+};
+
+// Fixed ring of closed buckets; bucket number n (uptime seconds / width) lives in slot n % capacity
+struct TelemetryTier {
+    const char* name;
+    uint32_t seconds;
+    uint32_t capacity;
+    TelemetryBucket* buckets;
+    uint32_t first;                     // First bucket number after boot
+    volatile uint32_t next;             // Bucket being filled; every bucket before it is closed
+    TelemetryAccumulator open;
+};
+
+static TelemetryTier tiers[TELEMETRY_TIER_COUNT] = {
+    { "1s", 1, TELEMETRY_SECOND_BUCKETS },
+    { "1m", 60, TELEMETRY_MINUTE_BUCKETS },
+    { "1h", 3600, TELEMETRY_HOUR_BUCKETS },
+};
+
+// Quantization step per channel: values go out as integer multiples of it
+static const float channelScales[TELEMETRY_CHANNEL_COUNT] = { 1.0f, 1.0f, 0.1f, 1.0f };
+
+// Columns of a response: sample counts, then min, max and mean of each channel
+#define TELEMETRY_STATS_PER_CHANNEL 3
+#define TELEMETRY_COLUMN_COUNT (1 + TELEMETRY_CHANNEL_COUNT * TELEMETRY_STATS_PER_CHANNEL)
+#define TELEMETRY_HEADER_SIZE (24 + 4 * TELEMETRY_CHANNEL_COUNT)
+
+static void resetAccumulator(TelemetryAccumulator& acc) {
+    for (int c = 0; c < TELEMETRY_CHANNEL_COUNT; c++) {
+        acc.min[c] = INFINITY;
+        acc.max[c] = -INFINITY;
+        acc.sum[c] = 0;
+    }
+    acc.samples = 0;
+}
+
+static void advanceTier(uint8_t t, uint32_t number);
+
+/**
+ * Close the open bucket of a tier and fold it into the next coarser one
+ */
+static void closeBucket(uint8_t t) {
+    TelemetryTier& tier = tiers[t];
+    TelemetryAccumulator& acc = tier.open;
+    TelemetryBucket& bucket = tier.buckets[tier.next % tier.capacity];
+
+    for (int c = 0; c < TELEMETRY_CHANNEL_COUNT; c++) {
+        bucket.min[c] = acc.samples ? acc.min[c] : 0;
+        bucket.max[c] = acc.samples ? acc.max[c] : 0;
+        bucket.mean[c] = acc.samples ? (float)(acc.sum[c] / acc.samples) : 0;
+    }
+    bucket.samples = min(acc.samples, (uint32_t)UINT16_MAX);
+
+    if (t + 1 < TELEMETRY_TIER_COUNT) {
+        TelemetryTier& parent = tiers[t + 1];
+        advanceTier(t + 1, (uint64_t)tier.next * tier.seconds / parent.seconds);
+        if (acc.samples) {
+            for (int c = 0; c < TELEMETRY_CHANNEL_COUNT; c++) {
+                parent.open.min[c] = min(parent.open.min[c], acc.min[c]);
+                parent.open.max[c] = max(parent.open.max[c], acc.max[c]);
+                parent.open.sum[c] += acc.sum[c];
+            }
+            parent.open.samples += acc.samples;
+        }
+    }
+
+    resetAccumulator(acc);
+    tier.next++;                        // Publishes the bucket written above
+}
+
+/**
+ * Close buckets until number is the open one
+ */
+static void advanceTier(uint8_t t, uint32_t number) {
+    TelemetryTier& tier = tiers[t];
+    if (number > tier.next + tier.capacity) {
+        // Stalled for longer than the ring covers: close the open bucket, then only
+        // write the last ring's worth of empty ones
+        closeBucket(t);
+        tier.next = max(tier.next, number - tier.capacity);
+    }
+    while (tier.next < number) {
+        closeBucket(t);
+    }
+}
+
+/**
+ * Add one sample (runs in the dispatcher task on each EVENT_DEBUG_TICK)
+ */
+static void sampleTelemetry(const Event& event) {
+    MotionControlInfo motionInfo = get_motion_control_info();
+    float values[TELEMETRY_CHANNEL_COUNT];
+    values[TELEMETRY_POSITION] = (float)get_current_position();
+    values[TELEMETRY_VELOCITY] = motionInfo.velocity;
+    values[TELEMETRY_PWM] = motionInfo.pwm_control_out;
+    values[TELEMETRY_SPEED_ERROR] = motionInfo.speed_error;
+
+    advanceTier(TELEMETRY_TIER_SECOND, (uint32_t)(event.posted_us / 1000000));
+
+    TelemetryAccumulator& acc = tiers[TELEMETRY_TIER_SECOND].open;
+    for (int c = 0; c < TELEMETRY_CHANNEL_COUNT; c++) {
+        acc.min[c] = min(acc.min[c], values[c]);
+        acc.max[c] = max(acc.max[c], values[c]);
+        acc.sum[c] += values[c];
+    }
+    acc.samples++;
+}
+
+static size_t putVarint(uint8_t* out, uint64_t value) {
+    size_t length = 0;
+    while (value >= 0x80) {
+        out[length++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    out[length++] = (uint8_t)value;
+    return length;
+}
+
+static void putU32(uint8_t* out, uint32_t value) {
+    memcpy(out, &value, sizeof(value));       // Xtensa is little endian, like the wire format
+}
+
+/**
+ * Streams a range of closed buckets of one tier in the compact column format
+ * (see README "Telemetry Rollups"). Each column is delta coded against the previous
+ * bucket; a token is a varint whose low bit selects a run of unchanged buckets (1)
+ * or a zigzag delta (0), so idle stretches cost a byte or two per column
+ */
+class TelemetryResponse : public AsyncAbstractResponse {
+public:
+    TelemetryResponse(bool chunked, uint8_t tier, uint32_t first, uint32_t count)
+        : _tier(tiers[tier]), _first(first), _count(count), _column(0), _index(0),
+          _previous(0), _tokenLength(0), _tokenOffset(0) {
+        _code = 200;
+        _contentType = "application/octet-stream";
+        _sendContentLength = false;
+        _chunked = chunked;             // HTTP/1.0 clients read until the connection closes
+        renderHeader(tier);
+    }
+
+    bool _sourceValid() const override {
+        return true;
+    }
+
+    size_t _fillBuffer(uint8_t* buf, size_t maxLen) override {
+        size_t written = 0;
+        while (written < maxLen) {
+            if (_tokenOffset == _tokenLength) {
+                _tokenLength = renderNextToken();
+                _tokenOffset = 0;
+                if (_tokenLength == 0) {
+                    break;
+                }
+            }
+            size_t count = min(_tokenLength - _tokenOffset, maxLen - written);
+            memcpy(buf + written, _token + _tokenOffset, count);
+            _tokenOffset += count;
+            written += count;
+        }
+        return written;
+    }
+
+private:
+    void renderHeader(uint8_t tier) {
+        time_t now = time(NULL);
+        uint32_t uptime_s = esp_timer_get_time() / 1000000;
+        uint32_t epoch = now >= 1700000000 ? (uint32_t)now - uptime_s : 0;
+
+        putU32(_token, TELEMETRY_MAGIC);
+        _token[4] = TELEMETRY_VERSION;
+        _token[5] = tier;
+        _token[6] = TELEMETRY_CHANNEL_COUNT;
+        _token[7] = TELEMETRY_STATS_PER_CHANNEL;
+        putU32(_token + 8, _tier.seconds);
+        putU32(_token + 12, _first);
+        putU32(_token + 16, _count);
+        putU32(_token + 20, epoch);
+        for (int c = 0; c < TELEMETRY_CHANNEL_COUNT; c++) {
+            memcpy(_token + 24 + 4 * c, &channelScales[c], 4);
+        }
+        _tokenLength = TELEMETRY_HEADER_SIZE;
+    }
+
+    /**
+     * Quantized value of the current column for bucket index; empty buckets repeat the previous value
+     */
+    int64_t valueAt(uint32_t index) {
+        const TelemetryBucket& bucket = _tier.buckets[(_first + index) % _tier.capacity];
+        if (_column == 0) {
+            return bucket.samples;
+        }
+        if (bucket.samples == 0) {
+            return _previous;
+        }
+        uint8_t channel = (_column - 1) / TELEMETRY_STATS_PER_CHANNEL;
+        uint8_t stat = (_column - 1) % TELEMETRY_STATS_PER_CHANNEL;
+        float value = stat == 0 ? bucket.min[channel] : stat == 1 ? bucket.max[channel] : bucket.mean[channel];
+        return llroundf(value / channelScales[channel]);
+    }
+
+    size_t renderNextToken() {
+        while (_column < TELEMETRY_COLUMN_COUNT) {
+            if (_index == _count) {
+                _column++;
+                _index = 0;
+                _previous = 0;
+                continue;
+            }
+
+            int64_t delta = valueAt(_index) - _previous;
+            if (delta == 0) {
+                uint32_t run = 1;
+                while (_index + run < _count && valueAt(_index + run) == _previous) {
+                    run++;
+                }
+                _index += run;
+                return putVarint(_token, ((uint64_t)run << 1) | 1);
+            }
+
+            _previous += delta;
+            _index++;
+            uint64_t zigzag = ((uint64_t)delta << 1) ^ (uint64_t)(delta >> 63);
+            return putVarint(_token, zigzag << 1);
+        }
+        return 0;
+    }
+
+    const TelemetryTier& _tier;
+    uint32_t _first;
+    uint32_t _count;
+    uint8_t _column;
+    uint32_t _index;
+    int64_t _previous;
+    uint8_t _token[TELEMETRY_HEADER_SIZE];
+    size_t _tokenLength;
+    size_t _tokenOffset;
+};
+
+/**
+ * Allocate the rings, start sampling and register /api/telemetry
+ * Must be called before webServer.begin()
+ */
+void setupTelemetry() {
+    uint32_t now_s = esp_timer_get_time() / 1000000;
+    for (int t = 0; t < TELEMETRY_TIER_COUNT; t++) {
+        TelemetryTier& tier = tiers[t];
+        size_t bytes = tier.capacity * sizeof(TelemetryBucket);
+        tier.buckets = static_cast<TelemetryBucket*>(psramFound() ? ps_malloc(bytes) : malloc(bytes));
+        if (!tier.buckets) {
+            log_e("Telemetry rollups disabled: %u bytes not available", bytes);
+            return;
+        }
+        tier.first = now_s / tier.seconds;
+        tier.next = tier.first;
+        resetAccumulator(tier.open);
+    }
+
+    registerEventHandler(EVENT_DEBUG_TICK, sampleTelemetry);
+
+    // Closed buckets of one tier: the newest count, or those after since (a bucket number
+    // from an earlier response), oldest first
+    webServer.on("/api/telemetry", HTTP_GET, [](AsyncWebServerRequest *request) {
+        const char* tierName = getParamValue(request, "tier", false);
+        uint8_t t = TELEMETRY_TIER_MINUTE;
+        if (tierName) {
+            for (t = 0; t < TELEMETRY_TIER_COUNT && strcmp(tierName, tiers[t].name) != 0; t++) {
+            }
+            if (t == TELEMETRY_TIER_COUNT) {
+                sendText(request, 400, "tier must be 1s, 1m or 1h");
+                return;
+            }
+        }
+        const TelemetryTier& tier = tiers[t];
+
+        uint32_t end = tier.next;
+        uint32_t oldest = max(tier.first, end > tier.capacity - TELEMETRY_READ_MARGIN ?
+                                          end - (tier.capacity - TELEMETRY_READ_MARGIN) : 0u);
+        uint32_t first = oldest;
+
+        int64_t value;
+        if (getParamValue(request, "since", false)) {
+            if (!getParamInt64(request, "since", value, false) || value < 0) {
+                sendText(request, 400, "Invalid since");
+                return;
+            }
+            first = constrain((uint32_t)min(value + 1, (int64_t)end), oldest, end);
+        }
+        if (getParamValue(request, "count", false)) {
+            if (!getParamInt64(request, "count", value, false) || value < 0) {
+                sendText(request, 400, "Invalid count");
+                return;
+            }
+            first = max(first, end - (uint32_t)min(value, (int64_t)(end - first)));
+        }
+
+        request->send(new TelemetryResponse(request->version() != 0, t, first, end - first));
+    });
+
+    log_i("Telemetry rollups setup complete");
+}
@@ -0,0 +1,42 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <Arduino.h>
+
+// Telemetry rollup configuration (fed by EVENT_DEBUG_TICK, 10 Hz)
+#define TELEMETRY_SECOND_BUCKETS 3600       // 1 s buckets: the last hour
+#define TELEMETRY_MINUTE_BUCKETS 1440       // 1 min buckets: the last day
+#define TELEMETRY_HOUR_BUCKETS 720          // 1 h buckets: the last 30 days
+#define TELEMETRY_READ_MARGIN 60            // Oldest buckets of a tier not served, so a slow
+                                            // download never reads a slot being overwritten
+#define TELEMETRY_MAGIC 0x4D4C5452          // "RTLM", little endian
+#define TELEMETRY_VERSION 1
+
+// Sampled quantities, in response column order
+enum TelemetryChannel : uint8_t {
+    TELEMETRY_POSITION,                 // Encoder counts
+    TELEMETRY_VELOCITY,                 // Counts per second
+    TELEMETRY_PWM,                      // Percent duty, signed
+    TELEMETRY_SPEED_ERROR,              // Velocity loop error, counts per second
+    TELEMETRY_CHANNEL_COUNT
+};
+
+enum TelemetryTierId : uint8_t {
+    TELEMETRY_TIER_SECOND,
+    TELEMETRY_TIER_MINUTE,
+    TELEMETRY_TIER_HOUR,
+    TELEMETRY_TIER_COUNT
+};
+
+// One closed bucket
+struct TelemetryBucket {
+    float min[TELEMETRY_CHANNEL_COUNT];
+    float max[TELEMETRY_CHANNEL_COUNT];
+    float mean[TELEMETRY_CHANNEL_COUNT];
+    uint16_t samples;                   // 0 = no data (e.g. the dispatcher stalled)
+};
+
+// Function prototypes
+void setupTelemetry();
+
+#endif // TELEMETRY_H
@@ -0,0 +1,281 @@
+#include "udp_control.h"
+#include "config.h"
+#include "rotator.h"
+#include "main.h"
+#include "deferred_log.h"
+#include <AsyncUDP.h>
+#include <Preferences.h>
+#include <mbedtls/md.h>
+
+// Command socket; packets are handled (and moves started) in the async_udp task
+static AsyncUDP controlUdp;
+
+// Last response per sender, so a retransmitted request is answered without running it again
+// Only touched by the async_udp task
+struct ControlClient {
+    uint32_t ip;                        // 0 marks a free slot
+    uint16_t port;
+    uint32_t seq;
+    uint32_t last_seen_ms;
+    uint8_t response[CONTROL_RESPONSE_SIZE + CONTROL_TAG_SIZE];
+    uint8_t response_length;
+};
+
+static ControlClient clients[CONTROL_MAX_CLIENTS] = {};
+
+// Highest seq executed with a valid tag; older authenticated requests are replays
+static uint32_t lastAuthSeq = 0;
+static bool lastAuthSeqValid = false;
+
+// Persisted bound on every authenticated seq executed so far; after a reboot lastAuthSeq
+// restarts from it, so requests captured before the reboot stay stale
+static Preferences seqStore;
+static uint32_t reservedSeq = 0;
+static bool reservedSeqValid = false;
+
+static uint32_t readLE32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void writeLE32(uint8_t* p, uint32_t value) {
+    p[0] = value;
+    p[1] = value >> 8;
+    p[2] = value >> 16;
+    p[3] = value >> 24;
+}
+
+static void writeLE64(uint8_t* p, int64_t value) {
+    writeLE32(p, (uint32_t)value);
+    writeLE32(p + 4, (uint32_t)((uint64_t)value >> 32));
+}
+
+/**
+ * Find the sender's slot, or recycle the least recently used one
+ */
+static ControlClient* findClient(uint32_t ip, uint16_t port, bool create) {
+    ControlClient* oldest = &clients[0];
+    for (int i = 0; i < CONTROL_MAX_CLIENTS; i++) {
+        ControlClient* client = &clients[i];
+        if (client->ip == ip && client->port == port) {
+            return client;
+        }
+        if (client->ip == 0 || (oldest->ip != 0 && (int32_t)(client->last_seen_ms - oldest->last_seen_ms) < 0)) {
+            oldest = client;
+        }
+    }
+    if (!create) {
+        return NULL;
+    }
+
+    oldest->ip = ip;
+    oldest->port = port;
+    oldest->response_length = 0;
+    return oldest;
+}
+
+/**
+ * Truncated HMAC-SHA256 of data under the configured key
+ */
+static void computeTag(const uint8_t* data, size_t length, uint8_t* tag) {
+    uint8_t digest[32];
+    mbedtls_md_hmac(mbedtls_md_info_from_type(MBEDTLS_MD_SHA256),
+                    (const uint8_t*)config.control_key, strlen(config.control_key),
+                    data, length, digest);
+    memcpy(tag, digest, CONTROL_TAG_SIZE);
+}
+
+static bool verifyTag(const uint8_t* data, size_t length, const uint8_t* tag) {
+    uint8_t expected[CONTROL_TAG_SIZE];
+    computeTag(data, length, expected);
+
+    // Constant time comparison
+    uint8_t difference = 0;
+    for (int i = 0; i < CONTROL_TAG_SIZE; i++) {
+        difference |= expected[i] ^ tag[i];
+    }
+    return difference == 0;
+}
+
+/**
+ * Make sure seq is below the persisted replay mark, moving the mark ahead by
+ * CONTROL_SEQ_RESERVE when it is not (one flash write per that many commands)
+ */
+static bool reserveSeq(uint32_t seq) {
+    if (reservedSeqValid && (int32_t)(seq - reservedSeq) <= 0) {
+        return true;
+    }
+
+    uint32_t mark = seq + CONTROL_SEQ_RESERVE;
+    if (seqStore.putUInt("seq", mark) != sizeof(mark)) {
+        dlog_e(LOG_MODULE_NETWORK, "UDP control replay mark not saved, refusing seq %u", seq);
+        return false;
+    }
+    reservedSeq = mark;
+    reservedSeqValid = true;
+    return true;
+}
+
+/**
+ * Run a command; called only for requests that passed authentication
+ */
+static ControlResult executeCommand(uint8_t command, const uint8_t* payload, size_t length) {
+    switch (command) {
+        case CONTROL_CMD_STATUS:
+            return length == 0 ? CONTROL_OK : CONTROL_BAD_REQUEST;
+
+        case CONTROL_CMD_GOTO: {
+            if (length != 8) {
+                return CONTROL_BAD_REQUEST;
+            }
+            int64_t position = (int64_t)((uint64_t)readLE32(payload) | ((uint64_t)readLE32(payload + 4) << 32));
+            return move_to_position(position) ? CONTROL_OK : CONTROL_BUSY;
+        }
+
+        case CONTROL_CMD_ROTATE: {
+            if (length != 2) {
+                return CONTROL_BAD_REQUEST;
+            }
+            int16_t angle = (int16_t)(payload[0] | (payload[1] << 8));
+            if (angle < 0 || angle >= 360) {
+                return CONTROL_BAD_REQUEST;
+            }
+            return rotateToAngle(angle) ? CONTROL_OK : CONTROL_BUSY;
+        }
+
+        case CONTROL_CMD_STOP:
+            if (length != 0) {
+                return CONTROL_BAD_REQUEST;
+            }
+            stop_motion();
+            return CONTROL_OK;
+
+        default:
+            return CONTROL_BAD_REQUEST;
+    }
+}
+
+/**
+ * Fill a response: header, result and a status snapshot taken after the command ran
+ */
+static void buildResponse(uint8_t* response, uint8_t command, uint32_t seq, ControlResult result) {
+    MotionControlInfo motionInfo = get_motion_control_info();
+    int64_t position = get_current_position();
+    int16_t angle = positionToAngle(position);
+    float velocity = motionInfo.velocity;
+
+    response[0] = 'R';
+    response[1] = 'C';
+    response[2] = CONTROL_VERSION;
+    response[3] = command | CONTROL_RESPONSE_FLAG;
+    writeLE32(response + 4, seq);
+    response[8] = result;
+    response[9] = (motionInfo.motion_active ? CONTROL_FLAG_MOTION_ACTIVE : 0) |
+                  (config.auto_rotation_enabled ? CONTROL_FLAG_AUTO_ROTATION : 0);
+    response[10] = angle;
+    response[11] = angle >> 8;
+    writeLE64(response + 12, position);
+    writeLE64(response + 20, motionInfo.target_position);
+    memcpy(response + 28, &velocity, sizeof(velocity));
+}
+
+/**
+ * Append the tag when a key is configured; returns the response length
+ */
+static size_t signResponse(uint8_t* response, bool authenticated) {
+    if (!authenticated) {
+        return CONTROL_RESPONSE_SIZE;
+    }
+    computeTag(response, CONTROL_RESPONSE_SIZE, response + CONTROL_RESPONSE_SIZE);
+    return CONTROL_RESPONSE_SIZE + CONTROL_TAG_SIZE;
+}
+
+/**
+ * Control packet handler; runs in the async_udp task
+ */
+static void onControlPacket(AsyncUDPPacket& packet) {
+    const uint8_t* data = packet.data();
+    size_t length = packet.length();
+
+    // Silently ignore anything that is not a request of this protocol version
+    if (length < CONTROL_HEADER_SIZE || data[0] != 'R' || data[1] != 'C' ||
+        data[2] != CONTROL_VERSION || (data[3] & CONTROL_RESPONSE_FLAG)) {
+        return;
+    }
+
+    uint8_t command = data[3];
+    uint32_t seq = readLE32(data + 4);
+    size_t payloadLength = length - CONTROL_HEADER_SIZE;
+    bool authenticated = (config.control_key[0] != '\0');
+    uint8_t response[CONTROL_RESPONSE_SIZE + CONTROL_TAG_SIZE];
+
+    if (authenticated) {
+        if (payloadLength < CONTROL_TAG_SIZE ||
+            !verifyTag(data, length - CONTROL_TAG_SIZE, data + length - CONTROL_TAG_SIZE)) {
+            buildResponse(response, command, seq, CONTROL_AUTH_FAILED);
+            packet.write(response, signResponse(response, false));
+            return;
+        }
+        payloadLength -= CONTROL_TAG_SIZE;
+    }
+
+    uint32_t ip = packet.remoteIP();
+    uint16_t port = packet.remotePort();
+
+    // Retransmission of the request we answered last: resend that answer, do not run it again
+    ControlClient* client = findClient(ip, port, false);
+    if (client && client->response_length && client->seq == seq) {
+        client->last_seen_ms = millis();
+        packet.write(client->response, client->response_length);
+        return;
+    }
+
+    // A stale answer carries the last executed seq in the target field, so a controller
+    // whose counter fell behind (e.g. another controller was busier) can continue after it
+    if (authenticated && lastAuthSeqValid && (int32_t)(seq - lastAuthSeq) <= 0) {
+        buildResponse(response, command, seq, CONTROL_STALE);
+        writeLE64(response + 20, lastAuthSeq);
+        packet.write(response, signResponse(response, true));
+        return;
+    }
+
+    // The mark must be on flash before the command runs, or a reboot could reopen its seq
+    bool reserved = !authenticated || reserveSeq(seq);
+    ControlResult result = reserved ? executeCommand(command, data + CONTROL_HEADER_SIZE, payloadLength) : CONTROL_BUSY;
+    buildResponse(response, command, seq, result);
+    size_t responseLength = signResponse(response, authenticated);
+    packet.write(response, responseLength);
+
+    if (authenticated && reserved) {
+        lastAuthSeq = seq;
+        lastAuthSeqValid = true;
+    }
+
+    client = findClient(ip, port, true);
+    client->seq = seq;
+    client->last_seen_ms = millis();
+    memcpy(client->response, response, responseLength);
+    client->response_length = responseLength;
+
+    dlog_d(LOG_MODULE_NETWORK, "UDP control cmd %u seq %u -> %u", command, seq, result);
+}
+
+/**
+ * Start the binary UDP control listener
+ */
+void setupUdpControl() {
+    // Nothing captured before this boot can have a seq above the saved mark
+    seqStore.begin(CONTROL_NVS_NAMESPACE, false);
+    if (seqStore.isKey("seq")) {
+        reservedSeq = seqStore.getUInt("seq");
+        reservedSeqValid = true;
+        lastAuthSeq = reservedSeq;
+        lastAuthSeqValid = true;
+    }
+
+    if (!controlUdp.listen(CONTROL_UDP_PORT)) {
+        log_e("UDP control listener failed to start");
+        return;
+    }
+    controlUdp.onPacket(onControlPacket);
+    log_i("UDP control listening on port %d", CONTROL_UDP_PORT);
+}
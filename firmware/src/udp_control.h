@@ -0,0 +1,43 @@
+#ifndef UDP_CONTROL_H
+#define UDP_CONTROL_H
+
+#include <Arduino.h>
+
+// Binary UDP control protocol configuration
+#define CONTROL_UDP_PORT 42421
+#define CONTROL_VERSION 1
+#define CONTROL_HEADER_SIZE 8           // "RC", version, command, u32 seq
+#define CONTROL_RESPONSE_SIZE 32        // Header, result, flags, angle, position, target, velocity
+#define CONTROL_TAG_SIZE 16             // Truncated HMAC-SHA256, appended when control_key is set
+#define CONTROL_MAX_CLIENTS 8           // Senders whose last response is kept for retries
+#define CONTROL_SEQ_RESERVE 4096        // Authenticated seqs covered by one flash write of the replay mark
+#define CONTROL_NVS_NAMESPACE "udp_control"
+
+// Request commands; responses echo the command with CONTROL_RESPONSE_FLAG set
+enum ControlCommand : uint8_t {
+    CONTROL_CMD_STATUS = 1,             // No payload
+    CONTROL_CMD_GOTO = 2,               // i64 encoder position
+    CONTROL_CMD_ROTATE = 3,             // i16 angle (0-359)
+    CONTROL_CMD_STOP = 4                // No payload
+};
+
+#define CONTROL_RESPONSE_FLAG 0x80
+
+enum ControlResult : uint8_t {
+    CONTROL_OK = 0,
+    CONTROL_BUSY = 1,                   // goto/rotate while a move is running, or the replay mark
+                                        // could not be saved
+    CONTROL_BAD_REQUEST = 2,            // Unknown command, wrong payload length or value out of range
+    CONTROL_AUTH_FAILED = 3,            // Missing or wrong HMAC tag
+    CONTROL_STALE = 4                   // Authenticated seq not newer than the last one executed
+                                        // (the response's target field holds that seq)
+};
+
+// Response status flags
+#define CONTROL_FLAG_MOTION_ACTIVE 0x01
+#define CONTROL_FLAG_AUTO_ROTATION 0x02
+
+// Function prototypes
+void setupUdpControl();
+
+#endif // UDP_CONTROL_H
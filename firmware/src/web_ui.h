@@ -1,12 +1,841 @@
+// Auto-generated by html_to_header.py from data/index.html
+// DO NOT EDIT - edit data/index.html and rebuild instead
+
 #ifndef WEB_UI_H
 #define WEB_UI_H
 
 #include <Arduino.h>
 
-// HTML content for the web UI (stored in flash memory)
-const char html_index[] PROGMEM = "<!DOCTYPE html>\n<html lang=\"en\">\n<head>\n    <meta charset=\"UTF-8\">\n    <meta name=\"viewport\" content=\"width=device-width, initial-scale=1.0\">\n    <title>Rotator Control</title>\n    <style>\n        body {\n            font-family: Arial, sans-serif;\n            margin: 0;\n            padding: 0;\n            background-color: #f4f4f4;\n            color: #333;\n        }\n        .container {\n            max-width: 800px;\n            margin: 0 auto;\n            padding: 20px;\n        }\n        header {\n            background-color: #2c3e50;\n            color: white;\n            padding: 10px 0;\n            text-align: center;\n            margin-bottom: 20px;\n        }\n        h1 {\n            margin: 0;\n        }\n        .build-info {\n            font-size: 12px;\n            color: #bdc3c7;\n            margin-top: 5px;\n            font-family: monospace;\n        }\n        .card {\n            background-color: white;\n            border-radius: 5px;\n            box-shadow: 0 2px 5px rgba(0,0,0,0.1);\n            padding: 20px;\n            margin-bottom: 20px;\n        }\n        .status {\n            display: flex;\n            justify-content: space-between;\n            margin-bottom: 15px;\n        }\n        .status-item {\n            text-align: center;\n            flex: 1;\n        }\n        .status-value {\n            font-size: 24px;\n            font-weight: bold;\n        }\n        .action-buttons {\n            display: grid;\n            grid-template-columns: repeat(2, 1fr);\n            gap: 10px;\n            margin-bottom: 15px;\n        }\n        button {\n            padding: 10px;\n            border: none;\n            border-radius: 5px;\n            background-color: #3498db;\n            color: white;\n            cursor: pointer;\n            font-size: 16px;\n        }\n        button:hover {\n            background-color: #2980b9;\n        }\n        .form-group {\n            margin-bottom: 15px;\n        }\n        label {\n            display: block;\n            margin-bottom: 5px;\n            font-weight: bold;\n        }\n        input, select {\n            width: 100%;\n            padding: 8px;\n            border: 1px solid #ddd;\n            border-radius: 4px;\n        }\n        .color-preview {\n            width: 30px;\n            height: 30px;\n            display: inline-block;\n            margin-left: 10px;\n            border: 1px solid #ccc;\n            vertical-align: middle;\n        }\n        .tab {\n            overflow: hidden;\n            border: 1px solid #ccc;\n            background-color: #f1f1f1;\n            border-radius: 5px 5px 0 0;\n        }\n        .tab button {\n            background-color: inherit;\n            float: left;\n            border: none;\n            outline: none;\n            cursor: pointer;\n            padding: 14px 16px;\n            transition: 0.3s;\n            color: #333;\n        }\n        .tab button:hover {\n            background-color: #ddd;\n        }\n        .tab button.active {\n            background-color: #3498db;\n            color: white;\n        }\n        .tabcontent {\n            display: none;\n            padding: 20px;\n            border: 1px solid #ccc;\n            border-top: none;\n            border-radius: 0 0 5px 5px;\n            background-color: white;\n        }\n        .active-tab {\n            display: block;\n        }\n        .loading {\n            text-align: center;\n            margin: 20px 0;\n        }\n        .loader {\n            border: 5px solid #f3f3f3;\n            border-top: 5px solid #3498db;\n            border-radius: 50%;\n            width: 50px;\n            height: 50px;\n            animation: spin 2s linear infinite;\n            margin: 0 auto;\n        }\n        @keyframes spin {\n            0% { transform: rotate(0deg); }\n            100% { transform: rotate(360deg); }\n        }\n        .hidden {\n            display: none;\n        }\n        #ota-form {\n            margin-top: 20px;\n        }\n        #ota-progress {\n            width: 100%;\n            height: 20px;\n            background-color: #f3f3f3;\n            margin-top: 10px;\n            border-radius: 5px;\n            overflow: hidden;\n        }\n        #ota-progress-bar {\n            height: 100%;\n            width: 0%;\n            background-color: #4CAF50;\n            transition: width 0.3s;\n        }\n        #ota-status {\n            margin-top: 10px;\n            font-weight: bold;\n        }\n        \n        /* Status message styles */\n        .success {\n            color: #4CAF50;\n            background-color: #f0f8f0;\n            border: 1px solid #4CAF50;\n            padding: 10px;\n            border-radius: 4px;\n            margin-top: 10px;\n        }\n        \n        .error {\n            color: #F44336;\n            background-color: #fdf0f0;\n            border: 1px solid #F44336;\n            padding: 10px;\n            border-radius: 4px;\n            margin-top: 10px;\n        }\n        \n        .info {\n            color: #2196F3;\n            background-color: #f0f4ff;\n            border: 1px solid #2196F3;\n            padding: 10px;\n            border-radius: 4px;\n            margin-top: 10px;\n        }\n        \n        /* Debug tab styles */\n        .debug-controls {\n            margin-bottom: 20px;\n            padding: 15px;\n            background-color: #f8f9fa;\n            border-radius: 5px;\n        }\n        \n        .debug-controls button {\n            margin-right: 10px;\n            margin-bottom: 10px;\n        }\n        \n        .debug-status {\n            margin-top: 10px;\n            font-size: 14px;\n            color: #666;\n        }\n        \n        .plot-container {\n            margin-bottom: 30px;\n            padding: 15px;\n            background-color: white;\n            border-radius: 5px;\n            box-shadow: 0 2px 5px rgba(0,0,0,0.1);\n            overflow: hidden; /* Prevent content from overflowing */\n        }\n        \n        .plot-container h3 {\n            margin-top: 0;\n            margin-bottom: 15px;\n            color: #2c3e50;\n        }\n        \n        .plot-container canvas {\n            border: 1px solid #ddd;\n            border-radius: 3px;\n            display: block;\n            margin: 0 auto;\n            max-width: 100%; /* Make canvas responsive */\n            height: auto; /* Maintain aspect ratio */\n        }\n        \n        .plot-legend {\n            margin-top: 10px;\n            text-align: center;\n        }\n        \n        .legend-item {\n            display: inline-block;\n            margin: 0 15px;\n            font-size: 14px;\n        }\n        \n        .legend-color {\n            display: inline-block;\n            width: 20px;\n            height: 12px;\n            margin-right: 5px;\n            vertical-align: middle;\n        }\n        \n        /* Responsive design for smaller screens */\n        @media (max-width: 768px) {\n            .container {\n                padding: 10px;\n            }\n            \n            .plot-container canvas {\n                width: 100%;\n                height: auto;\n            }\n            \n            .legend-item {\n                display: block;\n                margin: 5px 0;\n                text-align: center;\n            }\n            \n            .debug-controls button {\n                width: 100%;\n                margin-bottom: 10px;\n            }\n        }\n    </style>\n</head>\n<body>\n    <header>\n        <h1>Rotator Control v1.1</h1>\n        <div class=\"build-info\" id=\"buildInfo\">Loading build info...</div>\n    </header>\n    \n    <div class=\"container\">\n        <div class=\"card\">\n            <div class=\"status\">\n                <div class=\"status-item\">\n                    <div>Current Position</div>\n                    <div class=\"status-value\" id=\"current-angle\">-</div>\n                    <div id=\"current-position-counts\">-</div>\n                </div>\n                <div class=\"status-item\">\n                    <div>Current Color</div>\n                    <div class=\"color-preview\" id=\"current-color\"></div>\n                </div>\n                <div class=\"status-item\">\n                    <div>Motion Controller</div>\n                    <div class=\"status-value\" id=\"motion-active-status\">-</div>\n                </div>\n                <div class=\"status-item\">\n                    <div>Auto Rotation</div>\n                    <div class=\"status-value\" id=\"auto-rotation-status\">-</div>\n                </div>\n                <div>\n                    <div>Network: <span id=\"current-wifi-ssid\">None</span></div>\n                    <div>WiFi RSSI: <span id=\"current-wifi-rssi\">Unknown</span></div>\n                </div>\n            </div>\n        </div>\n        \n        <div class=\"tab\">\n            <button class=\"tablinks active\" onclick=\"openTab(event, 'control')\">Control</button>\n            <button class=\"tablinks\" onclick=\"openTab(event, 'wifi')\">WiFi</button>\n            <button class=\"tablinks\" onclick=\"openTab(event, 'settings')\">Settings</button>\n            <button class=\"tablinks\" onclick=\"openTab(event, 'calibration')\">Calibration</button>\n            <button class=\"tablinks\" onclick=\"openTab(event, 'motion-control')\">Motion Control</button>\n            <button class=\"tablinks\" onclick=\"openTab(event, 'debug')\">Debug</button>\n            <button class=\"tablinks\" onclick=\"openTab(event, 'updates')\">Updates</button>\n        </div>\n        \n        <!-- Control Tab -->\n        <div id=\"control\" class=\"tabcontent active-tab\">\n            <h2>Rotate</h2>\n            <div class=\"action-buttons\">\n                <button onclick=\"rotate(0)\">0°</button>\n                <button onclick=\"rotate(90)\">90°</button>\n                <button onclick=\"rotate(180)\">180°</button>\n                <button onclick=\"rotate(270)\">270°</button>\n            </div>\n            \n            <h2>Auto Rotation</h2>\n            <div class=\"form-group\">\n                <label>\n                    <input type=\"checkbox\" id=\"auto-rotation-toggle\" onchange=\"toggleAutoRotation()\">\n                    Enable Auto Rotation\n                </label>\n                <label>\n                    <input type=\"checkbox\" id=\"auto-rotate-forward\" onchange=\"toggleAutoRotateForward()\">\n                    Rotate Forward\n                </label>\n            </div>\n            <div class=\"form-group\">\n                <label for=\"rotation-interval\">Rotation Interval (seconds)</label>\n                <input type=\"number\" id=\"rotation-interval\" min=\"5\" value=\"60\">\n                <button onclick=\"saveRotationInterval()\">Save</button>\n            </div>\n        </div>\n        \n        <!-- WiFi Tab -->\n        <div id=\"wifi\" class=\"tabcontent\">\n            <h2>WiFi Configuration</h2>\n            \n            <div class=\"card\">\n                <h3>Current Connection Status</h3>\n                <div class=\"status\">\n                    <div class=\"status-item\">\n                        <div>Status</div>\n                        <div class=\"status-value\" id=\"wifi-status\">-</div>\n                    </div>\n                    <div class=\"status-item\">\n                        <div>IP Address</div>\n                        <div class=\"status-value\" id=\"wifi-ip\">-</div>\n                    </div>\n                    <div class=\"status-item\">\n                        <div>mDNS Name</div>\n                        <div class=\"status-value\" id=\"wifi-mdns\">-</div>\n                    </div>\n                </div>\n            </div>\n            \n            <div class=\"card\">\n                <h3>Connect to WiFi Network</h3>\n                <p>Scan for available networks and connect to your WiFi router.</p>\n                \n                <div class=\"form-group\">\n                    <button onclick=\"scanNetworks()\" id=\"scan-button\">Scan for Networks</button>\n                    <div id=\"scan-status\" class=\"hidden\"></div>\n                </div>\n                \n                <div class=\"form-group\">\n                    <label for=\"wifi-network-select\">Select Network</label>\n                    <select id=\"wifi-network-select\" onchange=\"onNetworkSelect()\">\n                        <option value=\"\">Select a network...</option>\n                    </select>\n                </div>\n                \n                <div class=\"form-group\">\n                    <label for=\"wifi-password\">Password</label>\n                    <input type=\"password\" id=\"wifi-password\" placeholder=\"Enter WiFi password\">\n                </div>\n                \n                <div class=\"action-buttons\">\n                    <button onclick=\"testConnection()\" id=\"test-button\" disabled>Test Connection</button>\n                    <button onclick=\"saveConnection()\" id=\"save-button\" disabled>Save & Connect</button>\n                </div>\n                \n                <div id=\"wifi-message\" class=\"hidden\"></div>\n            </div>\n            \n            <div class=\"card\">\n                <h3>Current WiFi Network</h3>\n                <button onclick=\"disconnectWiFi()\" id=\"disconnect-button\" disabled>Disconnect & Clear</button>\n            </div>\n        </div>\n        \n        <!-- Settings Tab -->\n        <div id=\"settings\" class=\"tabcontent\">\n            <h2>WiFi Settings</h2>\n            <div class=\"form-group\">\n                <label for=\"ap-ssid\">Access Point SSID</label>\n                <input type=\"text\" id=\"ap-ssid\">\n            </div>\n            <div class=\"form-group\">\n                <label for=\"ap-password\">Access Point Password</label>\n                <input type=\"password\" id=\"ap-password\">\n            </div>\n            <button onclick=\"saveWifiSettings()\">Save WiFi Settings</button>\n            \n            <h2>Color Settings</h2>\n            <div class=\"form-group\">\n                <label for=\"color-0\">0° Position Color</label>\n                <input type=\"color\" id=\"color-0\">\n                <div class=\"color-preview\" id=\"preview-0\"></div>\n            </div>\n            <div class=\"form-group\">\n                <label for=\"color-90\">90° Position Color</label>\n                <input type=\"color\" id=\"color-90\">\n                <div class=\"color-preview\" id=\"preview-90\"></div>\n            </div>\n            <div class=\"form-group\">\n                <label for=\"color-180\">180° Position Color</label>\n                <input type=\"color\" id=\"color-180\">\n                <div class=\"color-preview\" id=\"preview-180\"></div>\n            </div>\n            <div class=\"form-group\">\n                <label for=\"color-270\">270° Position Color</label>\n                <input type=\"color\" id=\"color-270\">\n                <div class=\"color-preview\" id=\"preview-270\"></div>\n            </div>\n            <button onclick=\"saveColorSettings()\">Save Color Settings</button>\n            \n            <h2>Reset to Defaults</h2>\n            <button onclick=\"resetSettings()\">Reset All Settings</button>\n        </div>\n        \n        <!-- Calibration Tab -->\n        <div id=\"calibration\" class=\"tabcontent\">\n            <h2>Position Calibration</h2>\n            <p>Set the current physical position as the new zero reference point. This will maintain the relative spacing between all calibrated positions.</p>\n            <div class=\"action-buttons\">\n                <button onclick=\"setZeroPosition()\">Set Zero Position</button>\n            </div>\n\n            <h2>Full Revolution Count</h2>\n            <p>How many counts is a full revolution?</p>\n            <div class=\"form-group\">\n                <label for=\"full-rotation-count\">Full Rotation (encoder counts)</label>\n                <input type=\"number\" id=\"full-rotation-count\" placeholder=\"Enter position in counts\">\n                <button id=\"goto-button\" onclick=\"saveFullRotationSettings()\">Set Full Rotation Count</button>\n            </div>\n            \n            <h2>Go to Position</h2>\n            <p>Move to a specific encoder position for testing or calibration.</p>\n            <div class=\"form-group\">\n                <label for=\"goto-position\">Target Position (encoder counts)</label>\n                <input type=\"number\" id=\"goto-position\" placeholder=\"Enter position in counts\">\n                <button id=\"goto-button\" onclick=\"gotoPosition()\">Go to Position</button>\n            </div>\n            <div id=\"goto-status\" class=\"hidden\"></div>\n            \n            <h2>Fine Tuning</h2>\n            <div class=\"form-group\">\n                <label for=\"nudge-position\">Nudge position</label>\n                <input type=\"number\" id=\"nudge-position\" value=\"100\">\n            </div>\n            <div class=\"action-buttons\">\n                <button onclick=\"nudgePosition(true)\">Nudge Forward</button>\n                <button onclick=\"nudgePosition(false)\">Nudge Backward</button>\n            </div>\n            \n            <p>Current detected angle: <span id=\"calibration-current-angle\">-</span>°</p>\n            <div class=\"form-group\">\n                <label for=\"pos-0-degrees\">0° Position (encoder counts)</label>\n                <input type=\"number\" id=\"pos-0-degrees\">\n            </div>\n            <div class=\"form-group\">\n                <label for=\"pos-90-degrees\">90° Position (encoder counts)</label>\n                <input type=\"number\" id=\"pos-90-degrees\">\n            </div>\n            <div class=\"form-group\">\n                <label for=\"pos-180-degrees\">180° Position (encoder counts)</label>\n                <input type=\"number\" id=\"pos-180-degrees\">\n            </div>\n            <div class=\"form-group\">\n                <label for=\"pos-270-degrees\">270° Position (encoder counts)</label>\n                <input type=\"number\" id=\"pos-270-degrees\">\n            </div>\n            <button onclick=\"savePositionSettings()\">Save Position Settings</button>\n        </div>\n        \n        <!-- Motion Control Tab -->\n        <div id=\"motion-control\" class=\"tabcontent\">\n            <h2>Motion Control Configuration</h2>\n            <p>Configure motion control parameters for precise positioning and smooth movement.</p>\n            \n            <div class=\"form-group\">\n                <label for=\"position-hysteresis\">Position Hysteresis (encoder counts)</label>\n                <input type=\"number\" id=\"position-hysteresis\" min=\"1\" max=\"1000\" step=\"1\">\n                <small>Tolerance around target position before stopping (default: 20)</small>\n            </div>\n            \n            <div class=\"form-group\">\n                <label for=\"max-speed\">Maximum Speed (counts/second)</label>\n                <input type=\"number\" id=\"max-speed\" min=\"100\" max=\"20000\" step=\"100\">\n                <small>Maximum rotational speed (default: 6000)</small>\n            </div>\n            \n            <div class=\"form-group\">\n                <label for=\"acceleration\">Acceleration (counts/second²)</label>\n                <input type=\"number\" id=\"acceleration\" min=\"100\" max=\"20000\" step=\"100\">\n                <small>Acceleration/deceleration rate (default: 4000)</small>\n            </div>\n            \n            <h3>PID Controller Gains</h3>\n            <p>Adjust these carefully - small changes can significantly affect performance.</p>\n            \n            <div class=\"form-group\">\n                <label for=\"vel-loop-p\">Proportional Gain (P)</label>\n                <input type=\"text\" id=\"vel-loop-p\" pattern=\"[+-]?([0-9]*[.])?[0-9]+([eE][+-]?[0-9]+)?\">\n                <small>Proportional response to speed error (default: 3e-5)</small>\n            </div>\n            \n            <div class=\"form-group\">\n                <label for=\"vel-loop-i\">Integral Gain (I)</label>\n                <input type=\"text\" id=\"vel-loop-i\" pattern=\"[+-]?([0-9]*[.])?[0-9]+([eE][+-]?[0-9]+)?\">\n                <small>Response to accumulated speed error (default: 6e-3)</small>\n            </div>\n            \n            <div class=\"form-group\">\n                <label for=\"vel-loop-d\">Derivative Gain (D)</label>\n                <input type=\"text\" id=\"vel-loop-d\" pattern=\"[+-]?([0-9]*[.])?[0-9]+([eE][+-]?[0-9]+)?\">\n                <small>Response to rate of speed error change (default: -2e-8)</small>\n            </div>\n            \n            <h3>Filter Settings</h3>\n            \n            <div class=\"form-group\">\n                <label for=\"vel-filter-persistence\">Velocity Filter Persistence</label>\n                <input type=\"number\" id=\"vel-filter-persistence\" min=\"0\" max=\"1\" step=\"0.01\">\n                <small>Velocity smoothing factor, 0=no filtering, 1=maximum filtering (default: 0.0)</small>\n            </div>\n            \n            <div class=\"form-group\">\n                <label for=\"spd-err-persistence\">Speed Error Persistence</label>\n                <input type=\"number\" id=\"spd-err-persistence\" min=\"0\" max=\"1\" step=\"0.01\">\n                <small>Speed error derivative smoothing factor (default: 0.0)</small>\n            </div>\n            \n            <button onclick=\"saveMotionControlSettings()\">Save Motion Control Settings</button>\n            <button onclick=\"resetMotionControlToDefaults()\">Reset to Defaults</button>\n        </div>\n        \n        <!-- Debug Tab -->\n        <div id=\"debug\" class=\"tabcontent\">\n            <h2>Motion Control Debug</h2>\n            <div class=\"debug-controls\">\n                <button id=\"debug-toggle\" onclick=\"toggleDebug()\">Start Debug</button>\n                <button id=\"debug-clear\" onclick=\"clearPlots()\">Clear Plots</button>\n                <div class=\"debug-status\">\n                    Status: <span id=\"debug-status\">Stopped</span> | \n                    Connection: <span id=\"debug-connection\">Disconnected</span> |\n                    Data Points: <span id=\"debug-points\">0</span>\n                </div>\n            </div>\n            \n            <div class=\"plot-container\">\n                <h3>Position Tracking</h3>\n                <canvas id=\"position-plot\" width=\"750\" height=\"250\"></canvas>\n                <div class=\"plot-legend\">\n                    <span class=\"legend-item\"><span class=\"legend-color\" style=\"background-color: #3498db;\"></span>Current Position</span>\n                    <span class=\"legend-item\"><span class=\"legend-color\" style=\"background-color: #2ecc71;\"></span>Current Velocity</span>\n                    <span class=\"legend-item\"><span class=\"legend-color\" style=\"background-color: #e74c3c;\"></span>Target Position</span>\n                </div>\n            </div>\n            \n            <div class=\"plot-container\">\n                <h3>PID Error Terms</h3>\n                <canvas id=\"error-plot\" width=\"750\" height=\"250\"></canvas>\n                <div class=\"plot-legend\">\n                    <span class=\"legend-item\"><span class=\"legend-color\" style=\"background-color: #2ecc71;\"></span>Speed Error</span>\n                    <span class=\"legend-item\"><span class=\"legend-color\" style=\"background-color: #f39c12;\"></span>Error Integral</span>\n                    <span class=\"legend-item\"><span class=\"legend-color\" style=\"background-color: #9b59b6;\"></span>Control PWM Out</span>\n                </div>\n            </div>\n        </div>\n        \n        <!-- Updates Tab -->\n        <div id=\"updates\" class=\"tabcontent\">\n            <h2>OTA Firmware Update</h2>\n            <form id=\"ota-form\" enctype=\"multipart/form-data\">\n                <div class=\"form-group\">\n                    <label for=\"firmware\">Select Firmware File</label>\n                    <input type=\"file\" id=\"firmware\" name=\"firmware\" accept=\".bin\">\n                </div>\n                <button type=\"button\" onclick=\"uploadFirmware()\">Upload Firmware</button>\n            </form>\n            <div id=\"ota-progress\" class=\"hidden\">\n                <div id=\"ota-progress-bar\"></div>\n            </div>\n            <div id=\"ota-status\" class=\"hidden\"></div>\n        </div>\n        \n        <div id=\"loading\" class=\"loading hidden\">\n            <div class=\"loader\"></div>\n            <p>Loading...</p>\n        </div>\n    </div>\n\n    <script>\n        // Global variables\n        let statusUpdateInterval;\n        let currentStatus = {};\n        let configData = null;  // Store config separately from status\n        \n        // Initialize the page\n        document.addEventListener('DOMContentLoaded', function() {\n            fetchStatus();\n            fetchConfig();  // Load config once at startup\n            fetchWiFiStatus(); // Load WiFi status\n            fetchBuildInfo(); // Load build info\n\n            // Setup color picker previews\n            document.getElementById('color-0').addEventListener('input', function() {\n                updateColorPreview('preview-0', this.value);\n            });\n            document.getElementById('color-90').addEventListener('input', function() {\n                updateColorPreview('preview-90', this.value);\n            });\n            document.getElementById('color-180').addEventListener('input', function() {\n                updateColorPreview('preview-180', this.value);\n            });\n            document.getElementById('color-270').addEventListener('input', function() {\n                updateColorPreview('preview-270', this.value);\n            });\n            \n            // Start periodic status updates\n            statusUpdateInterval = setInterval(fetchStatus, 2000);\n        });\n        \n        // Tab handling\n        function openTab(evt, tabName) {\n            let tabcontent = document.getElementsByClassName(\"tabcontent\");\n            for (let i = 0; i < tabcontent.length; i++) {\n                tabcontent[i].classList.remove(\"active-tab\");\n            }\n            \n            let tablinks = document.getElementsByClassName(\"tablinks\");\n            for (let i = 0; i < tablinks.length; i++) {\n                tablinks[i].classList.remove(\"active\");\n            }\n            \n            document.getElementById(tabName).classList.add(\"active-tab\");\n            evt.currentTarget.classList.add(\"active\");\n            \n            // Refresh status when showing certain tabs\n            if (tabName === 'calibration') {\n                fetchStatus();\n            } else if (tabName === 'wifi') {\n                fetchWiFiStatus();\n            }\n        }\n        \n        // Fetch build information\n        function fetchBuildInfo() {\n            fetch('/api/buildinfo')\n                .then(response => {\n                    if (response.ok) {\n                        return response.json();\n                    } else {\n                        throw new Error('Failed to fetch build info');\n                    }\n                })\n                .then(data => {\n                    const buildInfoEl = document.getElementById('buildInfo');\n                    buildInfoEl.textContent = `${data.gitBranch}@${data.gitHash} | Built: ${data.buildTimestamp}`;\n                })\n                .catch(error => {\n                    console.error('Error fetching build info:', error);\n                    document.getElementById('buildInfo').textContent = '';\n                });\n        }\n\n        // Fetch current status from the device\n        function fetchStatus() {\n            fetch('/api/status')\n                .then(response => {\n                    if (response.ok) {\n                        return response.json();\n                    } else {\n                        throw new Error('Failed to fetch status');\n                    }\n                })\n                .then(data => {\n                    currentStatus = data;\n                    updateStatusDisplay(data);\n                })\n                .catch(error => console.error('Error fetching status:', error));\n        }\n\n        // Fetch configuration from the device\n        function fetchConfig() {\n            console.log('Fetching config...');\n            fetch('/api/config')\n                .then(response => {\n                    if (response.ok) {\n                        return response.json();\n                    } else {\n                        throw new Error('Failed to fetch config');\n                    }\n                })\n                .then(data => {\n                    console.log('Config data received:', data);\n                    configData = data;\n                    updateConfigDisplay(data);\n                })\n                .catch(error => {\n                    console.error('Error fetching config:', error);\n                });\n        }\n        \n        // Update only the status display elements\n        function updateStatusDisplay(data) {\n            if (!data) {\n                console.error('No data received in updateStatusDisplay');\n                return;\n            }\n\n            // Update angle and position\n            if (data.currentAngle !== undefined) {\n                document.getElementById('current-angle').textContent = data.currentAngle + '°';\n                document.getElementById('calibration-current-angle').textContent = data.currentAngle;\n            }\n            \n            if (data.currentPosition !== undefined) {\n                document.getElementById('current-position-counts').textContent = data.currentPosition + ' counts';\n            }\n            \n            // Update color display - convert decimal to hex\n            if (data.currentColor !== undefined) {\n                const colorHex = '#' + data.currentColor.toString(16).padStart(6, '0');\n                document.getElementById('current-color').style.backgroundColor = colorHex;\n            }\n            \n            // Update auto rotation status\n            if (data.autoRotationEnabled !== undefined) {\n                document.getElementById('auto-rotation-status').textContent = data.autoRotationEnabled ? 'ON' : 'OFF';\n                document.getElementById('auto-rotation-toggle').checked = data.autoRotationEnabled;\n            }\n\n            if (data.autoRotateforward !== undefined) {\n                document.getElementById('auto-rotate-forward').checked = data.autoRotateForward;\n            }\n\n            // Update auto rotation status\n            if (data.motionActive !== undefined) {\n                document.getElementById('motion-active-status').textContent = data.motionActive ? 'ACTIVE' : 'IDLE';\n            }\n        }\n        \n        // Update only config-related form fields\n        function updateConfigDisplay(data) {\n            console.log('Updating config display with data:', data);\n            \n            try {\n                // Position calibration\n                const pos0 = document.getElementById('pos-0-degrees');\n                const pos90 = document.getElementById('pos-90-degrees');\n                const pos180 = document.getElementById('pos-180-degrees');\n                const pos270 = document.getElementById('pos-270-degrees');\n\n                const full_rotation_count = document.getElementById('full-rotation-count');\n                \n                \n                if (pos0) pos0.value = data.pos_0_degrees;\n                if (pos90) pos90.value = data.pos_90_degrees;\n                if (pos180) pos180.value = data.pos_180_degrees;\n                if (pos270) pos270.value = data.pos_270_degrees;\n                if (full_rotation_count) full_rotation_count.value = data.full_rotation_count;\n\n                \n                // Colors\n                updateColorField('color-0', 'preview-0', data.color_0);\n                updateColorField('color-90', 'preview-90', data.color_90);\n                updateColorField('color-180', 'preview-180', data.color_180);\n                updateColorField('color-270', 'preview-270', data.color_270);\n                \n                // WiFi settings\n                const apSsid = document.getElementById('ap-ssid');\n                const apPassword = document.getElementById('ap-password');\n                \n                console.log('WiFi elements found:', {apSsid, apPassword});\n                \n                if (apSsid) apSsid.value = data.ap_ssid;\n                if (apPassword) apPassword.value = data.ap_password || '';\n                \n                // Rotation interval\n                const rotationInterval = document.getElementById('rotation-interval');\n                console.log('Rotation interval element found:', rotationInterval);\n                \n                if (rotationInterval) rotationInterval.value = data.rotation_interval;\n                \n                // Motion control parameters\n                if (data.position_hysteresis !== undefined) {\n                    const posHysteresis = document.getElementById('position-hysteresis');\n                    if (posHysteresis) posHysteresis.value = data.position_hysteresis;\n                }\n                \n                if (data.max_speed !== undefined) {\n                    const maxSpeed = document.getElementById('max-speed');\n                    if (maxSpeed) maxSpeed.value = data.max_speed;\n                }\n                \n                if (data.acceleration !== undefined) {\n                    const acceleration = document.getElementById('acceleration');\n                    if (acceleration) acceleration.value = data.acceleration;\n                }\n                \n                if (data.vel_loop_p !== undefined) {\n                    const velLoopP = document.getElementById('vel-loop-p');\n                    if (velLoopP) velLoopP.value = data.vel_loop_p.toExponential();\n                }\n                \n                if (data.vel_loop_i !== undefined) {\n                    const velLoopI = document.getElementById('vel-loop-i');\n                    if (velLoopI) velLoopI.value = data.vel_loop_i.toExponential();\n                }\n                \n                if (data.vel_loop_d !== undefined) {\n                    const velLoopD = document.getElementById('vel-loop-d');\n                    if (velLoopD) velLoopD.value = data.vel_loop_d.toExponential();\n                }\n                \n                if (data.vel_filter_persistence !== undefined) {\n                    const velFilterPersistence = document.getElementById('vel-filter-persistence');\n                    if (velFilterPersistence) velFilterPersistence.value = data.vel_filter_persistence;\n                }\n                \n                if (data.spd_err_persistence !== undefined) {\n                    const spdErrPersistence = document.getElementById('spd-err-persistence');\n                    if (spdErrPersistence) spdErrPersistence.value = data.spd_err_persistence;\n                }\n                \n            } catch (error) {\n                console.error('Error in updateConfigDisplay:', error);\n            }\n        }\n        \n        // Update a color input field and its preview\n        function updateColorField(fieldId, previewId, colorValue) {\n            if (colorValue !== undefined) {\n                // Convert decimal to hex and ensure 6 digits with leading zeros\n                const hexColor = '#' + colorValue.toString(16).padStart(6, '0');\n                document.getElementById(fieldId).value = hexColor;\n                updateColorPreview(previewId, hexColor);\n            }\n        }\n        \n        // Update a color preview element\n        function updateColorPreview(previewId, color) {\n            document.getElementById(previewId).style.backgroundColor = color;\n        }\n        \n        // Command a rotation to a specific angle\n        function rotate(angle) {\n            showLoading();\n            \n            const formData = new FormData();\n            formData.append('angle', angle);\n            \n            fetch('/api/rotate', {\n                method: 'POST',\n                body: formData\n            })\n            .then(response => {\n                hideLoading();\n                if (response.ok) {\n                    // Update the status after a short delay to allow rotation to start\n                    setTimeout(fetchStatus, 500);\n                } else {\n                    alert('Failed to command rotation');\n                }\n            })\n            .catch(error => {\n                hideLoading();\n                console.error('Error rotating:', error);\n                alert('Error: ' + error.message);\n            });\n        }\n\n        function nudgePosition(forward) {\n            const nudgeSize = parseInt(document.getElementById('nudge-position').value);\n            const currPos = currentStatus.currentPosition;\n\n            if (isNaN(nudgeSize)) {\n                showGotoStatus('Please enter a valid nudge size', 'error');\n                return;\n            }\n\n            const formData = new FormData();\n            if(forward == true){\n                formData.append('position', currPos + nudgeSize);\n            }\n            else{\n                formData.append('position', currPos - nudgeSize);\n            }\n            \n            fetch('/api/goto', {\n                method: 'POST',\n                body: formData\n            })\n            .then(response => {\n                hideLoading();\n                if (response.ok) {\n                    // Update the status after a short delay to allow rotation to start\n                    setTimeout(fetchStatus, 100);\n                } else {\n                    console.error('Error commanding nudging:', error);\n                    alert('Failed to command rotation');\n                }\n            })\n            .catch(error => {\n                hideLoading();\n                console.error('Error nudging:', error);\n                alert('Error: ' + error.message);\n            });\n        }\n        \n        // Set the current position as the new zero reference point\n        function setZeroPosition() {\n            if (!confirm('This will set the current position as the new zero reference point while maintaining the relative spacing between all calibrated positions. Continue?')) {\n                return;\n            }\n            \n            showLoading();\n            \n            fetch('/api/set-zero', {\n                method: 'POST'\n            })\n            .then(response => {\n                hideLoading();\n                if (response.ok) {\n                    alert('Zero position set successfully! All calibrated positions have been updated.');\n                    fetchConfig(); // Refresh the config to show updated values\n                } else {\n                    alert('Failed to set zero position');\n                }\n            })\n            .catch(error => {\n                hideLoading();\n                console.error('Error setting zero position:', error);\n                alert('Error: ' + error.message);\n            });\n        }\n        \n        // Go to a specific position in encoder counts\n        function gotoPosition() {\n            const positionInput = document.getElementById('goto-position');\n            const gotoButton = document.getElementById('goto-button');\n            const statusDiv = document.getElementById('goto-status');\n            \n            const targetPosition = parseInt(positionInput.value);\n            \n            // Validate input\n            if (isNaN(targetPosition)) {\n                showGotoStatus('Please enter a valid position number', 'error');\n                return;\n            }\n            \n            // Disable button during motion\n            gotoButton.disabled = true;\n            gotoButton.textContent = 'Moving...';\n            showGotoStatus('Moving to position ' + targetPosition + '...', 'info');\n            \n            const formData = new FormData();\n            formData.append('position', targetPosition);\n            \n            fetch('/api/goto', {\n                method: 'POST',\n                body: formData\n            })\n            .then(response => {\n                if (response.ok) {\n                    showGotoStatus('Movement command sent successfully', 'success');\n                    // Update status after a short delay\n                    setTimeout(fetchStatus, 500);\n                    // Re-enable button after a delay\n                    setTimeout(() => {\n                        gotoButton.disabled = false;\n                        gotoButton.textContent = 'Go to Position';\n                    }, 2000);\n                } else {\n                    showGotoStatus('Failed to send movement command', 'error');\n                    gotoButton.disabled = false;\n                    gotoButton.textContent = 'Go to Position';\n                }\n            })\n            .catch(error => {\n                console.error('Error going to position:', error);\n                showGotoStatus('Error: ' + error.message, 'error');\n                gotoButton.disabled = false;\n                gotoButton.textContent = 'Go to Position';\n            });\n        }\n        \n        // Show status message for goto position\n        function showGotoStatus(message, type) {\n            const statusDiv = document.getElementById('goto-status');\n            statusDiv.textContent = message;\n            statusDiv.className = type; // 'success', 'error', or 'info'\n            statusDiv.classList.remove('hidden');\n            \n            // Auto-hide after 5 seconds for success/info messages\n            if (type === 'success' || type === 'info') {\n                setTimeout(() => {\n                    statusDiv.classList.add('hidden');\n                }, 5000);\n            }\n        }\n        \n        // Toggle auto-rotation\n        function toggleAutoRotation() {\n            const enabled = document.getElementById('auto-rotation-toggle').checked;\n            saveSettings({\n                auto_rotation_enabled: enabled\n            });\n        }\n\n        function toggleAutoRotateForward() {\n            const enabled = document.getElementById('auto-rotate-forward').checked;\n            saveSettings({\n                auto_rotate_forward: enabled\n            });\n        }\n        \n        // Save rotation interval\n        function saveRotationInterval() {\n            const interval = parseInt(document.getElementById('rotation-interval').value);\n            if (isNaN(interval) || interval < 5) {\n                alert('Please enter a valid interval (minimum 5 seconds)');\n                return;\n            }\n            \n            saveSettings({\n                rotation_interval: interval\n            });\n        }\n        \n        // Save WiFi settings\n        function saveWifiSettings() {\n            const ssid = document.getElementById('ap-ssid').value.trim();\n            const password = document.getElementById('ap-password').value;\n            \n            if (!ssid) {\n                alert('SSID cannot be empty');\n                return;\n            }\n            \n            saveSettings({\n                ap_ssid: ssid,\n                ap_password: password\n            });\n        }\n        \n        // Save color settings\n        function saveColorSettings() {\n            const color0 = parseInt(document.getElementById('color-0').value.substring(1), 16);\n            const color90 = parseInt(document.getElementById('color-90').value.substring(1), 16);\n            const color180 = parseInt(document.getElementById('color-180').value.substring(1), 16);\n            const color270 = parseInt(document.getElementById('color-270').value.substring(1), 16);\n            \n            saveSettings({\n                color_0: color0,\n                color_90: color90,\n                color_180: color180,\n                color_270: color270\n            });\n        }\n        \n        // Save position settings\n        function savePositionSettings() {\n            const pos0 = parseInt(document.getElementById('pos-0-degrees').value);\n            const pos90 = parseInt(document.getElementById('pos-90-degrees').value);\n            const pos180 = parseInt(document.getElementById('pos-180-degrees').value);\n            const pos270 = parseInt(document.getElementById('pos-270-degrees').value);\n            \n            if (isNaN(pos0) || isNaN(pos90) || isNaN(pos180) || isNaN(pos270)) {\n                alert('All position values must be valid numbers');\n                return;\n            }\n            \n            saveSettings({\n                pos_0_degrees: pos0,\n                pos_90_degrees: pos90,\n                pos_180_degrees: pos180,\n                pos_270_degrees: pos270\n            });\n        }\n        \n        function saveFullRotationSettings() {\n            const full_rotation_count = parseInt(document.getElementById('full-rotation-count').value);\n            \n            if (isNaN(full_rotation_count)) {\n                alert('Full revolution count must be a valid number');\n                return;\n            }\n            \n            saveSettings({\n                full_rotation_count: full_rotation_count,\n            });\n        }\n        \n        // Save motion control settings\n        function saveMotionControlSettings() {\n            // Get basic parameters\n            const positionHysteresis = parseInt(document.getElementById('position-hysteresis').value);\n            const maxSpeed = parseFloat(document.getElementById('max-speed').value);\n            const acceleration = parseFloat(document.getElementById('acceleration').value);\n            \n            // Get PID gains (handle scientific notation)\n            const velLoopP = parseFloat(document.getElementById('vel-loop-p').value);\n            const velLoopI = parseFloat(document.getElementById('vel-loop-i').value);\n            const velLoopD = parseFloat(document.getElementById('vel-loop-d').value);\n            \n            // Get filter settings\n            const velFilterPersistence = parseFloat(document.getElementById('vel-filter-persistence').value);\n            const spdErrPersistence = parseFloat(document.getElementById('spd-err-persistence').value);\n            \n            // Validate inputs\n            if (isNaN(positionHysteresis) || positionHysteresis < 1) {\n                alert('Position hysteresis must be a positive integer');\n                return;\n            }\n            \n            if (isNaN(maxSpeed) || maxSpeed < 100) {\n                alert('Maximum speed must be at least 100 counts/second');\n                return;\n            }\n            \n            if (isNaN(acceleration) || acceleration < 100) {\n                alert('Acceleration must be at least 100 counts/second²');\n                return;\n            }\n            \n            if (isNaN(velLoopP) || isNaN(velLoopI) || isNaN(velLoopD)) {\n                alert('All PID gains must be valid numbers (scientific notation allowed)');\n                return;\n            }\n            \n            if (isNaN(velFilterPersistence) || velFilterPersistence < 0 || velFilterPersistence > 1) {\n                alert('Velocity filter persistence must be between 0 and 1');\n                return;\n            }\n            \n            if (isNaN(spdErrPersistence) || spdErrPersistence < 0 || spdErrPersistence > 1) {\n                alert('Speed error persistence must be between 0 and 1');\n                return;\n            }\n            \n            saveSettings({\n                position_hysteresis: positionHysteresis,\n                max_speed: maxSpeed,\n                acceleration: acceleration,\n                vel_loop_p: velLoopP,\n                vel_loop_i: velLoopI,\n                vel_loop_d: velLoopD,\n                vel_filter_persistence: velFilterPersistence,\n                spd_err_persistence: spdErrPersistence\n            });\n        }\n        \n        // Reset motion control settings to defaults\n        function resetMotionControlToDefaults() {\n            if (!confirm('Reset motion control parameters to default values?')) {\n                return;\n            }\n            \n            // Set default values\n            document.getElementById('position-hysteresis').value = 20;\n            document.getElementById('max-speed').value = 6000;\n            document.getElementById('acceleration').value = 4000;\n            document.getElementById('vel-loop-p').value = '3e-5';\n            document.getElementById('vel-loop-i').value = '6e-3';\n            document.getElementById('vel-loop-d').value = '-2e-8';\n            document.getElementById('vel-filter-persistence').value = 0.0;\n            document.getElementById('spd-err-persistence').value = 0.0;\n            \n            // Save the defaults\n            saveMotionControlSettings();\n        }\n        \n        // Generic settings save function\n        function saveSettings(settings) {\n            showLoading();\n            \n            fetch('/api/settings', {\n                method: 'POST',\n                headers: {\n                    'Content-Type': 'application/json'\n                },\n                body: JSON.stringify(settings)\n            })\n            .then(response => {\n                hideLoading();\n                if (response.ok) {\n                    alert('Settings saved successfully');\n                    fetchConfig();  // Refresh config after save\n                } else {\n                    alert('Failed to save settings');\n                }\n            })\n            .catch(error => {\n                hideLoading();\n                console.error('Error saving settings:', error);\n                alert('Error: ' + error.message);\n            });\n        }\n        \n        // Reset all settings to defaults\n        function resetSettings() {\n            if (!confirm('Are you sure you want to reset all settings to defaults?')) {\n                return;\n            }\n            \n            showLoading();\n            \n            fetch('/api/reset', {\n                method: 'POST'\n            })\n            .then(response => {\n                hideLoading();\n                if (response.ok) {\n                    alert('Settings reset to defaults');\n                    fetchConfig();  // Refresh config after reset\n                } else {\n                    alert('Failed to reset settings');\n                }\n            })\n            .catch(error => {\n                hideLoading();\n                console.error('Error resetting settings:', error);\n                alert('Error: ' + error.message);\n            });\n        }\n        \n        // Upload firmware for OTA update\n        function uploadFirmware() {\n            const fileInput = document.getElementById('firmware');\n            if (!fileInput.files.length) {\n                alert('Please select a firmware file');\n                return;\n            }\n            \n            const file = fileInput.files[0];\n            const formData = new FormData();\n            formData.append('firmware', file);\n            \n            // Show progress elements\n            document.getElementById('ota-progress').classList.remove('hidden');\n            document.getElementById('ota-status').classList.remove('hidden');\n            document.getElementById('ota-status').textContent = 'Starting upload...';\n            \n            // Reset progress bar\n            document.getElementById('ota-progress-bar').style.width = '0%';\n            \n            const xhr = new XMLHttpRequest();\n            xhr.open('POST', '/update', true);\n            \n            xhr.upload.onprogress = function(event) {\n                if (event.lengthComputable) {\n                    const percentComplete = (event.loaded / event.total) * 100;\n                    document.getElementById('ota-progress-bar').style.width = percentComplete + '%';\n                    document.getElementById('ota-status').textContent = 'Uploading: ' + percentComplete.toFixed(1) + '%';\n                }\n            };\n            \n            xhr.onload = function() {\n                if (xhr.status === 200) {\n                    document.getElementById('ota-status').textContent = 'Update successful. Device is rebooting...';\n                    document.getElementById('ota-progress-bar').style.width = '100%';\n                    document.getElementById('ota-progress-bar').style.backgroundColor = '#4CAF50';\n                    \n                    // Stop status updates during reboot\n                    clearInterval(statusUpdateInterval);\n                    \n                    // Try to reconnect after a delay\n                    setTimeout(function() {\n                        document.getElementById('ota-status').textContent = 'Attempting to reconnect...';\n                        attemptReconnect();\n                    }, 10000);\n                } else {\n                    document.getElementById('ota-status').textContent = 'Update failed: ' + xhr.responseText;\n                    document.getElementById('ota-progress-bar').style.backgroundColor = '#F44336';\n                }\n            };\n            \n            xhr.onerror = function() {\n                document.getElementById('ota-status').textContent = 'Update failed due to network error';\n                document.getElementById('ota-progress-bar').style.backgroundColor = '#F44336';\n            };\n            \n            xhr.send(formData);\n        }\n        \n        // Attempt to reconnect after OTA update\n        function attemptReconnect() {\n            fetch('/api/status')\n                .then(response => {\n                    if (response.ok) {\n                        document.getElementById('ota-status').textContent = 'Connected successfully to updated device!';\n                        // Restart status updates\n                        statusUpdateInterval = setInterval(fetchStatus, 2000);\n                        fetchStatus();\n                    } else {\n                        throw new Error('Device not ready');\n                    }\n                })\n                .catch(error => {\n                    document.getElementById('ota-status').textContent = 'Still waiting for device to come online...';\n                    setTimeout(attemptReconnect, 5000);\n                });\n        }\n        \n        // Show loading indicator\n        function showLoading() {\n            document.getElementById('loading').classList.remove('hidden');\n        }\n        \n        // Hide loading indicator\n        function hideLoading() {\n            document.getElementById('loading').classList.add('hidden');\n        }\n        \n        // =============================================================================\n        // WIFI FUNCTIONALITY\n        // =============================================================================\n        \n        // Fetch WiFi status\n        function fetchWiFiStatus() {\n            fetch('/api/wifi/status')\n                .then(response => {\n                    if (response.ok) {\n                        return response.json();\n                    } else {\n                        throw new Error('Failed to fetch WiFi status');\n                    }\n                })\n                .then(data => {\n                    updateWiFiStatusDisplay(data);\n                })\n                .catch(error => console.error('Error fetching WiFi status:', error));\n        }\n        \n        // Update WiFi status display\n        function updateWiFiStatusDisplay(data) {\n            document.getElementById('wifi-status').textContent = data.status || '-';\n            document.getElementById('wifi-ip').textContent = data.ip || '-';\n            document.getElementById('current-wifi-ssid').textContent = data.ssid || 'None';\n            document.getElementById('current-wifi-rssi').textContent = data.rssi + 'dBm' || 'None';\n            document.getElementById('wifi-mdns').textContent = data.mdns_name ? `${data.mdns_name}.local` : '-';\n            \n            // Enable/disable disconnect button based on connection state\n            const disconnectButton = document.getElementById('disconnect-button');\n            disconnectButton.disabled = !data.client_enabled;\n        }\n        \n        // Scan for WiFi networks\n        function scanNetworks() {\n            const scanButton = document.getElementById('scan-button');\n            const scanStatus = document.getElementById('scan-status');\n            const networkSelect = document.getElementById('wifi-network-select');\n            \n            scanButton.disabled = true;\n            scanButton.textContent = 'Scanning...';\n            scanStatus.textContent = 'Starting scan...';\n            scanStatus.className = 'info';\n            scanStatus.classList.remove('hidden');\n            \n            // Clear existing options\n            networkSelect.innerHTML = '<option value=\"\">Select a network...</option>';\n            \n            // Start scan\n            fetch('/api/wifi/scan')\n                .then(response => {\n                    if (response.ok) {\n                        scanStatus.textContent = 'Scanning for networks...';\n                        // Poll for results\n                        pollScanResults();\n                    } else {\n                        throw new Error('Failed to start scan');\n                    }\n                })\n                .catch(error => {\n                    console.error('Error starting scan:', error);\n                    scanStatus.textContent = 'Failed to start scan';\n                    scanStatus.className = 'error';\n                    scanButton.disabled = false;\n                    scanButton.textContent = 'Scan for Networks';\n                });\n        }\n        \n        // Poll for scan results\n        function pollScanResults() {\n            const scanButton = document.getElementById('scan-button');\n            const scanStatus = document.getElementById('scan-status');\n            const networkSelect = document.getElementById('wifi-network-select');\n            \n            fetch('/api/wifi/scan-results')\n                .then(response => {\n                    if (response.status === 202) {\n                        // Still scanning, poll again\n                        scanStatus.textContent = 'Scanning for networks...';\n                        setTimeout(pollScanResults, 1000);\n                        return null; // Don't process further\n                    } else if (response.ok) {\n                        return response.json();\n                    } else {\n                        throw new Error('Scan failed');\n                    }\n                })\n                .then(data => {\n                    // Only process data if we actually got some (not null from 202 response)\n                    if (data === null) {\n                        return; // Exit early for 202 responses\n                    }\n                    \n                    if (data && data.networks && data.networks.length > 0) {\n                        data.networks.forEach(network => {\n                            const option = document.createElement('option');\n                            option.value = network.ssid;\n                            option.textContent = `${network.ssid} (${network.rssi} dBm, ${network.encryption})`;\n                            networkSelect.appendChild(option);\n                        });\n                        scanStatus.textContent = `Found ${data.networks.length} networks`;\n                        scanStatus.className = 'success';\n                        scanButton.disabled = false;\n                        scanButton.textContent = 'Scan for Networks';\n                    } else {\n                        scanStatus.textContent = 'No networks found';\n                        scanStatus.className = 'error';\n                        scanButton.disabled = false;\n                        scanButton.textContent = 'Scan for Networks';\n                    }\n                })\n                .catch(error => {\n                    console.error('Error getting scan results:', error);\n                    scanStatus.textContent = 'Failed to get scan results';\n                    scanStatus.className = 'error';\n                    scanButton.disabled = false;\n                    scanButton.textContent = 'Scan for Networks';\n                });\n        }\n        \n        // Handle network selection\n        function onNetworkSelect() {\n            const networkSelect = document.getElementById('wifi-network-select');\n            const testButton = document.getElementById('test-button');\n            const saveButton = document.getElementById('save-button');\n            \n            if (networkSelect.value) {\n                testButton.disabled = false;\n                saveButton.disabled = false;\n            } else {\n                testButton.disabled = true;\n                saveButton.disabled = true;\n            }\n        }\n        \n        // Test WiFi connection\n        function testConnection() {\n            const networkSelect = document.getElementById('wifi-network-select');\n            const passwordInput = document.getElementById('wifi-password');\n            const testButton = document.getElementById('test-button');\n            const wifiMessage = document.getElementById('wifi-message');\n            \n            const ssid = networkSelect.value;\n            const password = passwordInput.value;\n            \n            if (!ssid) {\n                showWiFiMessage('Please select a network', 'error');\n                return;\n            }\n            \n            testButton.disabled = true;\n            testButton.textContent = 'Testing...';\n            wifiMessage.textContent = 'Testing connection...';\n            wifiMessage.className = 'info';\n            wifiMessage.classList.remove('hidden');\n            \n            const formData = new FormData();\n            formData.append('ssid', ssid);\n            formData.append('password', password);\n            \n            fetch('/api/wifi/test', {\n                method: 'POST',\n                body: formData\n            })\n            .then(response => {\n                if (response.ok) {\n                    showWiFiMessage('Connection test successful!', 'success');\n                } else {\n                    showWiFiMessage('Connection test failed. Check password.', 'error');\n                }\n            })\n            .catch(error => {\n                console.error('Error testing connection:', error);\n                showWiFiMessage('Error testing connection: ' + error.message, 'error');\n            })\n            .finally(() => {\n                testButton.disabled = false;\n                testButton.textContent = 'Test Connection';\n            });\n        }\n        \n        // Save WiFi connection\n        function saveConnection() {\n            const networkSelect = document.getElementById('wifi-network-select');\n            const passwordInput = document.getElementById('wifi-password');\n            const saveButton = document.getElementById('save-button');\n            \n            const ssid = networkSelect.value;\n            const password = passwordInput.value;\n            \n            if (!ssid) {\n                showWiFiMessage('Please select a network', 'error');\n                return;\n            }\n            \n            saveButton.disabled = true;\n            saveButton.textContent = 'Saving...';\n            showWiFiMessage('Saving WiFi credentials...', 'info');\n            \n            const formData = new FormData();\n            formData.append('ssid', ssid);\n            formData.append('password', password);\n            \n            fetch('/api/wifi/connect', {\n                method: 'POST',\n                body: formData\n            })\n            .then(response => {\n                if (response.ok) {\n                    showWiFiMessage('WiFi credentials saved successfully! Device will restart.', 'success');\n                    // Refresh status after a delay\n                    setTimeout(() => {\n                        fetchWiFiStatus();\n                        fetchStatus();\n                    }, 2000);\n                } else {\n                    showWiFiMessage('Failed to save WiFi credentials', 'error');\n                }\n            })\n            .catch(error => {\n                console.error('Error saving connection:', error);\n                showWiFiMessage('Error saving connection: ' + error.message, 'error');\n            })\n            .finally(() => {\n                saveButton.disabled = false;\n                saveButton.textContent = 'Save & Connect';\n            });\n        }\n        \n        // Disconnect WiFi\n        function disconnectWiFi() {\n            if (!confirm('Are you sure you want to disconnect and clear WiFi credentials?')) {\n                return;\n            }\n            \n            const disconnectButton = document.getElementById('disconnect-button');\n            disconnectButton.disabled = true;\n            disconnectButton.textContent = 'Disconnecting...';\n            showWiFiMessage('Disconnecting WiFi...', 'info');\n            \n            fetch('/api/wifi/disconnect', {\n                method: 'POST'\n            })\n            .then(response => {\n                if (response.ok) {\n                    showWiFiMessage('WiFi disconnected and credentials cleared', 'success');\n                    // Refresh status\n                    setTimeout(() => {\n                        fetchWiFiStatus();\n                        fetchStatus();\n                    }, 1000);\n                } else {\n                    showWiFiMessage('Failed to disconnect WiFi', 'error');\n                }\n            })\n            .catch(error => {\n                console.error('Error disconnecting WiFi:', error);\n                showWiFiMessage('Error disconnecting WiFi: ' + error.message, 'error');\n            })\n            .finally(() => {\n                disconnectButton.disabled = false;\n                disconnectButton.textContent = 'Disconnect & Clear';\n            });\n        }\n        \n        // Show WiFi message\n        function showWiFiMessage(message, type) {\n            const wifiMessage = document.getElementById('wifi-message');\n            wifiMessage.textContent = message;\n            wifiMessage.className = type;\n            wifiMessage.classList.remove('hidden');\n            \n            // Auto-hide success/info messages after 5 seconds\n            if (type === 'success' || type === 'info') {\n                setTimeout(() => {\n                    wifiMessage.classList.add('hidden');\n                }, 5000);\n            }\n        }\n        \n        // =============================================================================\n        // DEBUG FUNCTIONALITY\n        // =============================================================================\n        \n        // Debug state variables\n        let debugActive = false;\n        let debugWebSocket = null;\n        let debugDataBuffer = [];\n        let debugTimer = null;\n        let debugStartTime = Date.now();\n        \n        // Plot configuration\n        const PLOT_BUFFER_SIZE = 1000;  // Maximum data points to keep\n        const PLOT_WINDOW_SECONDS = 100; // Seconds of data to display\n        const PLOT_UPDATE_RATE = 100;   // ms between plot updates\n        \n        // Colors for plotting\n        const PLOT_COLORS = {\n            currentPosition: '#3498db',\n            currentVelocity: '#2ecc71',\n            targetPosition: '#e74c3c',\n            speedError: '#2ecc71',\n            errorIntegral: '#f39c12',\n            errorDerivative: '#9b59b6',\n            controlPWMOut: '#9b59b6'\n        };\n        \n        // Toggle debug on/off\n        function toggleDebug() {\n            if (debugActive) {\n                stopDebug();\n            } else {\n                startDebug();\n            }\n        }\n        \n        // Start debug data collection and plotting\n        function startDebug() {\n            debugActive = true;\n            debugStartTime = Date.now();\n            \n            // Update UI\n            document.getElementById('debug-toggle').textContent = 'Stop Debug';\n            document.getElementById('debug-status').textContent = 'Starting...';\n            \n            // Connect to WebSocket\n            connectDebugWebSocket();\n            \n            // Start plot update timer\n            debugTimer = setInterval(updatePlots, PLOT_UPDATE_RATE);\n            \n            console.log('Debug started');\n        }\n        \n        // Stop debug data collection and plotting\n        function stopDebug() {\n            debugActive = false;\n            \n            // Update UI\n            document.getElementById('debug-toggle').textContent = 'Start Debug';\n            document.getElementById('debug-status').textContent = 'Stopped';\n            document.getElementById('debug-connection').textContent = 'Disconnected';\n            \n            // Stop timers\n            if (debugTimer) {\n                clearInterval(debugTimer);\n                debugTimer = null;\n            }\n            \n            // Disconnect WebSocket\n            disconnectDebugWebSocket();\n            \n            console.log('Debug stopped');\n        }\n        \n        // Clear all plot data\n        function clearPlots() {\n            debugDataBuffer = [];\n            debugStartTime = Date.now();\n            updatePlots();\n            updateDebugStats();\n        }\n        \n        // Update debug statistics display\n        function updateDebugStats() {\n            document.getElementById('debug-points').textContent = debugDataBuffer.length;\n        }\n        \n        // =============================================================================\n        // WEBSOCKET IMPLEMENTATION\n        // =============================================================================\n        \n        function connectDebugWebSocket() {\n            try {\n                // Construct WebSocket URL\n                const protocol = window.location.protocol === 'https:' ? 'wss:' : 'ws:';\n                const wsUrl = protocol + '//' + window.location.host + '/ws/debug';\n                \n                console.log('Connecting to WebSocket:', wsUrl);\n                document.getElementById('debug-connection').textContent = 'Connecting...';\n                \n                debugWebSocket = new WebSocket(wsUrl);\n                debugWebSocket.onopen = onDebugWebSocketOpen;\n                debugWebSocket.onmessage = onDebugWebSocketMessage;\n                debugWebSocket.onclose = onDebugWebSocketClose;\n                debugWebSocket.onerror = onDebugWebSocketError;\n                \n            } catch (error) {\n                console.error('Failed to create WebSocket:', error);\n                document.getElementById('debug-connection').textContent = 'Connection Failed';\n                document.getElementById('debug-status').textContent = 'Error';\n            }\n        }\n        \n        function disconnectDebugWebSocket() {\n            if (debugWebSocket) {\n                console.log('Disconnecting WebSocket');\n                \n                // Send stop command to backend before disconnecting\n                if (debugWebSocket.readyState === WebSocket.OPEN) {\n                    debugWebSocket.send('stop');\n                }\n                \n                debugWebSocket.close();\n                debugWebSocket = null;\n            }\n        }\n        \n        function onDebugWebSocketOpen(event) {\n            console.log('WebSocket connected');\n            document.getElementById('debug-connection').textContent = 'Connected';\n            document.getElementById('debug-status').textContent = 'Running';\n            \n            // Send start debug command to backend (plain string, not JSON)\n            if (debugWebSocket && debugWebSocket.readyState === WebSocket.OPEN) {\n                debugWebSocket.send('start');\n            }\n        }\n        \n        function onDebugWebSocketMessage(event) {\n            try {\n                const data = JSON.parse(event.data);\n                \n                // Validate required fields - all must come from backend\n                if (data.timestamp !== undefined && \n                    data.currentPosition !== undefined && \n                    data.targetPosition !== undefined &&\n                    data.speedError !== undefined &&\n                    data.errorIntegral !== undefined &&\n                    data.errorDerivative !== undefined &&\n                    data.controlPWMOut !== undefined) {\n                    \n                    // Use backend timestamp as-is (millis() since microcontroller boot)\n                    // Do NOT mix with Date.now() as they are different time references\n                    addDebugDataPoint(data);\n                } else {\n                    console.warn('Invalid debug data received (missing required fields):', data);\n                    console.warn('Expected fields: timestamp, currentPosition, targetPosition, speedError, errorIntegral, errorDerivative');\n                }\n                \n            } catch (error) {\n                console.error('Failed to parse WebSocket message:', error, event.data);\n            }\n        }\n        \n        function onDebugWebSocketClose(event) {\n            console.log('WebSocket disconnected:', event.code, event.reason);\n            document.getElementById('debug-connection').textContent = 'Disconnected';\n            \n            if (debugActive) {\n                // Attempt to reconnect if debug is still active\n                setTimeout(() => {\n                    if (debugActive) {\n                        console.log('Attempting to reconnect WebSocket...');\n                        connectDebugWebSocket();\n                    }\n                }, 2000);\n            }\n        }\n        \n        function onDebugWebSocketError(event) {\n            console.error('WebSocket error:', event);\n            document.getElementById('debug-connection').textContent = 'Error';\n        }\n        \n        // =============================================================================\n        // DATA MANAGEMENT\n        // =============================================================================\n        \n        // Add a new data point to the buffer\n        function addDebugDataPoint(dataPoint) {\n            debugDataBuffer.push(dataPoint);\n            \n            // Limit buffer size\n            if (debugDataBuffer.length > PLOT_BUFFER_SIZE) {\n                debugDataBuffer.shift();\n            }\n            \n            updateDebugStats();\n        }\n        \n        // Get data points within the display window\n        function getDisplayData() {\n            if (debugDataBuffer.length === 0) return [];\n            \n            // Use the most recent data point's timestamp as reference\n            // (backend sends millis() since boot, not Unix timestamp)\n            const mostRecentTimestamp = debugDataBuffer[debugDataBuffer.length - 1].timestamp;\n            const windowStart = mostRecentTimestamp - (PLOT_WINDOW_SECONDS * 1000);\n            \n            return debugDataBuffer.filter(point => point.timestamp >= windowStart);\n        }\n        \n        // =============================================================================\n        // PLOTTING FUNCTIONS\n        // =============================================================================\n        \n        // Update both plots\n        function updatePlots() {\n            updatePositionPlot();\n            updateErrorPlot();\n        }\n        \n        // Update the position tracking plot\n        function updatePositionPlot() {\n            const canvas = document.getElementById('position-plot');\n            const ctx = canvas.getContext('2d');\n            const data = getDisplayData();\n            \n            if (data.length === 0) {\n                clearCanvas(ctx, canvas);\n                return;\n            }\n            \n            // Clear canvas\n            clearCanvas(ctx, canvas);\n            \n            // Draw grid\n            drawGrid(ctx, canvas);\n            \n            // Calculate scales using backend timestamps (millis() since boot)\n            const timeRange = PLOT_WINDOW_SECONDS * 1000;\n            const mostRecentTimestamp = data[data.length - 1].timestamp;\n            const timeStart = mostRecentTimestamp - timeRange;\n            \n            const positions = data.flatMap(d => [d.currentPosition, d.targetPosition]);\n            const posMin = Math.min(...positions);\n            const posMax = Math.max(...positions);\n            const posRange = posMax - posMin || 100;\n            const posMargin = posRange * 0.1;\n            \n            // Draw position lines\n            drawLine(ctx, canvas, data, 'currentPosition', PLOT_COLORS.currentPosition, \n                    timeStart, timeRange, posMin - posMargin, posRange + 2 * posMargin);\n            drawLine(ctx, canvas, data, 'currentVelocity', PLOT_COLORS.currentVelocity, \n                    timeStart, timeRange, posMin - posMargin, posRange + 2 * posMargin);\n            drawLine(ctx, canvas, data, 'targetPosition', PLOT_COLORS.targetPosition, \n                    timeStart, timeRange, posMin - posMargin, posRange + 2 * posMargin);\n            \n            // Draw axis labels\n            drawAxisLabels(ctx, canvas, 'Time (s)', 'Position (counts)');\n        }\n        \n        // Update the error terms plot\n        function updateErrorPlot() {\n            const canvas = document.getElementById('error-plot');\n            const ctx = canvas.getContext('2d');\n            const data = getDisplayData();\n            \n            if (data.length === 0) {\n                clearCanvas(ctx, canvas);\n                return;\n            }\n            \n            // Clear canvas\n            clearCanvas(ctx, canvas);\n            \n            // Draw grid\n            drawGrid(ctx, canvas);\n            \n            // Calculate scales using backend timestamps (millis() since boot)\n            const timeRange = PLOT_WINDOW_SECONDS * 1000;\n            const mostRecentTimestamp = data[data.length - 1].timestamp;\n            const timeStart = mostRecentTimestamp - timeRange;\n            \n            const errors = data.flatMap(d => [d.speedError, d.errorIntegral, d.controlPWMOut]);//, d.errorDerivative]);\n            const errorMin = Math.min(...errors);\n            const errorMax = Math.max(...errors);\n            const errorRange = errorMax - errorMin || 1;\n            const errorMargin = errorRange * 0.1;\n            \n            // Draw error lines\n            drawLine(ctx, canvas, data, 'speedError', PLOT_COLORS.speedError, \n                    timeStart, timeRange, errorMin - errorMargin, errorRange + 2 * errorMargin);\n            drawLine(ctx, canvas, data, 'errorIntegral', PLOT_COLORS.errorIntegral, \n                    timeStart, timeRange, errorMin - errorMargin, errorRange + 2 * errorMargin);\n            drawLine(ctx, canvas, data, 'controlPWMOut', PLOT_COLORS.controlPWMOut, \n                   timeStart, timeRange, errorMin - errorMargin, errorRange + 2 * errorMargin);\n            \n            // Draw axis labels\n            drawAxisLabels(ctx, canvas, 'Time (s)', 'Error Terms');\n        }\n        \n        // Clear canvas with white background\n        function clearCanvas(ctx, canvas) {\n            ctx.fillStyle = '#ffffff';\n            ctx.fillRect(0, 0, canvas.width, canvas.height);\n        }\n        \n        // Draw grid lines\n        function drawGrid(ctx, canvas) {\n            ctx.strokeStyle = '#f0f0f0';\n            ctx.lineWidth = 1;\n            \n            // Vertical grid lines\n            for (let x = 0; x <= canvas.width; x += canvas.width / 10) {\n                ctx.beginPath();\n                ctx.moveTo(x, 0);\n                ctx.lineTo(x, canvas.height);\n                ctx.stroke();\n            }\n            \n            // Horizontal grid lines\n            for (let y = 0; y <= canvas.height; y += canvas.height / 6) {\n                ctx.beginPath();\n                ctx.moveTo(0, y);\n                ctx.lineTo(canvas.width, y);\n                ctx.stroke();\n            }\n        }\n        \n        // Draw a data line\n        function drawLine(ctx, canvas, data, property, color, timeStart, timeRange, valueMin, valueRange) {\n            if (data.length < 2) return;\n            \n            ctx.strokeStyle = color;\n            ctx.lineWidth = 2;\n            ctx.beginPath();\n            \n            let firstPoint = true;\n            for (const point of data) {\n                const x = ((point.timestamp - timeStart) / timeRange) * canvas.width;\n                const y = canvas.height - (((point[property] - valueMin) / valueRange) * canvas.height);\n                \n                if (firstPoint) {\n                    ctx.moveTo(x, y);\n                    firstPoint = false;\n                } else {\n                    ctx.lineTo(x, y);\n                }\n            }\n            \n            ctx.stroke();\n        }\n        \n        // Draw axis labels\n        function drawAxisLabels(ctx, canvas, xLabel, yLabel) {\n            ctx.fillStyle = '#666';\n            ctx.font = '12px Arial';\n            ctx.textAlign = 'center';\n            \n            // X-axis label\n            ctx.fillText(xLabel, canvas.width / 2, canvas.height - 5);\n            \n            // Y-axis label (rotated)\n            ctx.save();\n            ctx.translate(15, canvas.height / 2);\n            ctx.rotate(-Math.PI / 2);\n            ctx.fillText(yLabel, 0, 0);\n            ctx.restore();\n        }\n    </script>\n</body>\n</html> ";
+// Minified, gzip-compressed HTML for the web UI (stored in flash memory)
+const uint8_t html_index_gz[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x7d, 0x6b, 0x77, 0x1b, 0x37,
+    0x92, 0xe8, 0x77, 0xfd, 0x0a, 0x44, 0xb9, 0x33, 0x24, 0x63, 0x92, 0xe2, 0x43, 0xa4, 0x44, 0xc9,
+    0x52, 0xc6, 0xb1, 0xec, 0xb1, 0x77, 0x63, 0x5b, 0xc7, 0x52, 0xc6, 0x7b, 0xd7, 0xc7, 0xd7, 0x69,
+    0x76, 0x83, 0x52, 0xc7, 0x24, 0x9b, 0xdb, 0xdd, 0xd4, 0x63, 0x12, 0xed, 0x6f, 0xda, 0xb3, 0x3f,
+    0x61, 0x7e, 0xd9, 0xad, 0x2a, 0x3c, 0x1a, 0x40, 0xa3, 0x49, 0x4a, 0x72, 0x32, 0x7b, 0xcf, 0xb9,
+    0x93, 0x33, 0x56, 0x13, 0x0d, 0xd4, 0x0b, 0x85, 0x42, 0xa1, 0x00, 0x54, 0x3f, 0xfd, 0xe6, 0xe4,
+    0xdd, 0xf3, 0xf3, 0xff, 0x7d, 0xfa, 0x82, 0x5d, 0xe6, 0xb3, 0xe9, 0xf1, 0xd6, 0x53, 0xfc, 0xc3,
+    0xa6, 0xc1, 0xfc, 0xe2, 0x68, 0x9b, 0xcf, 0xb7, 0xb1, 0x80, 0x07, 0x11, 0xfc, 0x99, 0xf1, 0x3c,
+    0x60, 0xe1, 0x65, 0x90, 0x66, 0x3c, 0x3f, 0xda, 0xfe, 0xe9, 0xfc, 0x65, 0x6b, 0x7f, 0x5b, 0x15,
+    0xcf, 0x83, 0x19, 0x3f, 0xda, 0xbe, 0x8a, 0xf9, 0xf5, 0x22, 0x49, 0xf3, 0x6d, 0x16, 0x26, 0xf3,
+    0x9c, 0xcf, 0xa1, 0xda, 0x75, 0x1c, 0xe5, 0x97, 0x47, 0x11, 0xbf, 0x8a, 0x43, 0xde, 0xa2, 0x1f,
+    0x4d, 0x16, 0xcf, 0xe3, 0x3c, 0x0e, 0xa6, 0xad, 0x2c, 0x0c, 0xa6, 0xfc, 0xa8, 0xdb, 0xee, 0x20,
+    0x98, 0x3c, 0xce, 0xa7, 0xfc, 0xf8, 0x7d, 0x92, 0x07, 0x79, 0x92, 0xb2, 0xe7, 0xd0, 0x3e, 0x4d,
+    0xa6, 0x4f, 0x77, 0x44, 0xf1, 0xd6, 0xd3, 0x2c, 0xbf, 0xc5, 0xbf, 0xe3, 0x24, 0xba, 0x65, 0xbf,
+    0x6e, 0x4d, 0xe0, 0x75, 0x6b, 0x12, 0xcc, 0xe2, 0xe9, 0xed, 0x01, 0x7b, 0x96, 0x02, 0xb0, 0x26,
+    0xcb, 0x82, 0x79, 0xd6, 0xca, 0x78, 0x1a, 0x4f, 0x0e, 0xb7, 0x66, 0x41, 0x7a, 0x11, 0xcf, 0x0f,
+    0x58, 0xe7, 0x70, 0x6b, 0x11, 0x44, 0x51, 0x3c, 0xbf, 0xa0, 0xe7, 0x71, 0x10, 0x7e, 0xb9, 0x48,
+    0x93, 0xe5, 0x3c, 0x6a, 0x85, 0xc9, 0x34, 0x49, 0x0f, 0xd8, 0xb7, 0x93, 0x5d, 0xfc, 0xef, 0x70,
+    0x4b, 0xfd, 0xee, 0xf7, 0xfb, 0x87, 0x5b, 0x77, 0x5b, 0x6d, 0x64, 0x20, 0x88, 0xe7, 0x3c, 0x05,
+    0x6c, 0xb3, 0xe0, 0x46, 0x90, 0x7e, 0xc0, 0xf6, 0x3b, 0x9d, 0xc5, 0x8d, 0x01, 0x9f, 0x05, 0xcb,
+    0x3c, 0x31, 0x90, 0xf4, 0xe8, 0xf5, 0xdd, 0x16, 0x8a, 0x8c, 0xda, 0x7a, 0x50, 0xf6, 0xc2, 0x3e,
+    0x1f, 0x74, 0x34, 0xca, 0xeb, 0xcb, 0x38, 0xe7, 0x06, 0x88, 0x2e, 0x80, 0x40, 0x62, 0x73, 0x7e,
+    0x93, 0xb7, 0x82, 0x69, 0x7c, 0x01, 0x78, 0x42, 0x90, 0x25, 0x4f, 0x15, 0xde, 0xd6, 0x38, 0xc9,
+    0xf3, 0x64, 0x66, 0x60, 0xeb, 0x12, 0x95, 0x9a, 0x67, 0xa0, 0x7f, 0xbc, 0x8c, 0xa7, 0x51, 0x2b,
+    0x9e, 0x4f, 0x12, 0x25, 0xae, 0x2c, 0xfe, 0x3b, 0x07, 0xe8, 0x3d, 0x6c, 0xa2, 0x48, 0x19, 0x47,
+    0x61, 0x3f, 0xdc, 0xd3, 0x70, 0xf3, 0x64, 0x71, 0xc0, 0x06, 0x58, 0xc1, 0x12, 0xf0, 0x2c, 0x99,
+    0x27, 0xd9, 0x22, 0x08, 0xb9, 0x90, 0x4c, 0x90, 0x46, 0x5e, 0xc6, 0x24, 0x23, 0xe3, 0x24, 0x05,
+    0xd6, 0x5b, 0x69, 0x10, 0xc5, 0xcb, 0x4c, 0x82, 0x1b, 0x27, 0x37, 0xad, 0xec, 0x32, 0x88, 0x92,
+    0x6b, 0x94, 0x19, 0x90, 0x80, 0xc5, 0x2c, 0xbd, 0x18, 0x07, 0xf5, 0x4e, 0x93, 0xfe, 0x6b, 0x77,
+    0x1b, 0x25, 0x31, 0x56, 0x70, 0xdb, 0xce, 0x40, 0x47, 0x96, 0x19, 0xd0, 0x10, 0xc5, 0xd9, 0x62,
+    0x1a, 0x00, 0x85, 0x93, 0x29, 0x87, 0x57, 0xbf, 0x2c, 0xb3, 0x3c, 0x9e, 0xdc, 0xb6, 0xa4, 0xf2,
+    0x1d, 0x30, 0x22, 0xba, 0x35, 0xe6, 0xf9, 0x35, 0xe7, 0xf3, 0x12, 0xbc, 0xee, 0xc0, 0x82, 0xd7,
+    0x02, 0xea, 0x67, 0x00, 0xd4, 0x27, 0x77, 0x84, 0x0f, 0x0d, 0xcc, 0xda, 0x57, 0xc1, 0x74, 0xc9,
+    0x6d, 0xd9, 0xf6, 0x76, 0xb5, 0xe8, 0xae, 0x79, 0x7c, 0x71, 0x09, 0x14, 0x8c, 0x93, 0x69, 0x44,
+    0xad, 0x82, 0x30, 0x8f, 0x13, 0xc0, 0xbd, 0x04, 0xdc, 0x73, 0x8b, 0xf6, 0x8b, 0x34, 0x86, 0x2a,
+    0xf8, 0x6f, 0x0b, 0x08, 0x80, 0xb2, 0x9c, 0xa3, 0x44, 0x97, 0xb3, 0x39, 0x48, 0x2f, 0xe5, 0x0b,
+    0x1e, 0xe4, 0xf5, 0x5e, 0x93, 0x75, 0x27, 0x29, 0x48, 0xe8, 0x22, 0x58, 0x08, 0x0d, 0xa9, 0xe4,
+    0x46, 0x60, 0x00, 0x04, 0x96, 0x42, 0xa9, 0x6e, 0x39, 0x60, 0xf3, 0x64, 0x5e, 0xd5, 0x49, 0x65,
+    0x55, 0xed, 0xef, 0x8e, 0xf6, 0xa3, 0xb1, 0xab, 0xaa, 0xe1, 0x32, 0xcd, 0xf0, 0xe7, 0x22, 0x89,
+    0xa5, 0x78, 0x0c, 0xfd, 0x1a, 0x9a, 0x64, 0x1c, 0x5c, 0x26, 0x57, 0x95, 0xc3, 0x60, 0xb4, 0xdf,
+    0x19, 0x8f, 0x48, 0x38, 0x93, 0x24, 0x9d, 0xb5, 0xf0, 0xf5, 0x42, 0xeb, 0x71, 0x89, 0xaf, 0x69,
+    0x30, 0xe6, 0x53, 0x53, 0x6e, 0xe3, 0x69, 0x12, 0x7e, 0x29, 0x89, 0x61, 0x50, 0xd9, 0x05, 0xf1,
+    0x7c, 0xb1, 0xcc, 0xc1, 0x4c, 0xf0, 0x29, 0x0f, 0x73, 0x00, 0x24, 0x47, 0x74, 0xb7, 0xd3, 0xf9,
+    0x93, 0xa1, 0x79, 0xfb, 0xa6, 0xac, 0xba, 0xa0, 0xa4, 0x59, 0x32, 0x8d, 0x23, 0xf6, 0x6d, 0x14,
+    0x45, 0x25, 0xa9, 0xed, 0x4a, 0xfd, 0x21, 0x8e, 0x5a, 0x8b, 0x94, 0xa3, 0xfd, 0x2b, 0x20, 0xf7,
+    0x49, 0xee, 0x97, 0x92, 0x0c, 0xf1, 0x4b, 0x53, 0x1f, 0xcf, 0xa7, 0x60, 0x5d, 0x5a, 0x36, 0x13,
+    0x53, 0x3e, 0xc9, 0xdd, 0xfe, 0x32, 0x68, 0x08, 0xc3, 0xf0, 0x70, 0x0b, 0xe4, 0x99, 0xc7, 0x60,
+    0x38, 0x95, 0x8a, 0xce, 0xe2, 0x28, 0x9a, 0x8a, 0x91, 0x99, 0x07, 0x63, 0xc0, 0x8e, 0x12, 0x9f,
+    0x4c, 0x71, 0xa4, 0x5d, 0xc2, 0x2b, 0xd4, 0xfb, 0x2a, 0x50, 0x3e, 0x73, 0xd8, 0xc5, 0xff, 0x7c,
+    0xfa, 0x41, 0xff, 0xef, 0x48, 0xeb, 0x82, 0x98, 0xb4, 0xa2, 0x95, 0xc1, 0xc4, 0xf3, 0x4b, 0xb0,
+    0xc3, 0x39, 0x8e, 0x9b, 0x24, 0x00, 0x8e, 0x90, 0x2f, 0x57, 0x03, 0x93, 0x65, 0x8e, 0x12, 0x50,
+    0x3f, 0x4b, 0x3a, 0x55, 0xa8, 0x2f, 0x88, 0x59, 0xaa, 0x55, 0x9e, 0x82, 0x8d, 0x8f, 0x71, 0x20,
+    0x81, 0x19, 0x69, 0xf7, 0xb3, 0xb2, 0xd9, 0x2e, 0x08, 0x5b, 0xa5, 0x7a, 0xd4, 0x99, 0x56, 0x6d,
+    0x1a, 0x9f, 0x57, 0xdc, 0x5f, 0xdd, 0x3f, 0x0a, 0x44, 0x7b, 0x69, 0x6b, 0x4c, 0xc5, 0x14, 0x0c,
+    0x39, 0xb6, 0xac, 0xb2, 0x0f, 0x84, 0xa0, 0xc9, 0xf2, 0x7a, 0x87, 0x26, 0x88, 0x5c, 0x89, 0xff,
+    0xb0, 0xda, 0xe8, 0x4a, 0x0b, 0x73, 0xc5, 0x5b, 0x42, 0x09, 0xdc, 0x51, 0x02, 0xef, 0xa1, 0x2b,
+    0x90, 0xa0, 0x0a, 0x0b, 0xa7, 0x66, 0x8f, 0x9e, 0x9c, 0x7d, 0x64, 0x03, 0x21, 0x41, 0x49, 0xfb,
+    0xa0, 0xa0, 0x7d, 0xd2, 0xc7, 0xff, 0x6c, 0xf2, 0x8d, 0xd7, 0x4a, 0x62, 0xae, 0x1a, 0xe1, 0x50,
+    0x93, 0xa3, 0x63, 0x60, 0x8d, 0x0e, 0xf1, 0x2b, 0x98, 0xc7, 0xb3, 0x40, 0x74, 0x6f, 0xb6, 0x88,
+    0xe7, 0xac, 0x97, 0x31, 0xd4, 0x91, 0x20, 0x05, 0x8d, 0x9a, 0xa0, 0xd7, 0xc0, 0xcb, 0x53, 0xef,
+    0xdd, 0xd6, 0x5f, 0xbe, 0xf0, 0xdb, 0x49, 0x0a, 0x0e, 0x48, 0x26, 0x5a, 0xfd, 0xba, 0xd5, 0xf9,
+    0x13, 0xfb, 0x95, 0x91, 0xb2, 0xa0, 0x65, 0x01, 0x2b, 0x8a, 0x5e, 0x05, 0xaf, 0x77, 0x22, 0x7e,
+    0xd1, 0x38, 0x64, 0x77, 0x5b, 0x38, 0xe6, 0xbd, 0x35, 0xfa, 0x43, 0x5d, 0x07, 0x04, 0x20, 0xc6,
+    0x4f, 0xb9, 0x6b, 0xef, 0xb6, 0xbe, 0x85, 0xea, 0x2d, 0x6c, 0x59, 0xd8, 0x2b, 0x12, 0x81, 0x9a,
+    0xa2, 0xe8, 0xfd, 0x22, 0x4d, 0x2e, 0x52, 0x9e, 0x65, 0xae, 0xad, 0x51, 0x3c, 0x4b, 0xc5, 0xf0,
+    0x0c, 0x42, 0x29, 0x5c, 0x13, 0xb2, 0x69, 0x14, 0x6c, 0xb3, 0x5d, 0x1e, 0xef, 0x0e, 0xfe, 0xd6,
+    0x38, 0xc0, 0x5e, 0x54, 0x68, 0x05, 0x11, 0x92, 0x22, 0x7c, 0xf4, 0x50, 0xb0, 0xfb, 0xfc, 0xd9,
+    0x4b, 0x74, 0x51, 0xcc, 0x01, 0x47, 0x2d, 0xe4, 0xb0, 0x93, 0x18, 0xf4, 0x44, 0x5c, 0xa6, 0xd4,
+    0x6b, 0x82, 0x77, 0xbe, 0x63, 0x67, 0xa2, 0x09, 0x74, 0x56, 0x16, 0x5c, 0x70, 0x46, 0x6e, 0x5d,
+    0xc6, 0xbe, 0xdb, 0x81, 0x79, 0x75, 0x19, 0x86, 0x42, 0x5a, 0x2e, 0x15, 0x3e, 0x11, 0x75, 0x26,
+    0xfb, 0x93, 0x8e, 0x77, 0x58, 0xa9, 0x56, 0xde, 0xf9, 0xcf, 0xb6, 0xdd, 0x65, 0xb2, 0xa1, 0xd7,
+    0x79, 0x9a, 0x26, 0xa9, 0x41, 0xc5, 0xcb, 0xdd, 0xdd, 0x7e, 0x7f, 0xe8, 0xa7, 0x22, 0x02, 0x3a,
+    0xfc, 0x54, 0xa8, 0x56, 0x0f, 0xa5, 0x42, 0x7a, 0x6e, 0x7a, 0xb2, 0xec, 0x8e, 0x86, 0x2f, 0xfb,
+    0x55, 0xa2, 0xd8, 0x9d, 0x4c, 0xbc, 0x44, 0xa8, 0x56, 0x0f, 0x24, 0x02, 0xba, 0xeb, 0x84, 0x8f,
+    0x97, 0x17, 0x0c, 0x6d, 0x8a, 0xd1, 0x53, 0x11, 0x16, 0x92, 0x97, 0x05, 0x2e, 0x7a, 0x56, 0x9e,
+    0xb2, 0x85, 0x62, 0x17, 0x48, 0xab, 0xbc, 0x0b, 0xe8, 0xc2, 0xd1, 0x24, 0xf0, 0x6b, 0xf5, 0x5d,
+    0x09, 0x8d, 0x9e, 0x6f, 0x24, 0xb6, 0x54, 0xa9, 0xb3, 0xcf, 0x19, 0xea, 0x58, 0x30, 0xd6, 0xe9,
+    0xa9, 0x74, 0x5d, 0x76, 0x4d, 0xd7, 0x78, 0x38, 0x1c, 0x12, 0x84, 0xc5, 0x34, 0xc9, 0x5b, 0xf6,
+    0x6a, 0xc0, 0x42, 0xd5, 0xdf, 0x8c, 0xd9, 0xc7, 0x3b, 0xc7, 0xa5, 0x71, 0xce, 0xa0, 0x7f, 0x4e,
+    0xc1, 0xe9, 0xc0, 0xe9, 0x47, 0x4d, 0x43, 0x93, 0x34, 0x99, 0x31, 0x55, 0x13, 0xad, 0x3d, 0xf4,
+    0x57, 0x99, 0x89, 0xcb, 0xbe, 0x23, 0x8b, 0x4e, 0x85, 0x3b, 0xe9, 0x2e, 0x59, 0xca, 0xa0, 0xc2,
+    0x60, 0x7e, 0x15, 0x64, 0xc6, 0x24, 0xb1, 0xc6, 0x67, 0xea, 0x5b, 0x5e, 0x90, 0xe5, 0xfe, 0x14,
+    0x36, 0xdd, 0x58, 0x70, 0x91, 0xb5, 0x42, 0x4e, 0xdf, 0x04, 0x5f, 0xb8, 0xc2, 0x06, 0x56, 0x6d,
+    0x01, 0x5e, 0x34, 0x4e, 0xd8, 0xc0, 0x9f, 0x32, 0x6c, 0xd4, 0x56, 0x54, 0x8d, 0x89, 0x3c, 0x16,
+    0x64, 0x0b, 0xf4, 0xf5, 0x52, 0x9c, 0x53, 0x4c, 0x49, 0x4c, 0xf9, 0x05, 0x9f, 0x47, 0x5e, 0x7d,
+    0xf0, 0xcd, 0x8d, 0x38, 0x17, 0x52, 0x0b, 0xb5, 0x44, 0x58, 0xe9, 0xc5, 0x21, 0x1b, 0xdd, 0x81,
+    0x57, 0xb7, 0x0a, 0x40, 0x24, 0xd8, 0x6a, 0x48, 0x92, 0xf9, 0x9e, 0x35, 0x47, 0x8a, 0xa5, 0x9b,
+    0xad, 0xfd, 0x84, 0xa7, 0xda, 0x25, 0x04, 0x61, 0xbc, 0x2f, 0x64, 0x15, 0xf1, 0x0c, 0xde, 0x33,
+    0x98, 0xb7, 0x58, 0x36, 0x0b, 0xa6, 0x53, 0xe8, 0xbe, 0x2c, 0x4c, 0x61, 0x69, 0x44, 0xc3, 0xfa,
+    0x2f, 0x33, 0x1e, 0xc5, 0x01, 0xab, 0x1b, 0xc2, 0xdf, 0x1b, 0x82, 0x3b, 0xdc, 0x00, 0x32, 0xad,
+    0xe5, 0xb0, 0x63, 0x4d, 0x56, 0xe8, 0x84, 0x77, 0xda, 0x53, 0xd3, 0x76, 0x95, 0x4c, 0x1d, 0x61,
+    0x0e, 0xaa, 0x57, 0xc3, 0x2b, 0x6c, 0x84, 0x85, 0xb9, 0xc2, 0x38, 0xdc, 0x6d, 0x3d, 0xdd, 0x91,
+    0x61, 0x85, 0xa7, 0x3b, 0x32, 0xc6, 0x81, 0xf1, 0x05, 0x19, 0xf1, 0xe0, 0x29, 0x3e, 0x74, 0xdd,
+    0x90, 0x04, 0xbb, 0xea, 0xb6, 0xbb, 0x50, 0xbf, 0x0b, 0x6f, 0xa3, 0xf8, 0x8a, 0x85, 0xd3, 0x20,
+    0xcb, 0x8e, 0xb6, 0x8b, 0xf5, 0xf6, 0x36, 0x8b, 0x23, 0xf9, 0xfb, 0x35, 0xfe, 0x3c, 0xfe, 0x51,
+    0x3a, 0x5e, 0x54, 0x84, 0x9e, 0x4c, 0xd2, 0x6e, 0xb7, 0x9f, 0xee, 0x40, 0x63, 0x85, 0x98, 0x50,
+    0x19, 0xc0, 0xb4, 0x28, 0xb7, 0x9d, 0x72, 0x58, 0x7a, 0x3b, 0x45, 0xc2, 0xb4, 0x79, 0x0b, 0x49,
+    0xb2, 0xf2, 0xcd, 0xf1, 0xf3, 0x65, 0x9a, 0xa2, 0x81, 0x38, 0x4d, 0xc4, 0x7c, 0xae, 0xf0, 0x97,
+    0x5b, 0xd1, 0xc2, 0x56, 0x30, 0x11, 0x8a, 0x46, 0xad, 0x60, 0x7e, 0x31, 0xe5, 0xdb, 0xc7, 0x2d,
+    0xb3, 0x91, 0xf9, 0x7e, 0x21, 0x81, 0x42, 0x47, 0x2c, 0xe7, 0x79, 0x66, 0xd4, 0xac, 0xc4, 0xe2,
+    0xa3, 0xed, 0x39, 0x0e, 0x0a, 0x4f, 0x13, 0x6b, 0x7d, 0x65, 0x53, 0x46, 0xaf, 0xb6, 0x8f, 0xef,
+    0x85, 0xee, 0x4d, 0x82, 0xb4, 0xaa, 0xfe, 0x84, 0x51, 0xb0, 0x91, 0x2c, 0x66, 0xd4, 0xaa, 0x25,
+    0xbd, 0x6c, 0x25, 0xf6, 0xfb, 0x31, 0xfa, 0x0c, 0x54, 0x9f, 0x91, 0x3e, 0x6d, 0xda, 0x03, 0x38,
+    0x58, 0x5a, 0xa9, 0x6c, 0xb1, 0x0a, 0xab, 0xfc, 0xf7, 0x2d, 0xcf, 0xaf, 0x93, 0xf4, 0xcb, 0x01,
+    0x7b, 0x9a, 0x2d, 0x82, 0xb9, 0x25, 0xaa, 0xeb, 0x78, 0x12, 0xb7, 0xb2, 0x2c, 0x06, 0x0d, 0x7a,
+    0x0b, 0x6e, 0x2c, 0xe8, 0x3e, 0xd4, 0x38, 0x36, 0x41, 0x7c, 0x88, 0x5f, 0xc6, 0xec, 0xfd, 0xd9,
+    0xd9, 0xeb, 0xca, 0xe6, 0x29, 0xb4, 0xdf, 0x3e, 0xfe, 0x69, 0xfe, 0x65, 0x9e, 0x5c, 0xcf, 0x1d,
+    0x08, 0xde, 0x3f, 0x06, 0x73, 0xe0, 0x44, 0xa0, 0x1c, 0xe4, 0x10, 0x2d, 0x0a, 0xc1, 0xee, 0x7d,
+    0xc9, 0x98, 0x90, 0xeb, 0x36, 0x4b, 0xe6, 0xe1, 0x34, 0x0e, 0xbf, 0x1c, 0x6d, 0x27, 0x0b, 0x3e,
+    0x3f, 0x0f, 0xc6, 0x75, 0x9a, 0xdf, 0x9a, 0xac, 0x26, 0xc7, 0x78, 0xad, 0xb1, 0x7d, 0xac, 0x83,
+    0x83, 0x02, 0x56, 0x25, 0xd0, 0x15, 0xd0, 0x90, 0x1b, 0x04, 0x85, 0x2c, 0x3f, 0x06, 0x4e, 0xc6,
+    0xf3, 0x1c, 0xc6, 0x76, 0x86, 0xb0, 0xce, 0xe4, 0xf3, 0x63, 0xe0, 0x81, 0x15, 0x8f, 0xc7, 0x34,
+    0x5f, 0xcd, 0x89, 0xd3, 0xe2, 0xe7, 0x63, 0xa0, 0x4a, 0xdd, 0x35, 0x44, 0x68, 0x8f, 0x81, 0xc7,
+    0xc0, 0x26, 0x0b, 0x8c, 0x20, 0xc9, 0x55, 0x7c, 0x0c, 0xa4, 0xe5, 0x22, 0x82, 0x35, 0x18, 0x89,
+    0xf2, 0x27, 0xf1, 0x68, 0x40, 0x73, 0x2d, 0x8f, 0x20, 0x7c, 0xdb, 0x00, 0xaf, 0x5c, 0xa0, 0x62,
+    0x1d, 0x4c, 0xb1, 0xeb, 0x9e, 0x30, 0xe0, 0xa0, 0xef, 0xf0, 0x68, 0x29, 0xa4, 0x1d, 0x92, 0x33,
+    0x74, 0x53, 0x53, 0xa8, 0xd6, 0x8d, 0x40, 0x51, 0xe7, 0x1f, 0xff, 0x55, 0xe6, 0xcd, 0xad, 0x38,
+    0xc2, 0x9a, 0xa3, 0x8d, 0xaa, 0x76, 0xf7, 0xb1, 0x2e, 0xfc, 0xbb, 0x49, 0xe5, 0xde, 0x1e, 0x56,
+    0x86, 0x7f, 0xad, 0xca, 0x52, 0x24, 0xc0, 0x96, 0x63, 0x57, 0x5c, 0x46, 0x8b, 0xf0, 0x1a, 0x32,
+    0x49, 0x81, 0x34, 0xf8, 0x4b, 0xf1, 0x30, 0x96, 0xdf, 0x2e, 0x38, 0x88, 0xf3, 0x92, 0x87, 0x5f,
+    0xc0, 0x0f, 0xf5, 0x19, 0x9d, 0x3c, 0xb9, 0x40, 0xeb, 0x8f, 0x44, 0x5d, 0xc2, 0x44, 0x00, 0xb5,
+    0x45, 0x09, 0x22, 0x55, 0x38, 0xeb, 0x40, 0xde, 0xd6, 0x8b, 0x39, 0xf4, 0x31, 0x67, 0x16, 0x31,
+    0x40, 0xa5, 0xc2, 0x77, 0x1f, 0xbc, 0x1c, 0x17, 0xd7, 0xd7, 0x38, 0xdb, 0x55, 0xa3, 0xe5, 0x2f,
+    0x45, 0x15, 0xc2, 0x2d, 0x4a, 0x98, 0x2c, 0x32, 0xb0, 0x96, 0xed, 0x90, 0x47, 0x1a, 0xe8, 0x12,
+    0x49, 0x61, 0x23, 0xc7, 0x14, 0x81, 0x02, 0x23, 0xbc, 0x7d, 0xac, 0xd8, 0x60, 0xaf, 0x65, 0x11,
+    0xab, 0x67, 0x1c, 0x14, 0x2d, 0xca, 0x1a, 0x05, 0x0a, 0x93, 0xa1, 0xf9, 0x72, 0x36, 0x86, 0x69,
+    0x9b, 0xd8, 0x29, 0xc3, 0x03, 0xcf, 0x6c, 0x7e, 0xb4, 0x3d, 0xd8, 0x66, 0x64, 0xe1, 0x8f, 0xb6,
+    0x87, 0x1d, 0x9f, 0xd6, 0x65, 0xc1, 0x15, 0x57, 0x88, 0x15, 0x5e, 0x64, 0xf2, 0x0c, 0xca, 0xcb,
+    0xdd, 0xef, 0x0c, 0x0c, 0x34, 0x6c, 0x9e, 0x51, 0x21, 0x87, 0x02, 0x59, 0x78, 0x18, 0xf4, 0x93,
+    0xf8, 0x62, 0x99, 0x56, 0x68, 0x8b, 0x72, 0x32, 0x2e, 0xfb, 0xc6, 0xc4, 0x3c, 0x9f, 0x73, 0x1a,
+    0x2d, 0x72, 0xfd, 0x0e, 0xad, 0xfa, 0x0f, 0xf3, 0x43, 0x54, 0xfb, 0x0d, 0xe6, 0x3e, 0x31, 0x61,
+    0x3d, 0x68, 0xa2, 0x7d, 0x7d, 0xca, 0x9e, 0x45, 0x11, 0x06, 0x3f, 0x36, 0xc7, 0x14, 0x2f, 0xee,
+    0x8b, 0x65, 0x76, 0xf2, 0xf6, 0x8c, 0xbd, 0x0d, 0x66, 0x7c, 0x73, 0x24, 0xb3, 0x68, 0xee, 0x61,
+    0xa6, 0x12, 0xa9, 0xd9, 0x17, 0xa2, 0x0f, 0x18, 0x0c, 0x2e, 0xea, 0x45, 0x39, 0xd3, 0xcb, 0x9e,
+    0x58, 0x1c, 0x9f, 0x81, 0xd7, 0x4d, 0xae, 0x7d, 0x70, 0x15, 0xc4, 0x53, 0x1a, 0x89, 0x73, 0x51,
+    0x05, 0x26, 0x57, 0x58, 0xec, 0x84, 0x45, 0xfb, 0xdb, 0x64, 0x99, 0x0a, 0x20, 0x30, 0x0a, 0x40,
+    0xbf, 0xc0, 0x19, 0x5d, 0xac, 0x1a, 0x23, 0x25, 0x05, 0x05, 0x54, 0x12, 0x7d, 0x06, 0x8a, 0x49,
+    0xdc, 0x61, 0x99, 0x34, 0xa5, 0xdb, 0x05, 0x2d, 0xaa, 0x96, 0xa1, 0xb6, 0x4a, 0x51, 0xa9, 0x81,
+    0xec, 0x5d, 0x85, 0x56, 0x2c, 0x6c, 0x57, 0xb9, 0x73, 0x95, 0x83, 0x97, 0xa4, 0x2b, 0x19, 0x6e,
+    0x89, 0x18, 0x3f, 0xce, 0xc8, 0x14, 0xeb, 0xd7, 0xa2, 0x52, 0x23, 0x56, 0xee, 0x01, 0xe8, 0x5e,
+    0x71, 0xda, 0x19, 0x36, 0x27, 0x51, 0x8c, 0x0a, 0x50, 0x64, 0x6b, 0x9e, 0x26, 0x0b, 0x1a, 0x0a,
+    0x72, 0x10, 0x6b, 0x34, 0x81, 0x12, 0x38, 0xb9, 0xf7, 0xa2, 0x12, 0x32, 0x21, 0xa0, 0x3e, 0x80,
+    0x9d, 0x05, 0xd4, 0x01, 0x78, 0xa0, 0x01, 0xa7, 0xf2, 0xc9, 0x6f, 0x74, 0x74, 0xbd, 0x82, 0xa3,
+    0xa2, 0x08, 0x16, 0x55, 0x21, 0xbf, 0x4c, 0xa6, 0xb0, 0xc8, 0x38, 0xda, 0x7e, 0x81, 0xe6, 0x44,
+    0x74, 0x7d, 0x01, 0xdc, 0x47, 0xd8, 0xfa, 0xb9, 0x11, 0xa6, 0xe7, 0xbc, 0xb0, 0x0b, 0x4a, 0x0d,
+    0xb0, 0x54, 0xa9, 0x01, 0x83, 0x25, 0x1d, 0xea, 0x61, 0x74, 0x7c, 0x0e, 0xa5, 0x86, 0x11, 0x59,
+    0x31, 0xe1, 0xa1, 0xed, 0x2b, 0x43, 0xc5, 0xd2, 0x32, 0x54, 0xb4, 0x87, 0xec, 0xcf, 0x0a, 0x6e,
+    0xb5, 0xaf, 0x20, 0x06, 0x9e, 0x08, 0x38, 0xde, 0x43, 0xd5, 0x3c, 0x76, 0xd0, 0x33, 0xf0, 0x5c,
+    0x06, 0x80, 0x3a, 0x39, 0xd2, 0xb0, 0xb2, 0x62, 0xa0, 0x28, 0x2d, 0xb3, 0x71, 0xa2, 0xdf, 0x21,
+    0x33, 0x53, 0x1e, 0xa4, 0x6b, 0x8d, 0xbc, 0xf2, 0x3a, 0xd7, 0x18, 0xfa, 0xc2, 0x21, 0xdd, 0xc0,
+    0x23, 0x10, 0x7a, 0x17, 0x2c, 0xe4, 0x12, 0xe1, 0x99, 0x08, 0xc6, 0x9e, 0xe2, 0x76, 0x0c, 0x83,
+    0x25, 0xc1, 0x89, 0x5f, 0xf5, 0x70, 0x59, 0x2e, 0x27, 0x6f, 0xd5, 0xf2, 0x5e, 0x7a, 0x0e, 0xad,
+    0x0a, 0x45, 0xb4, 0x70, 0xde, 0x47, 0xe5, 0x2d, 0x28, 0x1a, 0xbf, 0x4f, 0xb7, 0x3e, 0x80, 0x2e,
+    0x28, 0xb1, 0xa8, 0x39, 0x95, 0x39, 0xc2, 0xd2, 0xc2, 0x07, 0xa9, 0xd1, 0x92, 0xf4, 0x21, 0x82,
+    0x14, 0x6b, 0xd6, 0x0e, 0x39, 0x8e, 0x7a, 0xd1, 0xad, 0x56, 0xb8, 0x5e, 0x57, 0x88, 0x56, 0xb2,
+    0xd2, 0xb9, 0x95, 0x6d, 0xd7, 0xad, 0x82, 0xe5, 0x0f, 0xac, 0xfa, 0x00, 0x93, 0x29, 0x00, 0x8e,
+    0x3a, 0xc2, 0x65, 0x7d, 0x18, 0x91, 0xa3, 0x7b, 0x50, 0x39, 0x7a, 0x0c, 0x99, 0xe0, 0x29, 0x4b,
+    0x77, 0xf9, 0x61, 0x84, 0x52, 0xfb, 0x4d, 0x29, 0xa5, 0xca, 0x0f, 0x26, 0x15, 0xfc, 0x74, 0xe9,
+    0xac, 0x3f, 0x8c, 0x54, 0x6a, 0xbf, 0x29, 0xa9, 0x54, 0xd9, 0x21, 0xd5, 0x6f, 0x54, 0x01, 0x44,
+    0x49, 0xf3, 0x5d, 0xf5, 0x36, 0x55, 0xff, 0x3d, 0x07, 0x33, 0x83, 0xee, 0xc2, 0x09, 0x9f, 0x04,
+    0xcb, 0x69, 0xae, 0xb4, 0xbf, 0xb4, 0x46, 0xc1, 0x7a, 0x26, 0x64, 0xd1, 0xf0, 0xd9, 0x74, 0xea,
+    0x03, 0xec, 0xae, 0xe3, 0x8a, 0x05, 0x6e, 0xb5, 0x31, 0x2b, 0xa4, 0x68, 0x2e, 0x87, 0x89, 0x98,
+    0x05, 0xae, 0xba, 0x59, 0x7e, 0xc9, 0x99, 0x8c, 0x53, 0xb0, 0xc5, 0xe5, 0x6d, 0x86, 0xc1, 0x50,
+    0xa6, 0x82, 0x52, 0x2c, 0xc8, 0xa8, 0xc2, 0x9c, 0x5f, 0xb3, 0xbf, 0xf3, 0x34, 0x61, 0x29, 0x9f,
+    0x70, 0xa8, 0x1a, 0x72, 0xb1, 0xd9, 0xdc, 0x66, 0xe7, 0x97, 0x71, 0xc6, 0xae, 0x63, 0x20, 0x78,
+    0xa6, 0x22, 0xc7, 0xd8, 0x20, 0xe5, 0xd3, 0x80, 0x36, 0x85, 0xf1, 0x18, 0x09, 0x05, 0xf0, 0xc4,
+    0x41, 0x12, 0x16, 0x40, 0x4d, 0x45, 0x38, 0x8f, 0x34, 0xa2, 0xac, 0xec, 0x47, 0xad, 0x9f, 0x46,
+    0x41, 0x54, 0xff, 0x0e, 0x44, 0x29, 0x16, 0xeb, 0x22, 0x8e, 0xc0, 0xb0, 0xcc, 0x88, 0xd5, 0x79,
+    0xd6, 0x7c, 0x2f, 0x97, 0x40, 0xc5, 0x7b, 0x7e, 0x95, 0x4c, 0x97, 0x52, 0xc3, 0x96, 0xf3, 0x5c,
+    0x4b, 0xe5, 0x55, 0x72, 0x0d, 0xcc, 0xcc, 0x6f, 0x99, 0x88, 0xc8, 0x31, 0x60, 0x30, 0x60, 0x13,
+    0x6c, 0x92, 0xea, 0x26, 0xdf, 0xaf, 0x71, 0xfb, 0x0c, 0xc5, 0xc6, 0x96, 0xc5, 0x8a, 0x90, 0x60,
+    0x6e, 0x4b, 0x0a, 0xd4, 0x0a, 0xa9, 0x0e, 0x12, 0x4d, 0x70, 0xbf, 0x58, 0x60, 0xdc, 0x60, 0x7d,
+    0xe4, 0x03, 0xea, 0x73, 0x57, 0x74, 0x47, 0x42, 0xbf, 0xa8, 0x00, 0xa3, 0x16, 0x24, 0x02, 0xba,
+    0x48, 0x60, 0xdd, 0xa8, 0xe6, 0x55, 0x4b, 0xeb, 0x91, 0x44, 0x45, 0xa1, 0xa5, 0xfc, 0x20, 0x62,
+    0x9b, 0x7c, 0x29, 0x3e, 0x8f, 0xa0, 0xff, 0x9a, 0xe0, 0x20, 0x28, 0xfa, 0x42, 0x4a, 0xf8, 0x4d,
+    0x02, 0x9a, 0x01, 0x2f, 0x02, 0x86, 0x9b, 0x0c, 0x30, 0xad, 0x84, 0x4c, 0x49, 0x40, 0x13, 0x8c,
+    0x2e, 0x30, 0x7a, 0x44, 0xa8, 0x3c, 0x49, 0xca, 0x0c, 0x65, 0x6f, 0x6f, 0x2e, 0x7b, 0xe2, 0x4e,
+    0x81, 0xdc, 0x3e, 0x3e, 0x0f, 0xd2, 0x0b, 0x5e, 0xc4, 0x71, 0x1f, 0x20, 0x77, 0x1b, 0xe0, 0x57,
+    0x94, 0x38, 0x96, 0x9a, 0x8a, 0xec, 0x4a, 0xae, 0xca, 0x08, 0x10, 0xb4, 0x35, 0x4b, 0x01, 0xd4,
+    0xf8, 0x78, 0xce, 0xd9, 0xf9, 0x72, 0x0e, 0xd2, 0xbc, 0xc7, 0x44, 0x3c, 0x5f, 0x46, 0x17, 0xdc,
+    0x90, 0xdf, 0x5b, 0xfc, 0xad, 0x39, 0x5c, 0x2f, 0x2d, 0xa7, 0xbd, 0xf2, 0xfa, 0xbb, 0x9d, 0xce,
+    0x43, 0x3d, 0x67, 0x82, 0xa8, 0xe5, 0x94, 0xa7, 0x4b, 0xde, 0x50, 0x64, 0xc9, 0xf8, 0xc5, 0x0a,
+    0x07, 0xd9, 0x6e, 0x3c, 0x09, 0xa6, 0x59, 0xd1, 0xfa, 0x87, 0x20, 0xfc, 0xe2, 0x34, 0x97, 0xf4,
+    0x2d, 0xb4, 0x0b, 0x1b, 0xf1, 0x1c, 0x3c, 0x4d, 0xb0, 0x5a, 0x14, 0xd3, 0xb7, 0x02, 0xbd, 0x85,
+    0x76, 0xb6, 0xca, 0x81, 0x7f, 0x0a, 0xf5, 0x62, 0xf8, 0x69, 0x53, 0xb5, 0x05, 0x89, 0xb5, 0x3a,
+    0xad, 0x88, 0x5f, 0xa4, 0x9c, 0x67, 0x8e, 0x1b, 0x74, 0x7f, 0x9d, 0x75, 0xa0, 0xdd, 0x6b, 0x56,
+    0xc6, 0xb6, 0x23, 0xa3, 0xf1, 0xe8, 0x2b, 0xd0, 0x32, 0x7a, 0x0c, 0x31, 0xe0, 0x5e, 0x14, 0xad,
+    0x1d, 0x9f, 0xe6, 0x61, 0xe4, 0x58, 0x10, 0xef, 0x4d, 0x0f, 0xf8, 0x10, 0x45, 0x6b, 0xc7, 0x71,
+    0x79, 0x18, 0x3d, 0x16, 0xc4, 0x95, 0x7e, 0x89, 0x42, 0x54, 0x72, 0x4d, 0x34, 0x05, 0xeb, 0x9d,
+    0x08, 0x3b, 0xbc, 0x5d, 0xed, 0x47, 0xd8, 0x41, 0x6f, 0x6f, 0x1c, 0x6c, 0x71, 0xac, 0x4a, 0x39,
+    0x13, 0x60, 0x99, 0x04, 0x0b, 0x0b, 0x66, 0x3c, 0x63, 0x04, 0xe6, 0x31, 0x23, 0xbb, 0x0e, 0x0e,
+    0x58, 0x18, 0x67, 0x85, 0x25, 0x41, 0x1b, 0x8f, 0x71, 0x96, 0x6c, 0x96, 0x24, 0xf9, 0x25, 0x34,
+    0xbe, 0xe2, 0x33, 0x40, 0xdd, 0xbe, 0xd7, 0x88, 0x11, 0xbb, 0x68, 0xe0, 0xc1, 0x00, 0x1a, 0x9e,
+    0xc5, 0x20, 0x3c, 0x2d, 0x86, 0x57, 0xba, 0xf0, 0x61, 0x7d, 0x52, 0x02, 0x2d, 0x82, 0x91, 0x5d,
+    0xf8, 0x1b, 0xdc, 0x90, 0x3d, 0xeb, 0x6c, 0x33, 0x78, 0xb9, 0xc0, 0x32, 0x8c, 0x91, 0xe0, 0x0e,
+    0xf1, 0xf1, 0x79, 0x32, 0xe5, 0x69, 0x80, 0xbe, 0x52, 0x40, 0xc7, 0x19, 0x58, 0x2e, 0xa6, 0x1f,
+    0x3d, 0x43, 0x8c, 0x39, 0xd0, 0x8e, 0xe7, 0x78, 0x92, 0xc5, 0x02, 0x45, 0x50, 0x8f, 0x84, 0xb7,
+    0x88, 0x9b, 0xd7, 0x40, 0x98, 0x80, 0x72, 0x2f, 0x8d, 0xc4, 0xfd, 0x67, 0x98, 0x52, 0x39, 0x2c,
+    0xe5, 0xde, 0x04, 0x37, 0xf1, 0x6c, 0x39, 0x63, 0x67, 0xf8, 0x93, 0xd5, 0x05, 0xbb, 0x3b, 0x22,
+    0x02, 0xbb, 0x01, 0xd7, 0x05, 0x24, 0xc9, 0x2b, 0xb2, 0x48, 0xdc, 0xf6, 0x3a, 0x26, 0xbb, 0xc2,
+    0x94, 0x0b, 0x52, 0x15, 0x4a, 0xe5, 0x97, 0x80, 0x23, 0x99, 0x09, 0xec, 0x9a, 0xb1, 0x21, 0xb4,
+    0x7d, 0x18, 0x6b, 0x01, 0x2c, 0x70, 0x51, 0x9e, 0x62, 0x26, 0x7a, 0x66, 0xfc, 0x72, 0x98, 0xfb,
+    0xc7, 0x7f, 0x6f, 0xc0, 0x9e, 0x05, 0x6d, 0x73, 0x0e, 0x4d, 0xb4, 0x3b, 0x11, 0x37, 0x68, 0x40,
+    0x77, 0xd6, 0xe0, 0x73, 0xd7, 0xcb, 0xe7, 0x65, 0xff, 0xf8, 0xf4, 0xf5, 0x89, 0xb1, 0x7b, 0xca,
+    0xfe, 0x0a, 0x0e, 0x73, 0xa6, 0xe3, 0x90, 0xcf, 0x22, 0x3c, 0x86, 0x8d, 0x0e, 0x74, 0x86, 0xe7,
+    0x35, 0xc0, 0xd9, 0x06, 0x3f, 0xeb, 0x96, 0xb5, 0xc4, 0x91, 0x03, 0x26, 0x02, 0x6b, 0x19, 0x9e,
+    0x11, 0x60, 0x78, 0x1a, 0x01, 0x1d, 0xa7, 0x60, 0x9e, 0x43, 0x8d, 0x60, 0x32, 0xc1, 0x18, 0xc8,
+    0x82, 0xa7, 0x28, 0x3f, 0xd4, 0xb9, 0x7b, 0x8c, 0x9d, 0x2b, 0x3e, 0x6d, 0x4d, 0x93, 0x64, 0xd1,
+    0x82, 0x17, 0xa7, 0x69, 0x82, 0x97, 0x10, 0x44, 0xe7, 0x21, 0x71, 0xac, 0x7e, 0xda, 0x58, 0x17,
+    0xbe, 0x30, 0x00, 0xc0, 0x48, 0xcf, 0x61, 0x90, 0x80, 0x38, 0x3f, 0x3e, 0x69, 0x7d, 0xfa, 0xbe,
+    0xfe, 0xb1, 0xd3, 0x1a, 0x7d, 0xfa, 0xee, 0x63, 0xfb, 0x53, 0xe3, 0x7b, 0x7a, 0x7c, 0x52, 0xff,
+    0xc8, 0x5f, 0x7c, 0xa2, 0x77, 0xe2, 0x77, 0xe3, 0xfb, 0x42, 0xba, 0x16, 0x72, 0x79, 0x4e, 0x85,
+    0xfc, 0x44, 0xa1, 0x45, 0xe2, 0x70, 0x59, 0x21, 0xe3, 0x3e, 0x6f, 0x0d, 0x1e, 0xa6, 0x4b, 0x9a,
+    0xe0, 0x78, 0xfb, 0x18, 0x77, 0x09, 0x2e, 0x52, 0xcd, 0xed, 0xeb, 0xcd, 0xb9, 0x8d, 0x1f, 0xc7,
+    0xed, 0x7b, 0x83, 0x41, 0x50, 0xc7, 0xe5, 0x6c, 0x39, 0xa5, 0x25, 0x91, 0x9f, 0xd9, 0x21, 0x6f,
+    0xf5, 0x1f, 0xc9, 0x6c, 0x84, 0xfb, 0x8c, 0x69, 0x7c, 0x25, 0x16, 0x66, 0x82, 0xdd, 0x93, 0xcd,
+    0xd9, 0x8d, 0xbe, 0x1e, 0xbb, 0x34, 0x58, 0x92, 0x89, 0xc5, 0xaa, 0x50, 0x6e, 0x83, 0xe3, 0x56,
+    0x8f, 0xb7, 0xf6, 0xbd, 0x63, 0xe8, 0x65, 0x3c, 0x45, 0x4f, 0xdb, 0x88, 0x2c, 0xf5, 0xef, 0x21,
+    0x8b, 0x09, 0xb5, 0x6e, 0xc1, 0x58, 0x01, 0x4b, 0x9e, 0xe3, 0x5a, 0x76, 0xfb, 0xf8, 0x6f, 0x7c,
+    0x9a, 0x84, 0x71, 0x7e, 0xcb, 0x24, 0xe8, 0xd3, 0xe2, 0xe5, 0x7a, 0x5b, 0x52, 0x01, 0x54, 0x58,
+    0x15, 0x65, 0x53, 0xba, 0xca, 0x9e, 0x74, 0xda, 0x1d, 0x63, 0x8e, 0xd0, 0x88, 0xc5, 0xd4, 0x87,
+    0xb3, 0xc0, 0x04, 0xbc, 0xe0, 0x24, 0x6d, 0xb2, 0xce, 0xd1, 0x3c, 0x61, 0x02, 0x2e, 0x14, 0x37,
+    0x59, 0xf7, 0x68, 0x26, 0xed, 0xab, 0x2e, 0x34, 0xa4, 0x05, 0x60, 0x1f, 0xa6, 0x1e, 0xd9, 0x22,
+    0x6a, 0x41, 0x0f, 0xd8, 0xf2, 0x10, 0x93, 0xc6, 0x0b, 0xea, 0x98, 0x7b, 0xc9, 0xc2, 0x07, 0x6d,
+    0x23, 0x41, 0x9c, 0x19, 0xaa, 0x10, 0x15, 0x5a, 0xea, 0x8a, 0x65, 0x1d, 0xc7, 0x3e, 0x37, 0x49,
+    0xb8, 0x2e, 0xd2, 0xe8, 0x96, 0x7c, 0x25, 0xc7, 0xb1, 0xa9, 0x3e, 0x88, 0x60, 0x07, 0x6d, 0x2c,
+    0xa0, 0xe7, 0x89, 0x8a, 0xf3, 0x14, 0x31, 0x1c, 0x2b, 0xf8, 0x53, 0xe5, 0x7d, 0xd1, 0x01, 0x80,
+    0x8d, 0x9d, 0x2e, 0x79, 0x4a, 0xc0, 0x5d, 0xbe, 0xd9, 0xe7, 0xb8, 0x9c, 0xd5, 0xa6, 0x78, 0x69,
+    0xec, 0x43, 0xcb, 0x1d, 0x08, 0x2a, 0x20, 0x80, 0x24, 0x09, 0x70, 0x4d, 0x72, 0x56, 0x71, 0x0a,
+    0xa1, 0x00, 0x13, 0x62, 0x84, 0xdd, 0x80, 0x42, 0xbf, 0x4f, 0xa7, 0x89, 0xe0, 0x9b, 0xe2, 0xef,
+    0x8c, 0x7e, 0x3a, 0x7b, 0x56, 0x16, 0xa1, 0x7a, 0xb7, 0x53, 0x6c, 0x67, 0x9a, 0xcb, 0x28, 0xbb,
+    0xc2, 0x19, 0xfa, 0x45, 0x3c, 0x92, 0xeb, 0x27, 0xf6, 0xdb, 0x56, 0xb1, 0xb9, 0x51, 0x6e, 0x14,
+    0xea, 0x77, 0xdb, 0xc6, 0xae, 0x80, 0xd9, 0xfa, 0x24, 0xc8, 0x03, 0x11, 0x1f, 0xf7, 0xe0, 0xa4,
+    0x68, 0x16, 0x2e, 0xb5, 0x64, 0xfd, 0x15, 0xfb, 0x8a, 0xf6, 0x81, 0x3d, 0xb9, 0xcb, 0xa1, 0x5d,
+    0xcd, 0xf3, 0x14, 0x16, 0x92, 0x62, 0x95, 0x8d, 0x46, 0x49, 0x1e, 0xe7, 0xb3, 0xfc, 0x48, 0x04,
+    0xb0, 0x2d, 0x8e, 0x84, 0x1f, 0x6d, 0xef, 0x0d, 0x60, 0x60, 0x88, 0xe3, 0x7d, 0xe0, 0x78, 0x0c,
+    0x28, 0x20, 0x29, 0x1a, 0x79, 0xb0, 0x8a, 0x53, 0x7f, 0x34, 0x68, 0x90, 0x7c, 0xf9, 0xca, 0x38,
+    0x0b, 0x08, 0xad, 0x3d, 0x6f, 0x64, 0x94, 0x94, 0xce, 0xeb, 0x1d, 0x6d, 0x57, 0x5f, 0xd2, 0x40,
+    0xdc, 0xc4, 0x7d, 0xf9, 0xc0, 0x9b, 0x14, 0xca, 0xd7, 0x45, 0xdb, 0xe3, 0x61, 0xb8, 0xd7, 0x2d,
+    0xa3, 0x55, 0x46, 0xf1, 0x77, 0x42, 0xcb, 0xf7, 0x76, 0xc3, 0x7e, 0x58, 0xa0, 0x75, 0xa2, 0x42,
+    0x0f, 0xd5, 0x00, 0x70, 0xec, 0x84, 0xc1, 0x3c, 0xe7, 0xe9, 0x2c, 0x2b, 0xf7, 0x3f, 0xd9, 0xb6,
+    0xff, 0x81, 0x9d, 0xef, 0xf6, 0x82, 0x61, 0xfb, 0x7f, 0xa7, 0x0e, 0x98, 0xf4, 0x47, 0x61, 0xb7,
+    0x57, 0x60, 0x14, 0x62, 0x53, 0x8e, 0xd8, 0xef, 0x84, 0x74, 0x34, 0x1e, 0x8c, 0xc6, 0x43, 0x43,
+    0xd9, 0xa4, 0x51, 0x3d, 0xfd, 0xf0, 0x86, 0xbd, 0x5b, 0xe6, 0x15, 0xbd, 0xee, 0xd8, 0x6b, 0x79,
+    0xcc, 0xaa, 0xda, 0x62, 0xbf, 0x3b, 0x7f, 0x06, 0x3e, 0x44, 0x3a, 0xbb, 0x06, 0xe7, 0x9d, 0x89,
+    0x93, 0x58, 0xd2, 0x60, 0xd3, 0x8d, 0x17, 0x84, 0xa1, 0xae, 0xbf, 0x6c, 0x63, 0xcc, 0x53, 0xcc,
+    0xa0, 0xe0, 0xfa, 0xe5, 0x31, 0xac, 0x91, 0xf3, 0x1d, 0x9a, 0xa6, 0xa1, 0x55, 0xb0, 0xbd, 0x69,
+    0x74, 0x59, 0x22, 0xd3, 0x3b, 0xe9, 0x1a, 0x3b, 0xb8, 0x32, 0xe0, 0x4e, 0xb5, 0xc7, 0xf1, 0xbc,
+    0x89, 0x01, 0xd4, 0x76, 0xc4, 0xa7, 0x60, 0x00, 0xc1, 0x85, 0x0b, 0x2f, 0x2b, 0x9c, 0x3e, 0xf0,
+    0x2b, 0xe4, 0x79, 0x0b, 0x0d, 0x55, 0x5e, 0x4e, 0x2e, 0x7e, 0xe3, 0xc2, 0x69, 0x01, 0xda, 0x4a,
+    0x70, 0x05, 0xcc, 0x72, 0x94, 0x42, 0x80, 0x2b, 0xc5, 0x38, 0x97, 0x0b, 0xbc, 0x16, 0xa5, 0x08,
+    0xac, 0xd3, 0x59, 0x35, 0x2c, 0xd1, 0x34, 0x9b, 0x13, 0x25, 0x72, 0x6c, 0x48, 0xde, 0xbc, 0x94,
+    0x53, 0x0a, 0x74, 0xfa, 0xab, 0xe1, 0xdd, 0x1d, 0xef, 0x56, 0x94, 0xaa, 0xb8, 0xf9, 0x09, 0x0a,
+    0x6c, 0x21, 0xef, 0x80, 0xe9, 0xea, 0xea, 0x4e, 0x98, 0x4d, 0x84, 0xf1, 0x92, 0x1b, 0xd8, 0x17,
+    0xea, 0x24, 0x33, 0x9d, 0x6f, 0x58, 0x94, 0x14, 0x2c, 0x0b, 0xd3, 0x78, 0x91, 0x1f, 0x6f, 0x4d,
+    0xc1, 0x10, 0x09, 0xb2, 0x84, 0xf2, 0xe8, 0xb3, 0x53, 0x47, 0x6c, 0x0e, 0x6b, 0xc1, 0x43, 0xa3,
+    0xc2, 0x59, 0x12, 0x7e, 0x81, 0x1f, 0xe5, 0x17, 0xa7, 0xcb, 0xec, 0xf2, 0x99, 0xb8, 0x92, 0x77,
+    0xc4, 0x28, 0xca, 0x79, 0x58, 0x82, 0x9b, 0x9d, 0x2d, 0xc1, 0xf9, 0x9e, 0x47, 0x30, 0xd2, 0xad,
+    0x3a, 0x32, 0x78, 0x29, 0x6f, 0x1a, 0x1d, 0xb1, 0x5f, 0xef, 0x64, 0x39, 0x45, 0x76, 0x68, 0x0a,
+    0x95, 0x08, 0x19, 0xdb, 0xd9, 0x61, 0x30, 0x45, 0x83, 0xa6, 0x89, 0x97, 0x2c, 0xe3, 0x18, 0xe6,
+    0xc9, 0x39, 0xac, 0x47, 0xe9, 0x2a, 0x85, 0xc0, 0xb7, 0x15, 0x25, 0xb0, 0xb6, 0xc1, 0x68, 0x4e,
+    0x10, 0x45, 0x2f, 0xf0, 0xb8, 0xe2, 0x8f, 0xe4, 0x18, 0xf2, 0xb4, 0x5e, 0x3b, 0x79, 0xf7, 0xe6,
+    0xb9, 0x18, 0x3e, 0x28, 0x1d, 0x1e, 0xd5, 0x9a, 0x6c, 0xb2, 0x9c, 0xcb, 0xe3, 0x0b, 0x78, 0x3f,
+    0x98, 0x83, 0xb2, 0x0a, 0x5a, 0xea, 0x8d, 0x43, 0xf1, 0x53, 0xc4, 0x98, 0xe0, 0x27, 0x11, 0x80,
+    0xed, 0x14, 0xfe, 0x84, 0x42, 0x2d, 0xc4, 0x67, 0x9a, 0x2f, 0x17, 0xa2, 0x3a, 0xee, 0x4f, 0x6b,
+    0x08, 0xba, 0x05, 0xed, 0x5a, 0x4b, 0xfa, 0xa8, 0xda, 0x0f, 0xea, 0xc8, 0xb9, 0x59, 0xab, 0x38,
+    0x74, 0x5e, 0x30, 0x01, 0x33, 0xc5, 0x8b, 0x29, 0x45, 0xa7, 0x7e, 0xb8, 0x7d, 0x1d, 0xd5, 0x6b,
+    0x72, 0xbf, 0xb9, 0xd6, 0xf0, 0xb0, 0x47, 0x63, 0xcb, 0xe5, 0x49, 0x98, 0x10, 0xda, 0x3c, 0x3c,
+    0x15, 0xfb, 0x90, 0xf5, 0x9a, 0xde, 0x8b, 0x86, 0xca, 0xe0, 0xed, 0x66, 0x6d, 0x0a, 0x94, 0x03,
+    0xc7, 0x77, 0xf0, 0xff, 0x35, 0xa8, 0x47, 0x5f, 0x09, 0xf7, 0xe8, 0x21, 0xc8, 0xbb, 0xfb, 0x5f,
+    0x09, 0x3b, 0x02, 0xba, 0x3f, 0xfa, 0xde, 0xde, 0x57, 0x42, 0x8f, 0x80, 0x3c, 0xe8, 0x49, 0x93,
+    0xce, 0xcc, 0x61, 0x53, 0x97, 0x6f, 0x14, 0x64, 0x56, 0x1c, 0xc4, 0xcd, 0x9b, 0x78, 0xd7, 0x0b,
+    0x8f, 0xb4, 0x21, 0x36, 0x1c, 0x34, 0xc6, 0xc1, 0xda, 0x23, 0xe6, 0x61, 0x25, 0xfb, 0xe1, 0xf6,
+    0x39, 0x9a, 0x0b, 0x6c, 0x53, 0x37, 0xe7, 0x12, 0x44, 0x80, 0x6b, 0x1d, 0x04, 0x12, 0x43, 0xdb,
+    0xce, 0x21, 0xfc, 0x79, 0x6a, 0xc0, 0x6b, 0x4f, 0xf9, 0xfc, 0x22, 0xbf, 0x84, 0xe2, 0x27, 0x4f,
+    0x10, 0x5b, 0xf1, 0xe6, 0x63, 0xfc, 0xa9, 0x4d, 0x36, 0x08, 0xa5, 0xd1, 0x4e, 0x39, 0xc6, 0x52,
+    0xeb, 0xdb, 0xc6, 0xb9, 0xde, 0x06, 0x5d, 0x08, 0x17, 0xd4, 0x89, 0xe3, 0xe3, 0x9b, 0xd1, 0x26,
+    0x4e, 0x20, 0x57, 0x53, 0x46, 0xef, 0x3d, 0x74, 0x51, 0xf9, 0x2a, 0xaa, 0x04, 0x45, 0x55, 0x3d,
+    0xad, 0x44, 0x6a, 0x34, 0x87, 0xfe, 0x76, 0x39, 0x02, 0xe9, 0xb7, 0xa5, 0xe9, 0x12, 0xde, 0x9c,
+    0xbf, 0x3a, 0x56, 0x8d, 0x27, 0x4c, 0x01, 0x65, 0x47, 0x47, 0x47, 0xce, 0xb1, 0xf1, 0xb2, 0xd1,
+    0xb9, 0x63, 0x1c, 0xac, 0x23, 0x2b, 0x35, 0x13, 0xa7, 0xe0, 0x55, 0x7d, 0xcb, 0xcc, 0xd0, 0xfd,
+    0x18, 0xad, 0x21, 0xae, 0x7d, 0x51, 0x4d, 0xea, 0xb5, 0x9d, 0x60, 0x11, 0xef, 0x90, 0x91, 0x41,
+    0x1b, 0x53, 0x6b, 0x6c, 0xb5, 0xf3, 0x4b, 0x3e, 0xaf, 0xeb, 0xc8, 0xd7, 0xd1, 0x31, 0xd4, 0x45,
+    0xc4, 0xaa, 0xa4, 0x9d, 0x7c, 0xc1, 0xe6, 0x29, 0xcf, 0x97, 0xe9, 0x5c, 0x47, 0xc8, 0xda, 0xbf,
+    0x64, 0xa8, 0xe2, 0x9a, 0x54, 0x10, 0xfb, 0x65, 0x9a, 0x5c, 0xd3, 0xa6, 0x3d, 0xb9, 0x56, 0xf5,
+    0xda, 0xcb, 0x00, 0xa6, 0xf6, 0x08, 0xd7, 0xa4, 0x84, 0xda, 0xb0, 0x6c, 0x35, 0x41, 0xae, 0xc2,
+    0x1d, 0x91, 0x85, 0x3f, 0xa6, 0xdb, 0x93, 0xf3, 0x2c, 0x67, 0xfa, 0x2a, 0xce, 0x8b, 0xa9, 0x5f,
+    0x4f, 0xc4, 0x70, 0xd4, 0xd5, 0x10, 0x9c, 0xd1, 0xa6, 0x8d, 0x71, 0xa4, 0xe7, 0x7a, 0x0c, 0xfc,
+    0xfc, 0xbf, 0x7e, 0x45, 0x04, 0xed, 0x8b, 0x38, 0xff, 0x01, 0x23, 0xe3, 0x97, 0x77, 0x7f, 0x29,
+    0x4a, 0x5e, 0x05, 0xd9, 0xe5, 0x1d, 0xfb, 0x8d, 0xa1, 0xa8, 0x60, 0x79, 0x2f, 0x5f, 0x10, 0xb0,
+    0xf3, 0x78, 0xc6, 0x61, 0x2c, 0xce, 0x16, 0x77, 0x3f, 0x1f, 0x12, 0xad, 0x21, 0x7a, 0x31, 0x75,
+    0x11, 0x2d, 0xd0, 0xd4, 0x26, 0x53, 0x2e, 0x2e, 0xa0, 0xd6, 0x6b, 0xc2, 0xa3, 0x24, 0x5e, 0xed,
+    0xdb, 0x43, 0x07, 0x30, 0xcc, 0xa9, 0xce, 0x2a, 0xe3, 0x62, 0x70, 0xe3, 0x30, 0x50, 0xab, 0x89,
+    0xe1, 0xef, 0x76, 0xaf, 0xea, 0x7a, 0xa7, 0x6f, 0xc5, 0x0c, 0xf3, 0x47, 0x76, 0xac, 0xc2, 0x58,
+    0xd5, 0xa9, 0xce, 0xf4, 0x8e, 0x6f, 0x0e, 0xa5, 0x65, 0x14, 0x85, 0x27, 0xe2, 0x2a, 0x19, 0xb5,
+    0x69, 0x78, 0x85, 0xbd, 0x5a, 0xd4, 0x82, 0x80, 0x42, 0xcc, 0xb6, 0xb0, 0x7c, 0x06, 0x15, 0xc8,
+    0x5a, 0xe7, 0x99, 0x18, 0xcd, 0x4e, 0x93, 0x29, 0x58, 0x14, 0x9c, 0xff, 0xb7, 0xe4, 0x1a, 0xff,
+    0xcc, 0xf0, 0x86, 0xea, 0x0e, 0x3a, 0x01, 0xea, 0x1e, 0x08, 0x71, 0x47, 0x19, 0xf1, 0x25, 0x8b,
+    0x12, 0x3a, 0xec, 0x2f, 0xd3, 0xf3, 0x2a, 0xe0, 0x88, 0xdf, 0x60, 0x72, 0x92, 0x8c, 0xd7, 0xc5,
+    0xb4, 0x51, 0xf6, 0xcf, 0xee, 0x2a, 0xe4, 0xa0, 0x31, 0x48, 0x95, 0xf8, 0xc6, 0xe7, 0xfe, 0xb9,
+    0x34, 0x1b, 0x6e, 0x61, 0xc6, 0x73, 0x7d, 0xd0, 0xdd, 0xd0, 0xc5, 0x26, 0xc3, 0x5d, 0x8c, 0x46,
+    0x09, 0x6f, 0x89, 0x31, 0x89, 0xb6, 0x0a, 0x2b, 0x85, 0x78, 0x34, 0x02, 0x6f, 0xad, 0xc3, 0xad,
+    0x95, 0x1e, 0xab, 0x45, 0x40, 0xca, 0x27, 0xa0, 0xdd, 0x97, 0xaa, 0xcf, 0x40, 0xbd, 0x61, 0x09,
+    0x11, 0xdc, 0x3a, 0xcc, 0x17, 0x1e, 0x2c, 0x31, 0xce, 0x73, 0x34, 0x00, 0xc9, 0x32, 0xb7, 0x19,
+    0x14, 0x2d, 0x1d, 0x04, 0x5e, 0xa5, 0xb0, 0x78, 0x94, 0xfd, 0xf2, 0xdb, 0x6f, 0x15, 0x0e, 0x71,
+    0x31, 0x10, 0x11, 0xb4, 0x30, 0x83, 0xb0, 0xa4, 0xc8, 0x13, 0xf0, 0x39, 0x80, 0xa9, 0xeb, 0x78,
+    0x1e, 0x25, 0xd7, 0xed, 0x69, 0x12, 0x8a, 0xc3, 0x28, 0xc5, 0x2b, 0x9c, 0x15, 0x2e, 0xf3, 0x7c,
+    0x01, 0xda, 0xcf, 0xbe, 0x87, 0x09, 0x22, 0xc3, 0x87, 0x03, 0x7c, 0x38, 0xa8, 0x61, 0x3a, 0x80,
+    0x5b, 0x47, 0x61, 0x50, 0x42, 0x30, 0x92, 0x3f, 0xf0, 0xb1, 0xa4, 0x53, 0x83, 0x7a, 0xc2, 0x6a,
+    0x3b, 0x3b, 0x35, 0xf8, 0xe3, 0x22, 0xbb, 0x4c, 0x80, 0x18, 0x7c, 0x7b, 0x9d, 0xed, 0x18, 0x43,
+    0x9d, 0xd1, 0x10, 0x65, 0x62, 0x8c, 0x36, 0xca, 0xe6, 0xb0, 0xb0, 0x12, 0x61, 0xca, 0x31, 0xf6,
+    0x2e, 0x2f, 0x75, 0x6b, 0xd4, 0xa6, 0x59, 0xf4, 0x6a, 0x6f, 0x21, 0x10, 0x4b, 0xe5, 0x93, 0x39,
+    0xfa, 0x3f, 0x38, 0x50, 0x4d, 0x4f, 0xcb, 0xb3, 0x0c, 0x59, 0x31, 0xae, 0xee, 0x0e, 0x5d, 0x98,
+    0x2a, 0xc1, 0xc1, 0x11, 0xb8, 0xf4, 0xa2, 0xfa, 0x1b, 0x51, 0x52, 0xaa, 0x49, 0x43, 0x6e, 0x03,
+    0xf4, 0x85, 0x1d, 0x29, 0xb3, 0x56, 0x1a, 0x74, 0xb6, 0x2a, 0xf8, 0x6d, 0x8f, 0xa1, 0x93, 0x1e,
+    0x8d, 0x6b, 0xb2, 0x81, 0x1e, 0x7c, 0x25, 0x9a, 0xa5, 0x21, 0x2d, 0x68, 0xa6, 0x3b, 0x5c, 0x9e,
+    0x5e, 0x3b, 0x73, 0x3a, 0x49, 0xf4, 0x10, 0x75, 0x15, 0xb5, 0x20, 0xd1, 0x19, 0xaa, 0xef, 0x08,
+    0xab, 0x80, 0x8b, 0xce, 0xda, 0x4c, 0x49, 0x50, 0xe8, 0x61, 0x21, 0xe2, 0x7f, 0x39, 0x7b, 0xf7,
+    0xb6, 0xbd, 0xc0, 0xc4, 0x64, 0xa2, 0x41, 0x5b, 0x59, 0xfe, 0xcd, 0x95, 0x8a, 0x5a, 0x2b, 0x9d,
+    0x92, 0x90, 0xb5, 0x46, 0x49, 0x6a, 0x15, 0x58, 0x43, 0x91, 0xae, 0x63, 0x82, 0x2f, 0x1b, 0xb4,
+    0x31, 0x68, 0x40, 0x68, 0x02, 0x00, 0x56, 0x93, 0xda, 0x7d, 0xb0, 0x05, 0xa3, 0x9c, 0x83, 0xc6,
+    0x9a, 0xb5, 0x0e, 0xb7, 0xde, 0x8d, 0x7f, 0x01, 0x91, 0xb7, 0xc1, 0xc5, 0x8b, 0x2f, 0xe6, 0x75,
+    0x6b, 0x56, 0x6b, 0xaa, 0xaa, 0x0d, 0xff, 0xc4, 0x56, 0xbc, 0x1d, 0xc3, 0x58, 0xf8, 0x72, 0x28,
+    0xf1, 0xa1, 0x47, 0xda, 0xa2, 0xbe, 0x06, 0x9c, 0x46, 0x51, 0x98, 0xcc, 0x16, 0x48, 0x00, 0x94,
+    0xa2, 0xa2, 0x98, 0x64, 0x88, 0x11, 0x6f, 0xd7, 0x62, 0x7f, 0xfe, 0xb3, 0x26, 0x35, 0x18, 0x27,
+    0x69, 0x2e, 0x94, 0x48, 0x89, 0xee, 0x3a, 0x48, 0xe7, 0xf5, 0x1a, 0x1d, 0x7f, 0x93, 0x6f, 0x71,
+    0xc1, 0xaa, 0x22, 0xc3, 0x35, 0x4d, 0x7b, 0x5b, 0x15, 0x91, 0x0e, 0x59, 0x84, 0x8a, 0xc5, 0x2e,
+    0x90, 0x63, 0xaf, 0x86, 0xed, 0x4a, 0x49, 0x1e, 0x40, 0x8d, 0x64, 0xfe, 0x2e, 0x0f, 0x94, 0x36,
+    0x54, 0xf0, 0x4d, 0x07, 0xfc, 0x7f, 0x49, 0xc6, 0x54, 0x1d, 0xbd, 0xd8, 0x7f, 0x49, 0xc6, 0x95,
+    0x4d, 0xca, 0x7e, 0xad, 0xc2, 0x6f, 0xf0, 0x38, 0x4d, 0x2e, 0x40, 0x39, 0x94, 0x3f, 0x20, 0xc8,
+    0x6d, 0xb7, 0xdb, 0x35, 0xb5, 0x80, 0x97, 0xbe, 0x91, 0xe4, 0xe3, 0x0f, 0xf4, 0x8d, 0x14, 0xc6,
+    0x15, 0x0e, 0xaf, 0xa6, 0x5f, 0xf0, 0x45, 0xfe, 0x11, 0xa0, 0x0c, 0x39, 0x98, 0x91, 0x08, 0x55,
+    0x5a, 0x6a, 0xb1, 0x15, 0x0e, 0x31, 0x9d, 0x28, 0xd1, 0x6e, 0xbd, 0x13, 0xb5, 0xce, 0x63, 0x15,
+    0x08, 0x4c, 0xb3, 0xec, 0xb8, 0x9d, 0x95, 0x3e, 0x9b, 0x9a, 0x49, 0xd5, 0x0f, 0x07, 0xcf, 0xdb,
+    0xc4, 0x66, 0x0a, 0x8f, 0x29, 0x7a, 0x60, 0xd5, 0xac, 0xa1, 0x8a, 0x00, 0xc9, 0x1b, 0x97, 0x23,
+    0xed, 0x19, 0x1e, 0x6d, 0x63, 0xdf, 0x80, 0xfa, 0x2f, 0xc1, 0x4c, 0x4e, 0xe2, 0xb9, 0xd0, 0xf2,
+    0xea, 0xd5, 0xba, 0x79, 0x24, 0xae, 0xe4, 0x54, 0x97, 0x21, 0xc3, 0x0c, 0xf7, 0x8f, 0xff, 0xaa,
+    0xad, 0x5a, 0xfe, 0x57, 0x9d, 0xb7, 0x5b, 0x0f, 0xdc, 0xc7, 0x8f, 0xde, 0xbd, 0xb9, 0x3f, 0x4b,
+    0xce, 0xf5, 0xfd, 0x95, 0xf8, 0x35, 0x1a, 0xe0, 0x4f, 0x9e, 0x3f, 0xaa, 0xf9, 0xc8, 0x11, 0x27,
+    0xcb, 0x4b, 0xb4, 0x08, 0x57, 0x84, 0x22, 0x1f, 0xaf, 0xf8, 0x0d, 0xae, 0x46, 0xbe, 0x45, 0x1f,
+    0xa1, 0xd4, 0xb2, 0x9d, 0x27, 0x67, 0x39, 0x6e, 0x0f, 0xd7, 0xbb, 0xc3, 0x06, 0x98, 0xf6, 0x88,
+    0x76, 0xf7, 0xea, 0xc3, 0x26, 0xab, 0x75, 0x6a, 0x2b, 0x83, 0x2a, 0x66, 0x62, 0x00, 0xe0, 0x84,
+    0x82, 0xe9, 0xed, 0x22, 0x96, 0x2e, 0xe8, 0x3a, 0xd2, 0x24, 0x58, 0xb4, 0x07, 0xc6, 0x95, 0x56,
+    0x71, 0x9b, 0x35, 0xba, 0x87, 0x38, 0x7d, 0x77, 0xf5, 0xfd, 0xb2, 0xf4, 0xe1, 0x01, 0x6f, 0xeb,
+    0xdd, 0x5b, 0xf2, 0xb5, 0xde, 0xbd, 0x7c, 0xb9, 0x4a, 0x6f, 0x7c, 0xb7, 0x73, 0x01, 0x0d, 0x5d,
+    0xa5, 0x25, 0xff, 0xbf, 0x0a, 0x85, 0x9f, 0x55, 0x75, 0x8d, 0xf6, 0x41, 0x8c, 0xea, 0x7b, 0xba,
+    0x2b, 0x08, 0x50, 0x08, 0x2c, 0xf4, 0xe2, 0x6c, 0x9d, 0xf4, 0x6d, 0x36, 0xc7, 0xec, 0x4b, 0xc2,
+    0xe0, 0x17, 0xb1, 0x85, 0x00, 0x64, 0xfb, 0xec, 0xf9, 0xf9, 0xeb, 0xbf, 0xbd, 0x20, 0xf9, 0xbe,
+    0x3e, 0xf9, 0xf1, 0x45, 0xcd, 0x99, 0x08, 0x2a, 0x2d, 0x9f, 0x6b, 0x54, 0xc9, 0xbd, 0x2a, 0xac,
+    0x1b, 0x93, 0x69, 0x4b, 0xc0, 0xcb, 0xcd, 0x2f, 0x09, 0xb3, 0x61, 0x61, 0x85, 0x9b, 0x22, 0xbd,
+    0xef, 0x24, 0xeb, 0xac, 0x8a, 0x3e, 0x58, 0x07, 0x5c, 0x6b, 0xc2, 0x3c, 0x8b, 0x66, 0xa3, 0xb5,
+    0xed, 0x46, 0xfe, 0x86, 0xdd, 0xfd, 0xb5, 0x2d, 0x8d, 0x73, 0xa3, 0x56, 0xd3, 0xde, 0xde, 0xda,
+    0xa6, 0xc6, 0x11, 0xcf, 0xa2, 0x29, 0x9e, 0xf5, 0xfa, 0xac, 0x74, 0xf3, 0x33, 0x99, 0x87, 0x55,
+    0x70, 0x3c, 0x37, 0x00, 0x6a, 0x72, 0x95, 0x8a, 0xf2, 0x6a, 0x90, 0xd4, 0x44, 0x34, 0x53, 0xf5,
+    0x2b, 0x94, 0x7c, 0xee, 0x7c, 0x96, 0x88, 0x75, 0xd5, 0x91, 0xa8, 0x3b, 0xf2, 0x54, 0x1e, 0x95,
+    0x6b, 0xe3, 0xdd, 0x7b, 0x29, 0xa0, 0x72, 0x7d, 0x28, 0x2c, 0x35, 0xc0, 0xfb, 0xf7, 0x52, 0x2c,
+    0xe5, 0x06, 0x50, 0x68, 0x37, 0xf0, 0x08, 0xa1, 0xe1, 0x93, 0x8c, 0x0d, 0xca, 0x53, 0xe1, 0xd0,
+    0x8c, 0xf7, 0xbe, 0x8c, 0xf9, 0xd4, 0x88, 0xd5, 0x83, 0x21, 0x34, 0x23, 0xee, 0xc2, 0x80, 0xe2,
+    0xbb, 0xcf, 0x9d, 0x46, 0x75, 0xbb, 0x91, 0xd5, 0x70, 0xe4, 0xb4, 0x1c, 0xad, 0x6a, 0x2a, 0xa2,
+    0xdb, 0x4e, 0xb0, 0xdb, 0x68, 0x8c, 0x42, 0xad, 0x6e, 0x2d, 0x82, 0xd3, 0x4e, 0xac, 0xda, 0x68,
+    0x8d, 0x12, 0x56, 0x4a, 0x14, 0x2c, 0xce, 0xb2, 0x38, 0x5a, 0xa5, 0x37, 0xf2, 0xae, 0x61, 0xcd,
+    0x68, 0xa2, 0xae, 0x0b, 0xae, 0x69, 0xa6, 0xae, 0x09, 0xaa, 0xa6, 0x7a, 0x5c, 0xd3, 0x6e, 0x0a,
+    0x97, 0x71, 0x63, 0x36, 0xc1, 0xa9, 0x02, 0x47, 0xf2, 0xaf, 0x82, 0x98, 0xa6, 0x81, 0xe1, 0x4e,
+    0x6a, 0xa8, 0x78, 0xd3, 0x90, 0xe4, 0xda, 0x9d, 0x19, 0x2c, 0x3e, 0x23, 0x81, 0xaa, 0xa2, 0x6a,
+    0xda, 0x30, 0xc0, 0x94, 0x1a, 0x28, 0xd2, 0x70, 0x55, 0x8f, 0x31, 0x3a, 0xc1, 0x59, 0xea, 0x24,
+    0x02, 0x58, 0xc5, 0x5f, 0x29, 0xe1, 0x40, 0x89, 0x4b, 0x7d, 0xdd, 0x45, 0xd5, 0x50, 0x2c, 0x17,
+    0x1c, 0xbb, 0x08, 0x25, 0xb7, 0xa5, 0xe2, 0x52, 0x45, 0x9b, 0x21, 0xad, 0xc9, 0x0a, 0xd3, 0x61,
+    0x61, 0xfc, 0x95, 0xbf, 0xf1, 0xb9, 0x38, 0x8d, 0x5c, 0xe5, 0x29, 0x40, 0x55, 0xe3, 0xe0, 0xf3,
+    0x6a, 0x93, 0xe4, 0x9e, 0x70, 0x36, 0x4c, 0x49, 0x01, 0xa3, 0x61, 0x83, 0x2c, 0x0d, 0x67, 0x97,
+    0x30, 0x7b, 0xd6, 0x0a, 0x6e, 0x3e, 0x8b, 0xf3, 0x7e, 0x15, 0xe4, 0x42, 0x05, 0x71, 0xf4, 0x60,
+    0x05, 0xa5, 0xfa, 0x54, 0xb2, 0xa2, 0x4f, 0x35, 0x6a, 0xe8, 0xe6, 0x36, 0x55, 0x1a, 0xab, 0x3d,
+    0x81, 0x9b, 0xa7, 0x87, 0x2b, 0xc8, 0xb1, 0xea, 0xac, 0x1a, 0x18, 0x46, 0x3d, 0x45, 0x95, 0x59,
+    0xd6, 0xb0, 0x20, 0x39, 0x9a, 0x6b, 0xbc, 0xb1, 0x08, 0xbc, 0xe2, 0xd3, 0xcf, 0x78, 0xe8, 0xf2,
+    0xf3, 0xa2, 0x8a, 0x3c, 0xa8, 0xf1, 0x23, 0x54, 0x38, 0x5d, 0x45, 0x5a, 0x71, 0x2e, 0x57, 0x11,
+    0xa6, 0x5a, 0x35, 0x74, 0x7b, 0x9b, 0xa0, 0x02, 0x2f, 0x38, 0x91, 0x2f, 0x6e, 0x60, 0xa5, 0x05,
+    0xc0, 0x62, 0x4c, 0xa1, 0xe1, 0x27, 0x2f, 0x5e, 0x43, 0xde, 0xeb, 0x8d, 0xc8, 0x8b, 0x1d, 0xf2,
+    0x5e, 0x6b, 0xf2, 0x5e, 0x57, 0x90, 0x17, 0x6f, 0x46, 0x5e, 0xb4, 0x86, 0xbc, 0x93, 0x8d, 0xc8,
+    0x8b, 0x1c, 0xf2, 0x4e, 0x34, 0x79, 0x27, 0x15, 0xe4, 0x45, 0x6b, 0xc9, 0x13, 0x47, 0x38, 0x3f,
+    0x1b, 0xc7, 0x24, 0x57, 0x90, 0x2a, 0x0e, 0xa5, 0x1a, 0xe7, 0x30, 0xd7, 0x91, 0x5d, 0x3e, 0x8d,
+    0x6a, 0xb0, 0x50, 0x82, 0xd6, 0xf0, 0xe2, 0x28, 0xb3, 0x56, 0xa6, 0xd9, 0x62, 0x2b, 0x5b, 0x44,
+    0x9f, 0x61, 0x91, 0xb9, 0x09, 0x4f, 0x50, 0x15, 0xd6, 0xbb, 0x1b, 0x32, 0xe4, 0x39, 0x52, 0xaa,
+    0xb8, 0x29, 0xc1, 0x69, 0x94, 0x41, 0xdb, 0x7c, 0x78, 0x88, 0x24, 0x6f, 0x76, 0x5d, 0xb0, 0x4b,
+    0x2c, 0xcf, 0x63, 0xaf, 0xb3, 0x6b, 0xad, 0xd2, 0x7d, 0x8e, 0xb1, 0x9e, 0xd0, 0x27, 0xf8, 0xef,
+    0x6b, 0x98, 0x11, 0xe5, 0x5c, 0x8e, 0x8f, 0x34, 0x87, 0xff, 0x8d, 0x36, 0x9d, 0xe5, 0xd2, 0xbd,
+    0x28, 0xa9, 0x92, 0xdf, 0x25, 0xbf, 0x51, 0x6b, 0x31, 0xb1, 0x06, 0x2c, 0x9a, 0x3c, 0x74, 0xf1,
+    0x27, 0x49, 0x6b, 0x68, 0x71, 0x29, 0x1c, 0x87, 0xbe, 0x8d, 0x73, 0x83, 0x7e, 0x55, 0x6f, 0x05,
+    0xf3, 0x9e, 0x56, 0x44, 0xf0, 0xaa, 0xe5, 0x8a, 0xae, 0xbb, 0x66, 0x19, 0x6a, 0x05, 0x45, 0x64,
+    0xca, 0x27, 0x8a, 0x04, 0x50, 0xec, 0xf6, 0x32, 0xb9, 0x96, 0xe7, 0x6e, 0xea, 0x85, 0x9f, 0x9d,
+    0xa4, 0x33, 0x75, 0x90, 0x85, 0x5f, 0xe3, 0xb5, 0x41, 0xfa, 0x59, 0x17, 0x5b, 0xdb, 0xf4, 0x0c,
+    0x2e, 0x05, 0x06, 0x80, 0xc1, 0xb8, 0x53, 0x4c, 0xa1, 0x29, 0x2e, 0xfc, 0x39, 0x01, 0x2c, 0x81,
+    0x0c, 0xfd, 0x9c, 0xad, 0x19, 0xcf, 0x2f, 0x93, 0x08, 0x96, 0x47, 0xa7, 0xef, 0xce, 0xce, 0x6b,
+    0x4d, 0xfa, 0xd2, 0xc2, 0x81, 0x46, 0x54, 0x04, 0x9b, 0xec, 0x20, 0xd7, 0x65, 0x1c, 0x71, 0x83,
+    0x3a, 0x6f, 0xcc, 0xcb, 0xdd, 0x2d, 0x19, 0x88, 0xb0, 0xb2, 0x8a, 0x79, 0x05, 0x30, 0x7b, 0xe4,
+    0x56, 0x7c, 0x3f, 0x99, 0xcd, 0xf0, 0x26, 0x95, 0x72, 0x21, 0x8a, 0x68, 0x57, 0x29, 0x00, 0xe5,
+    0xa0, 0xf7, 0x2a, 0xbc, 0x00, 0x33, 0xb7, 0x02, 0x51, 0x12, 0x27, 0x55, 0x00, 0x96, 0x41, 0xfb,
+    0xe8, 0x4d, 0xbb, 0x88, 0x16, 0x3a, 0xa1, 0x2a, 0xe7, 0xda, 0xa5, 0x58, 0xd1, 0x16, 0xca, 0x4c,
+    0xaf, 0xcf, 0xe2, 0xbf, 0xa3, 0xd2, 0x51, 0x24, 0x19, 0x9c, 0xa2, 0x7a, 0xa5, 0x35, 0xb0, 0xaf,
+    0x94, 0xd6, 0x1a, 0xfa, 0xbc, 0x86, 0x8c, 0x8e, 0x2c, 0x61, 0xf0, 0x27, 0xe8, 0xed, 0x58, 0x41,
+    0x61, 0x37, 0x02, 0x23, 0xa4, 0x1d, 0x67, 0x6f, 0x83, 0xb7, 0x75, 0x8d, 0xbf, 0xa1, 0x54, 0xe6,
+    0xaf, 0x09, 0x0e, 0x22, 0xda, 0xd1, 0xad, 0x9d, 0x4e, 0x39, 0xc6, 0x49, 0x29, 0x6b, 0x26, 0x0b,
+    0xf0, 0x06, 0x2b, 0xb8, 0xd7, 0xd4, 0x84, 0x61, 0x76, 0x52, 0x74, 0xcc, 0x89, 0x7d, 0x3b, 0x60,
+    0xb6, 0x56, 0xd3, 0xe2, 0x89, 0x12, 0x04, 0x3b, 0x12, 0xbb, 0x23, 0x8d, 0x5f, 0xcb, 0xea, 0x67,
+    0x04, 0x86, 0x15, 0x63, 0x4f, 0x0a, 0x79, 0x91, 0x94, 0x51, 0x11, 0x36, 0x6b, 0xd9, 0x72, 0x5a,
+    0x9a, 0xba, 0x8c, 0xb7, 0x88, 0xff, 0x60, 0x4d, 0xee, 0xda, 0x9a, 0xec, 0x55, 0x3f, 0xa9, 0xcd,
+    0x18, 0x32, 0x40, 0xda, 0xfd, 0x8a, 0xf8, 0xbb, 0x29, 0x7f, 0x35, 0xca, 0xcd, 0x75, 0xbf, 0x94,
+    0xa2, 0x40, 0x85, 0x67, 0x29, 0x04, 0x92, 0xce, 0xea, 0xb5, 0x22, 0x81, 0x42, 0xe6, 0x66, 0x63,
+    0xd8, 0x30, 0x09, 0x03, 0xe6, 0x47, 0x9e, 0x72, 0x9d, 0x7f, 0x01, 0xa5, 0xf5, 0xb0, 0x14, 0x0c,
+    0x74, 0xd1, 0x20, 0x9e, 0x2f, 0xf9, 0xf7, 0xb5, 0x86, 0xbd, 0x0b, 0xea, 0x18, 0x52, 0xeb, 0x8c,
+    0x03, 0xcf, 0x5b, 0x48, 0x95, 0x47, 0x7d, 0x1e, 0xae, 0x2e, 0x52, 0xce, 0x94, 0xc9, 0x41, 0x8b,
+    0x01, 0xe5, 0x23, 0x13, 0x9d, 0xd3, 0xbd, 0xb8, 0x6f, 0x28, 0x4f, 0x86, 0x8f, 0x13, 0x76, 0x89,
+    0x37, 0x3b, 0xc6, 0xc8, 0xac, 0x98, 0x86, 0xa2, 0x62, 0xfb, 0xa1, 0x38, 0x3f, 0xb8, 0xb3, 0xc3,
+    0xde, 0x0b, 0xb5, 0x14, 0x62, 0x17, 0x41, 0x29, 0xbc, 0x6e, 0x06, 0xdc, 0xaa, 0x86, 0xe2, 0xce,
+    0x7a, 0xb6, 0xc2, 0xe4, 0x22, 0x59, 0x7f, 0x37, 0x09, 0x7d, 0xa4, 0xda, 0xc9, 0x04, 0x45, 0x36,
+    0xcc, 0x47, 0x29, 0xa1, 0x9d, 0x5b, 0xc0, 0x5c, 0x1f, 0xc6, 0x62, 0x11, 0x8a, 0x47, 0x80, 0x57,
+    0x78, 0x60, 0x56, 0xd2, 0x83, 0x22, 0x70, 0x80, 0xc5, 0x3f, 0x88, 0x03, 0xbf, 0xeb, 0x1a, 0x8b,
+    0x63, 0xbd, 0x45, 0xd3, 0x4c, 0xee, 0x35, 0x5c, 0xad, 0x6d, 0x59, 0xec, 0x72, 0x8b, 0x96, 0xe2,
+    0x0e, 0xad, 0x8e, 0xa4, 0x1b, 0x53, 0x86, 0xc5, 0x8e, 0x9e, 0x16, 0x0a, 0x3b, 0x6f, 0xb7, 0xdc,
+    0xdc, 0xd8, 0x6b, 0xfd, 0x13, 0xf7, 0x9c, 0x2a, 0x2c, 0x7e, 0x21, 0x8c, 0xb6, 0xca, 0x4e, 0xa5,
+    0xb7, 0xbd, 0x8d, 0x77, 0xce, 0x71, 0xa2, 0x37, 0xc9, 0x95, 0x38, 0x13, 0x5c, 0x3b, 0x2c, 0x11,
+    0x23, 0xde, 0xd1, 0xfe, 0xaa, 0xa2, 0x00, 0xfb, 0xda, 0x11, 0xc0, 0x13, 0x56, 0xc3, 0xe6, 0x40,
+    0x94, 0x3a, 0xcd, 0x75, 0x7f, 0x2f, 0xc7, 0x98, 0x2c, 0x1c, 0x21, 0x1d, 0x7e, 0xcd, 0x59, 0xc2,
+    0x33, 0xce, 0x3d, 0x3c, 0x8b, 0x90, 0x8a, 0x32, 0xe5, 0x19, 0xfe, 0x30, 0x07, 0x3d, 0x72, 0x2a,
+    0x7f, 0x8b, 0x0e, 0xf0, 0x7b, 0x48, 0xc6, 0xfe, 0x3c, 0x68, 0x3c, 0xa1, 0xf7, 0xf7, 0x90, 0x3c,
+    0x19, 0x50, 0xdd, 0x45, 0x76, 0x22, 0x0e, 0x8c, 0x7d, 0x17, 0x47, 0x6b, 0x94, 0x4d, 0x70, 0xd9,
+    0x30, 0x8d, 0x03, 0x30, 0x31, 0x73, 0xb8, 0xb2, 0x54, 0xe8, 0xab, 0x91, 0x75, 0x8f, 0x6d, 0xc6,
+    0x8b, 0xc4, 0xd1, 0x2c, 0xeb, 0xfc, 0x87, 0xc3, 0x4c, 0x95, 0x9d, 0xf9, 0x5d, 0x98, 0x70, 0x66,
+    0x4f, 0x9b, 0x14, 0x8d, 0x58, 0x1f, 0x15, 0x78, 0xb0, 0x31, 0xd1, 0x6d, 0x1c, 0x92, 0x66, 0xf6,
+    0x41, 0x13, 0xac, 0x10, 0xaa, 0x63, 0xb0, 0x38, 0x9e, 0xf1, 0xf4, 0x01, 0x4e, 0x1c, 0x5a, 0x07,
+    0xb5, 0x14, 0xe8, 0x92, 0x85, 0x18, 0x84, 0x6e, 0x63, 0xf3, 0xd0, 0x6b, 0x4d, 0x5c, 0x17, 0x50,
+    0x2b, 0xd8, 0xe2, 0x1c, 0x81, 0x02, 0x88, 0x21, 0xcc, 0xa2, 0x54, 0x0c, 0x6a, 0xfb, 0x10, 0x94,
+    0x52, 0x68, 0x1f, 0x16, 0x3c, 0xec, 0x6a, 0xa0, 0xb8, 0x33, 0x4f, 0xa2, 0x14, 0x72, 0xf5, 0x25,
+    0xa1, 0xd5, 0xe2, 0xe4, 0x73, 0xd5, 0x7f, 0x0f, 0xdc, 0x46, 0x03, 0xe1, 0xc1, 0xf4, 0xab, 0x2f,
+    0x5a, 0xc2, 0x94, 0x09, 0xd5, 0x8b, 0xf0, 0xbc, 0x84, 0x7f, 0xa0, 0x10, 0xb9, 0x9d, 0x5e, 0x99,
+    0xaa, 0xf6, 0x61, 0x14, 0x7a, 0xb6, 0xd9, 0x56, 0x10, 0xc8, 0x3f, 0xcb, 0xda, 0x95, 0xe4, 0xf9,
+    0x33, 0xcc, 0x6a, 0xda, 0xe2, 0x22, 0xd6, 0xbc, 0x7e, 0x31, 0xe3, 0x09, 0x3a, 0x7b, 0x26, 0xae,
+    0x58, 0x87, 0x8d, 0x41, 0x35, 0x34, 0xfc, 0xa7, 0x6c, 0x60, 0x78, 0x4a, 0xde, 0x99, 0x4b, 0xd7,
+    0xad, 0xcf, 0xc0, 0x2d, 0xc4, 0x9b, 0xc3, 0x03, 0xa6, 0x52, 0xf0, 0xda, 0xb3, 0x97, 0x23, 0x8f,
+    0x52, 0x00, 0xfa, 0x40, 0xc3, 0xf2, 0x89, 0xc3, 0x4e, 0x0c, 0x58, 0x8c, 0xcb, 0x4d, 0x77, 0x22,
+    0x04, 0xcf, 0xed, 0x3c, 0x8d, 0x67, 0xc5, 0x32, 0x7d, 0x71, 0xdf, 0x4d, 0x09, 0x01, 0x45, 0x9d,
+    0xe7, 0xa2, 0xed, 0x05, 0x2d, 0x1e, 0x4c, 0xc2, 0x88, 0x69, 0x13, 0xe6, 0x49, 0x0e, 0x6e, 0x21,
+    0xe3, 0xb3, 0x45, 0x7e, 0xbb, 0x52, 0x02, 0x72, 0x13, 0xe2, 0x80, 0x98, 0x68, 0x6e, 0x19, 0x5b,
+    0x0c, 0x07, 0x9a, 0x32, 0x9f, 0x28, 0x9c, 0x54, 0x71, 0xf6, 0xae, 0x7d, 0x67, 0x23, 0xa5, 0x28,
+    0x6e, 0x94, 0x08, 0xb1, 0x64, 0xcb, 0x71, 0x26, 0x23, 0x3a, 0x8d, 0x26, 0xeb, 0x0e, 0x8b, 0xb5,
+    0x2e, 0x56, 0x1c, 0xdd, 0x07, 0xe8, 0x68, 0x53, 0xa8, 0x62, 0xfb, 0x73, 0x53, 0xb0, 0xe2, 0x16,
+    0xc8, 0x26, 0x70, 0xc5, 0xde, 0xe8, 0xa6, 0x70, 0xc5, 0xf5, 0x8e, 0x4a, 0xb8, 0x4e, 0x97, 0xc9,
+    0x1d, 0xbc, 0x03, 0x29, 0xeb, 0xe6, 0x96, 0xda, 0x98, 0x3b, 0x50, 0x92, 0x52, 0x45, 0x40, 0xef,
+    0x81, 0xe6, 0x53, 0x15, 0x02, 0xb2, 0x03, 0x4d, 0xa4, 0xaf, 0x6b, 0xcb, 0xd9, 0x76, 0xdc, 0x0d,
+    0xea, 0xf5, 0x7c, 0x39, 0x3b, 0xd5, 0x4e, 0xf0, 0x42, 0x6d, 0x58, 0x6f, 0x06, 0x67, 0xb4, 0x12,
+    0xd0, 0xa6, 0x3d, 0x58, 0xda, 0xc9, 0x2e, 0x83, 0xda, 0xb4, 0xd3, 0x4a, 0x3b, 0xdb, 0x1e, 0x5b,
+    0x26, 0xb6, 0xa6, 0xd1, 0x8e, 0xa9, 0x9f, 0x23, 0xe7, 0x37, 0x6d, 0x30, 0x9b, 0x05, 0xb8, 0xbd,
+    0x69, 0x0c, 0x65, 0x5c, 0xf3, 0x69, 0x87, 0x58, 0x2c, 0xce, 0xd8, 0x0c, 0xb3, 0xa6, 0xc0, 0xb8,
+    0x56, 0xd1, 0x19, 0xf4, 0xd3, 0xb3, 0x95, 0xe3, 0xdb, 0xda, 0x0a, 0x3f, 0xa0, 0x0e, 0x6c, 0x6e,
+    0xd9, 0x5b, 0xde, 0x07, 0xa2, 0x3f, 0x44, 0xb1, 0xb1, 0xb3, 0x7d, 0x20, 0xc5, 0x2b, 0x5e, 0x18,
+    0x3b, 0xd8, 0x07, 0x52, 0x58, 0x3e, 0xe5, 0xf1, 0x27, 0xd3, 0xd3, 0x0a, 0xe4, 0xdf, 0xfb, 0x5f,
+    0x2f, 0x72, 0xef, 0x21, 0x00, 0x8f, 0xd8, 0x7d, 0xdb, 0xea, 0x86, 0x4c, 0x5f, 0xda, 0xc9, 0x0d,
+    0xc5, 0xd9, 0x24, 0x2d, 0xd5, 0xc0, 0x92, 0xeb, 0x4a, 0xb1, 0x7a, 0xf0, 0x1c, 0xf8, 0x98, 0x6b,
+    0xfa, 0x64, 0x54, 0x91, 0xa7, 0xa1, 0xb4, 0x5e, 0xb5, 0x36, 0x35, 0x37, 0x52, 0xcb, 0xf2, 0xee,
+    0xa6, 0xa3, 0xe5, 0xc6, 0xde, 0x23, 0x01, 0x7c, 0x89, 0xdf, 0x5e, 0xac, 0x6f, 0xb2, 0x0d, 0xe9,
+    0x00, 0x72, 0x76, 0x0d, 0x37, 0x01, 0x66, 0x6f, 0x20, 0x3a, 0xf0, 0x8c, 0x6d, 0xbe, 0x4d, 0x60,
+    0x99, 0x3b, 0x7e, 0x7e, 0x48, 0xaf, 0xef, 0x0b, 0x29, 0xae, 0x82, 0x74, 0x72, 0x5f, 0x48, 0x91,
+    0x0f, 0x92, 0x6f, 0x6f, 0x6b, 0x53, 0xa8, 0xbe, 0x6d, 0x2e, 0x07, 0x83, 0x6f, 0xa7, 0x69, 0x13,
+    0xf0, 0xde, 0x4d, 0x27, 0xbf, 0x3d, 0x73, 0x74, 0x92, 0x8c, 0x97, 0x47, 0x55, 0x9f, 0xb2, 0xae,
+    0xe9, 0xaf, 0x29, 0x0b, 0x66, 0x6c, 0xe3, 0x17, 0xe3, 0x4d, 0x34, 0xbf, 0xe2, 0xe4, 0x75, 0x5d,
+    0xb8, 0x63, 0xae, 0xc0, 0x5e, 0xec, 0x7e, 0x03, 0x4e, 0xad, 0xc3, 0x4f, 0xf1, 0xd3, 0x4d, 0x06,
+    0x2e, 0x95, 0x96, 0x4b, 0xec, 0xbe, 0x6b, 0x2c, 0x39, 0x43, 0x9f, 0x31, 0xc7, 0xca, 0xcc, 0x4a,
+    0xa0, 0x55, 0x85, 0xcd, 0xde, 0xd5, 0x06, 0x8c, 0x96, 0xb2, 0xbb, 0x58, 0xad, 0x0c, 0x5d, 0xeb,
+    0x91, 0xfe, 0xe3, 0xbf, 0xab, 0xd0, 0x16, 0x7b, 0xd6, 0x7a, 0x56, 0x28, 0xf6, 0x89, 0xdd, 0xa2,
+    0x13, 0x77, 0xaa, 0xc0, 0xb4, 0x0c, 0x17, 0x98, 0x64, 0xcb, 0x3f, 0x49, 0xb0, 0x7a, 0x16, 0xc6,
+    0xb8, 0x4b, 0x8b, 0x39, 0x48, 0xe7, 0xea, 0x84, 0x47, 0x30, 0x9d, 0x26, 0xd7, 0x20, 0xd6, 0x15,
+    0x24, 0x79, 0x76, 0x51, 0x81, 0x16, 0xaf, 0x42, 0x3f, 0x65, 0x9d, 0xca, 0x77, 0xc7, 0x96, 0x56,
+    0xe8, 0x6c, 0x40, 0x42, 0xb3, 0x99, 0xb9, 0x95, 0xaa, 0xc8, 0x57, 0x51, 0xdc, 0x0e, 0x65, 0xcc,
+    0xeb, 0x56, 0x91, 0xe8, 0xd9, 0x1a, 0xc5, 0x1b, 0x2f, 0xa5, 0xe1, 0x20, 0x89, 0x2b, 0xbf, 0xb0,
+    0x29, 0x33, 0xd3, 0xf3, 0xdc, 0x9b, 0xaa, 0xf2, 0xdc, 0xeb, 0x9e, 0x14, 0x39, 0xf0, 0x8c, 0x98,
+    0xe6, 0x96, 0x3e, 0xbc, 0x71, 0xa0, 0x95, 0x1b, 0x5c, 0x71, 0x43, 0xaf, 0x0e, 0x2c, 0x15, 0x6c,
+    0x6e, 0x15, 0xc7, 0x17, 0x0e, 0xb4, 0xe5, 0x34, 0x4a, 0x63, 0x5d, 0xfa, 0xda, 0x28, 0x8d, 0x74,
+    0xe9, 0x89, 0x28, 0x2d, 0xef, 0x73, 0x1f, 0x78, 0x3b, 0xaf, 0xb9, 0xe5, 0xd9, 0x4d, 0x3e, 0x28,
+    0x8b, 0xd2, 0x9d, 0xeb, 0x56, 0xe7, 0x0f, 0x2a, 0x6d, 0x10, 0x88, 0x74, 0x42, 0xd5, 0x09, 0x15,
+    0xf3, 0x84, 0xc9, 0x9c, 0x48, 0xd2, 0x1d, 0x2a, 0x45, 0xef, 0x1f, 0x32, 0x35, 0x82, 0x9d, 0xec,
+    0x75, 0x56, 0x9c, 0xa4, 0x2d, 0x4d, 0x81, 0xd0, 0x00, 0x93, 0xfb, 0xad, 0x3a, 0x7c, 0xeb, 0x99,
+    0xe8, 0xa0, 0xd5, 0xee, 0xea, 0x56, 0xe5, 0x29, 0x0d, 0x23, 0x47, 0x98, 0xfb, 0xad, 0xb6, 0x49,
+    0xab, 0xd8, 0x6c, 0x85, 0x49, 0xd4, 0x36, 0x6a, 0x65, 0x72, 0x55, 0xa3, 0x44, 0x64, 0xeb, 0x9a,
+    0x55, 0xcf, 0x45, 0x78, 0x4b, 0xba, 0xbd, 0x8a, 0xc3, 0x15, 0x73, 0x8d, 0x6a, 0xbb, 0xc2, 0x3d,
+    0x2a, 0xb9, 0x51, 0xfa, 0x95, 0xfa, 0xd2, 0x81, 0x67, 0x27, 0xdc, 0xd9, 0xc0, 0x11, 0x9f, 0xe1,
+    0xf2, 0x45, 0x76, 0xc5, 0x17, 0xf6, 0x60, 0x7c, 0xfe, 0xba, 0x55, 0x93, 0x51, 0xb2, 0xd6, 0xf9,
+    0xed, 0x82, 0xd7, 0xa0, 0x4a, 0xb0, 0x58, 0x4c, 0x63, 0x71, 0x31, 0x6d, 0x07, 0x6f, 0x63, 0xd4,
+    0xb6, 0xee, 0x54, 0x28, 0x98, 0x2e, 0x15, 0x89, 0xf5, 0x5a, 0x3c, 0xb9, 0x2d, 0x28, 0x79, 0xf4,
+    0x8e, 0x90, 0x62, 0x8e, 0x38, 0x8d, 0xec, 0xc8, 0xb0, 0x3f, 0x43, 0x84, 0xda, 0xe2, 0x91, 0xdb,
+    0x3b, 0xc1, 0x04, 0x0d, 0x2b, 0xb6, 0x5e, 0xb5, 0xa5, 0x83, 0xdb, 0x47, 0xc5, 0xe7, 0xc9, 0x1e,
+    0xb7, 0x9d, 0x13, 0x50, 0x18, 0x5f, 0x41, 0x7b, 0xd4, 0x46, 0x8e, 0x93, 0x2e, 0xbe, 0x64, 0x2a,
+    0x9e, 0xa5, 0x1c, 0x3f, 0x50, 0x03, 0x62, 0x91, 0x0f, 0xd7, 0xc1, 0x9c, 0x32, 0x91, 0x51, 0x43,
+    0xda, 0xf8, 0x53, 0x74, 0x18, 0x66, 0x23, 0xbb, 0xcf, 0x76, 0x1f, 0x41, 0xfa, 0x3d, 0xf6, 0xfa,
+    0x74, 0xcf, 0xa6, 0x2a, 0x7d, 0x9a, 0x22, 0xef, 0x3e, 0x1d, 0x4b, 0x8d, 0x57, 0xf4, 0xac, 0x00,
+    0xfe, 0x95, 0xba, 0x96, 0x80, 0xe5, 0x5f, 0xad, 0x77, 0xb3, 0xcb, 0xa0, 0x37, 0x18, 0xbe, 0xe2,
+    0x37, 0xf5, 0xf1, 0x72, 0x32, 0xe1, 0x69, 0xb1, 0xf2, 0xc9, 0x13, 0x71, 0xe1, 0x63, 0x7c, 0x9b,
+    0xc3, 0x6a, 0x17, 0xe8, 0x7b, 0x96, 0xa6, 0xc1, 0x6d, 0x1b, 0xb3, 0xac, 0xd4, 0xa9, 0xac, 0xc9,
+    0xc6, 0x58, 0x3c, 0xae, 0x38, 0xfd, 0xd3, 0x13, 0xa7, 0x7f, 0x1a, 0xed, 0x5f, 0x92, 0x78, 0x5e,
+    0xaf, 0xa9, 0xe0, 0xb3, 0xbc, 0x5d, 0x1a, 0xa6, 0xb7, 0x0b, 0x10, 0xcd, 0x9f, 0xff, 0xcc, 0xc4,
+    0x13, 0xc6, 0x5a, 0x72, 0x71, 0x80, 0x46, 0x5e, 0xba, 0xb2, 0xca, 0xdb, 0x51, 0x7c, 0xc1, 0x33,
+    0xec, 0xb1, 0x57, 0xcf, 0x5a, 0x40, 0x30, 0xb0, 0x2c, 0xe9, 0x95, 0x37, 0xaa, 0xe8, 0x35, 0x92,
+    0x43, 0x64, 0xd7, 0x71, 0xfb, 0xe9, 0x27, 0x70, 0x64, 0xf7, 0x89, 0x68, 0xf9, 0xba, 0x21, 0x2e,
+    0x86, 0x0b, 0xf6, 0xfe, 0x55, 0x6e, 0x52, 0x61, 0xad, 0x7e, 0x4f, 0x54, 0xfb, 0xb8, 0xd5, 0xb9,
+    0xd9, 0xed, 0xed, 0x07, 0xbd, 0xc9, 0x68, 0xbf, 0xc9, 0x3a, 0x37, 0x7b, 0xdd, 0xfe, 0xde, 0xee,
+    0xee, 0xa8, 0x8b, 0xcf, 0xe3, 0x41, 0xd8, 0x99, 0x8c, 0xc3, 0x09, 0x3e, 0xf3, 0xd1, 0x78, 0x10,
+    0x8d, 0x83, 0x01, 0x3e, 0xf7, 0x47, 0x83, 0x61, 0xd8, 0x1b, 0x8c, 0xf1, 0x79, 0x30, 0x9a, 0x74,
+    0xbb, 0xdd, 0x09, 0xd5, 0x1f, 0xf5, 0xfa, 0x93, 0xfd, 0x5e, 0xb0, 0x8b, 0xcf, 0xc1, 0xb8, 0x1b,
+    0x0e, 0x78, 0x34, 0x68, 0x02, 0xfc, 0x68, 0xbf, 0xb3, 0x17, 0x04, 0x02, 0x7e, 0xb7, 0xb7, 0xdf,
+    0x1f, 0x8c, 0x3b, 0x54, 0xbf, 0xb7, 0xdb, 0xef, 0xee, 0x0f, 0xc6, 0x9c, 0xe0, 0x0c, 0x3a, 0xe1,
+    0x5e, 0x14, 0xf6, 0x89, 0x86, 0xde, 0x98, 0x0f, 0xa2, 0x3d, 0x82, 0xb3, 0xdf, 0x89, 0xf8, 0xb8,
+    0x3b, 0xa1, 0x3a, 0xa3, 0x71, 0x14, 0x76, 0x86, 0xc1, 0x1e, 0x3e, 0x87, 0xdd, 0xd1, 0x78, 0xd2,
+    0x85, 0x3a, 0x00, 0x9f, 0xef, 0x8e, 0xc6, 0xc3, 0x51, 0x48, 0x30, 0xf9, 0x64, 0xcc, 0x77, 0xf7,
+    0xf6, 0x87, 0xf8, 0xdc, 0x99, 0x40, 0xad, 0x28, 0x1c, 0x0a, 0x5c, 0x9d, 0x30, 0xe8, 0x86, 0x21,
+    0x3d, 0x47, 0x7c, 0xd4, 0x0b, 0x87, 0xc4, 0xd7, 0x6e, 0xb0, 0xb7, 0xbb, 0xbf, 0x1b, 0x04, 0x44,
+    0x43, 0x38, 0xee, 0x04, 0xd0, 0x80, 0x68, 0x18, 0x82, 0x40, 0xf6, 0xa3, 0x00, 0xe1, 0x8f, 0xf6,
+    0xfb, 0x7c, 0xd0, 0x1d, 0xf4, 0x88, 0xaf, 0xfd, 0x7e, 0x37, 0x1c, 0x0e, 0x23, 0x92, 0x4f, 0xa7,
+    0xd3, 0xef, 0xed, 0x85, 0xc4, 0xd7, 0x78, 0x32, 0x18, 0xed, 0x4d, 0x42, 0x41, 0xdb, 0x90, 0x77,
+    0x3a, 0xe3, 0x09, 0xf1, 0x12, 0x0d, 0x82, 0xbd, 0x51, 0x77, 0x97, 0xca, 0x3b, 0xc3, 0x30, 0x18,
+    0xf6, 0x07, 0x44, 0x67, 0x77, 0xb7, 0x37, 0xea, 0x8d, 0x86, 0x7b, 0x08, 0xbf, 0xb7, 0x37, 0xde,
+    0xeb, 0x04, 0xfb, 0x24, 0xdb, 0x1e, 0xef, 0x8e, 0x7b, 0xdd, 0x3e, 0xc1, 0xdc, 0x8d, 0x80, 0xca,
+    0x68, 0x42, 0xf4, 0x0c, 0xfa, 0x7d, 0x10, 0x45, 0x97, 0x60, 0x0e, 0x07, 0x9d, 0x60, 0xaf, 0x3f,
+    0xd8, 0x15, 0x74, 0x0e, 0x83, 0x4e, 0x30, 0xa6, 0xbe, 0xd8, 0xef, 0x86, 0xbd, 0x70, 0xd4, 0x13,
+    0xb2, 0xea, 0xed, 0xf5, 0x7a, 0xe1, 0x3e, 0xc9, 0x3f, 0xe8, 0x8d, 0x27, 0x7c, 0x3f, 0xe8, 0x0a,
+    0xfa, 0xbb, 0xc1, 0x70, 0xb8, 0x4b, 0xf5, 0xc3, 0xde, 0xee, 0x78, 0x1f, 0x50, 0xd3, 0xf3, 0xde,
+    0x30, 0x1c, 0x74, 0x03, 0x41, 0x73, 0x17, 0x80, 0xec, 0x77, 0x47, 0xf4, 0x3c, 0x1c, 0x8d, 0x3a,
+    0xc3, 0x1e, 0xe1, 0x9a, 0xec, 0x76, 0x78, 0x7f, 0x20, 0xe8, 0xec, 0x42, 0x47, 0x04, 0x1d, 0x68,
+    0x0b, 0xf0, 0xbb, 0xa3, 0x60, 0x37, 0xec, 0x76, 0x49, 0xce, 0x5d, 0xde, 0x07, 0x48, 0x1d, 0xa2,
+    0xbf, 0x07, 0xa2, 0xdd, 0xdb, 0xdb, 0x25, 0xfa, 0xfb, 0xbb, 0xe3, 0xce, 0x38, 0x1c, 0x4b, 0xfd,
+    0xe9, 0x86, 0x9d, 0x70, 0x4c, 0xb8, 0x76, 0x79, 0xb4, 0x1f, 0x04, 0xbb, 0x42, 0xfe, 0xe3, 0x51,
+    0x18, 0x06, 0xbb, 0xd4, 0x2f, 0xc3, 0xfd, 0x1e, 0x1f, 0x4e, 0x40, 0x86, 0x00, 0x1f, 0xc0, 0x80,
+    0x5e, 0x71, 0xe2, 0x6b, 0x6f, 0x3f, 0x18, 0x0c, 0xfb, 0xa2, 0xef, 0xf6, 0x77, 0xc3, 0xfd, 0xbd,
+    0xfd, 0xae, 0xd0, 0x93, 0x30, 0xdc, 0xeb, 0xf4, 0x04, 0xde, 0x51, 0x67, 0xcc, 0x27, 0x93, 0x09,
+    0xc1, 0x0c, 0x76, 0x07, 0x20, 0x76, 0x4e, 0xfc, 0x42, 0xe9, 0x28, 0xe8, 0x4f, 0x64, 0x1f, 0xed,
+    0x75, 0xf7, 0xf6, 0x27, 0xbd, 0xad, 0x4f, 0x7a, 0x0d, 0xfb, 0xaa, 0x62, 0x78, 0x80, 0x80, 0x47,
+    0x7c, 0x38, 0xa4, 0x66, 0xe3, 0xf1, 0x70, 0x2f, 0xe0, 0x42, 0x04, 0x7d, 0xe8, 0xe7, 0x49, 0x7f,
+    0x4f, 0xa8, 0xc5, 0x60, 0x77, 0x32, 0x19, 0xf4, 0x05, 0x1b, 0xdd, 0x0e, 0x1f, 0xf4, 0xf6, 0x26,
+    0x42, 0x65, 0x3b, 0x83, 0xe1, 0xfe, 0x3e, 0x89, 0xa0, 0x3b, 0xd9, 0xef, 0x47, 0xa3, 0x40, 0x0c,
+    0x9b, 0x31, 0xef, 0x84, 0x20, 0x67, 0x03, 0x7d, 0x54, 0xec, 0x22, 0x1b, 0xc3, 0x58, 0x0e, 0xf9,
+    0x22, 0x5a, 0x1f, 0x45, 0x3c, 0xfa, 0x91, 0xb2, 0xbf, 0x40, 0xe5, 0x37, 0x41, 0x7e, 0xd9, 0x0e,
+    0x79, 0x3c, 0xad, 0x8b, 0xb3, 0xa1, 0x22, 0x2d, 0x0c, 0x98, 0xc0, 0x51, 0x83, 0xed, 0xb0, 0xe1,
+    0x6e, 0x83, 0x7d, 0x07, 0xff, 0xda, 0x8d, 0xcb, 0x38, 0x4c, 0xa0, 0x0d, 0xf1, 0x9d, 0x70, 0x1e,
+    0xb5, 0xc1, 0xd6, 0xaa, 0x8b, 0x95, 0xa2, 0xe4, 0xa3, 0x81, 0xe2, 0x13, 0x7a, 0x4c, 0x30, 0x38,
+    0x75, 0x84, 0x21, 0x06, 0x90, 0x02, 0x30, 0x6e, 0x4d, 0xff, 0x8d, 0x8e, 0x21, 0x0a, 0x38, 0x9a,
+    0x03, 0xac, 0x83, 0x50, 0x85, 0x7c, 0x2d, 0xac, 0xac, 0xc5, 0xa0, 0xe7, 0x88, 0x9b, 0x09, 0x38,
+    0x86, 0xa9, 0xc5, 0xcd, 0x0e, 0xaa, 0x52, 0x47, 0xfc, 0xaf, 0xb1, 0x16, 0x0e, 0x68, 0x83, 0xd5,
+    0xfa, 0x3b, 0xb6, 0xdf, 0x60, 0xc7, 0xc7, 0xc7, 0xac, 0xb8, 0xbc, 0xf1, 0xc1, 0xd3, 0xd1, 0x20,
+    0x2b, 0xe3, 0x3a, 0x03, 0x1e, 0x7b, 0xac, 0xdf, 0x34, 0xd9, 0x9c, 0xb6, 0x00, 0xeb, 0x37, 0x04,
+    0x00, 0x17, 0xe3, 0xf8, 0xfc, 0xf4, 0x29, 0xab, 0xf7, 0x7b, 0x78, 0xce, 0xab, 0x61, 0xa6, 0xe9,
+    0x49, 0x26, 0x93, 0x8c, 0xae, 0xbb, 0x77, 0x0e, 0xd5, 0xf3, 0x53, 0xab, 0xbf, 0x74, 0xf1, 0x93,
+    0x23, 0xea, 0x9a, 0x5f, 0xbd, 0x29, 0x7e, 0xba, 0x43, 0x99, 0xd5, 0xe7, 0xc3, 0xc7, 0x18, 0xa5,
+    0x4c, 0xdc, 0x5e, 0x68, 0x6e, 0x15, 0x08, 0xa8, 0xfb, 0x1d, 0xdb, 0x75, 0xd3, 0x04, 0x51, 0x63,
+    0x00, 0x02, 0x7d, 0xae, 0x52, 0x03, 0xc9, 0xf8, 0x0c, 0x86, 0x96, 0x91, 0xb1, 0x3a, 0x80, 0x05,
+    0xd2, 0xbb, 0x83, 0x4f, 0x4d, 0xb6, 0xd7, 0x60, 0xff, 0xa7, 0x54, 0xd8, 0xdd, 0xc7, 0xd2, 0xa2,
+    0x84, 0x58, 0xef, 0x17, 0x81, 0x9e, 0xae, 0x0d, 0xa8, 0x87, 0x4d, 0x5c, 0x40, 0x54, 0x38, 0x32,
+    0xe0, 0xf4, 0x04, 0x98, 0x2e, 0xf6, 0x81, 0xe4, 0x4b, 0x22, 0x18, 0x7e, 0x02, 0x5e, 0x80, 0xba,
+    0x27, 0xb2, 0x60, 0x8f, 0x7e, 0x77, 0x55, 0xf2, 0xa4, 0x8f, 0x30, 0xa2, 0x60, 0xc0, 0xc0, 0xf8,
+    0x01, 0x8b, 0x0b, 0x06, 0x00, 0x06, 0xd5, 0x45, 0x93, 0x91, 0xfa, 0xbd, 0xf2, 0xa7, 0x48, 0x2a,
+    0xb1, 0x9e, 0x23, 0xc5, 0x38, 0x26, 0xea, 0x44, 0x21, 0x00, 0x19, 0x6a, 0x72, 0xe1, 0x47, 0xb7,
+    0x6b, 0xfe, 0xea, 0x0d, 0xc0, 0x45, 0x83, 0xaa, 0x75, 0xfc, 0x6a, 0xdb, 0x84, 0x38, 0xf8, 0x4f,
+    0x7c, 0xbc, 0xa0, 0xe2, 0x7f, 0x45, 0xd2, 0x89, 0xd2, 0x4f, 0xfa, 0x9c, 0x4c, 0x0f, 0x55, 0x85,
+    0x9a, 0x03, 0xa9, 0x3d, 0x0d, 0x0b, 0x7e, 0x74, 0xfb, 0xe6, 0xaf, 0x5e, 0x4f, 0x42, 0x0e, 0x00,
+    0xdc, 0x98, 0x20, 0xe3, 0x53, 0x48, 0x4f, 0x63, 0x7a, 0x02, 0xe1, 0xe0, 0xa0, 0xbe, 0x38, 0x64,
+    0x17, 0xb8, 0xab, 0x7f, 0xc8, 0x26, 0xf0, 0x87, 0x1f, 0x32, 0x5c, 0x9e, 0xd4, 0x23, 0x3c, 0x93,
+    0xd2, 0x95, 0xaa, 0x0c, 0xab, 0x1c, 0x3c, 0x7a, 0x79, 0xc8, 0x42, 0xf4, 0x56, 0x0e, 0xd1, 0x2b,
+    0x61, 0xc1, 0x21, 0x43, 0xfb, 0x51, 0x07, 0x7e, 0xa1, 0x66, 0x4f, 0xd7, 0xbc, 0xdb, 0x7a, 0xf5,
+    0xb1, 0xf3, 0x09, 0x95, 0x0e, 0x6a, 0xbc, 0xfa, 0xd8, 0xa5, 0xc7, 0x31, 0x3e, 0xf6, 0xe8, 0x31,
+    0xc4, 0xc7, 0x3e, 0x3d, 0x46, 0x87, 0x50, 0x77, 0x97, 0x1e, 0x39, 0x96, 0x0e, 0xe8, 0x71, 0x82,
+    0x8f, 0x43, 0x7a, 0xbc, 0xc0, 0xc7, 0x3d, 0x7a, 0xbc, 0x2c, 0xfc, 0x0a, 0xe5, 0x89, 0xb8, 0x76,
+    0xa5, 0xdf, 0x2b, 0x8c, 0x1b, 0x55, 0xf9, 0x9b, 0xc7, 0x4a, 0x88, 0x37, 0x85, 0x95, 0x78, 0xd5,
+    0x86, 0x5e, 0x7d, 0x11, 0x80, 0x97, 0x58, 0xc7, 0xcd, 0xbf, 0x26, 0x8b, 0x69, 0x0c, 0x16, 0x00,
+    0x8c, 0xa1, 0x4f, 0x63, 0xa0, 0xc9, 0xe8, 0xda, 0x92, 0x8e, 0x84, 0xb0, 0x53, 0x70, 0xd7, 0x62,
+    0x70, 0x7b, 0xc1, 0x6d, 0x4c, 0xa6, 0x57, 0xbc, 0x2e, 0xdc, 0x23, 0xe5, 0x0f, 0x39, 0xa9, 0x1c,
+    0x3c, 0x37, 0xf7, 0x9d, 0x03, 0x0f, 0xe7, 0xfc, 0x66, 0xe5, 0xa9, 0xad, 0x22, 0xc3, 0xa1, 0x71,
+    0x3d, 0x51, 0xa6, 0x46, 0xfc, 0x21, 0x48, 0xd7, 0x35, 0x35, 0xb3, 0x28, 0xea, 0xdb, 0x36, 0x32,
+    0x3b, 0x41, 0x46, 0x1f, 0x8c, 0xa5, 0x03, 0x0a, 0xe2, 0x1e, 0x39, 0x78, 0x9c, 0x56, 0xea, 0x83,
+    0x1c, 0x20, 0x4c, 0x19, 0xda, 0xb6, 0x22, 0x7a, 0xcf, 0xd3, 0x90, 0x6e, 0x28, 0x8b, 0x4c, 0x09,
+    0x6a, 0x92, 0x98, 0xc5, 0x74, 0x14, 0xb4, 0x59, 0x00, 0xbf, 0x4e, 0xe3, 0x1c, 0xd6, 0x99, 0x60,
+    0x5e, 0x2d, 0x68, 0x38, 0x65, 0x88, 0x33, 0xa3, 0x06, 0x13, 0xf2, 0x6c, 0x38, 0xa5, 0x53, 0xc5,
+    0xc8, 0xae, 0x83, 0xe3, 0x09, 0xab, 0xfd, 0xa9, 0xa6, 0xce, 0x72, 0xa0, 0xbc, 0xdc, 0x03, 0x28,
+    0x1f, 0x00, 0x97, 0x3c, 0x0a, 0x33, 0x99, 0x06, 0xd9, 0xa5, 0xf0, 0xd3, 0x1d, 0x30, 0x80, 0xff,
+    0x65, 0x7c, 0xc3, 0xa3, 0x7a, 0xb7, 0xa1, 0x20, 0x1a, 0x49, 0xc1, 0x3c, 0x32, 0xb9, 0xe2, 0x29,
+    0xac, 0x7a, 0x51, 0x26, 0x45, 0x3a, 0x12, 0x1f, 0xf6, 0xbf, 0xa9, 0x7a, 0x4c, 0xe5, 0xd7, 0x14,
+    0x27, 0xc1, 0x56, 0x43, 0x9f, 0xd0, 0x62, 0x66, 0x0d, 0x68, 0x91, 0xc9, 0x84, 0x89, 0xba, 0x82,
+    0x2b, 0x0d, 0x4b, 0xac, 0x72, 0xf0, 0xa6, 0xdc, 0x52, 0x7c, 0x8c, 0x9c, 0xe9, 0x73, 0x3c, 0x65,
+    0xd1, 0x96, 0x8f, 0xdd, 0xd7, 0xbe, 0x7d, 0xb9, 0xbb, 0xdb, 0xef, 0x0f, 0xcb, 0xd7, 0x80, 0xed,
+    0xec, 0x9e, 0xc5, 0xe6, 0x16, 0xd0, 0xb0, 0xf6, 0x8c, 0xa1, 0x92, 0x80, 0x52, 0xb5, 0x6f, 0x74,
+    0xab, 0x36, 0x3e, 0xa9, 0xcc, 0x72, 0xe5, 0x23, 0x0f, 0x99, 0xfa, 0x80, 0xa8, 0x82, 0x40, 0xf8,
+    0xbc, 0xc7, 0xb1, 0xf1, 0x94, 0xec, 0x11, 0x73, 0x00, 0x83, 0x0d, 0x5a, 0x11, 0x9b, 0x31, 0x47,
+    0x42, 0xad, 0xb1, 0xf2, 0x38, 0xcf, 0x46, 0x03, 0xf1, 0x2b, 0x40, 0x70, 0x7a, 0x1a, 0xb5, 0x74,
+    0x29, 0x6e, 0x55, 0xe3, 0xe9, 0x96, 0x6c, 0x39, 0x13, 0x4a, 0x74, 0x8f, 0xc1, 0xed, 0x8c, 0xa2,
+    0x5a, 0xe7, 0x4f, 0x0f, 0x6a, 0xef, 0x51, 0x95, 0x9a, 0xbc, 0xd5, 0x0b, 0x82, 0x6e, 0x63, 0x26,
+    0xd9, 0x36, 0x9f, 0x47, 0xd9, 0x87, 0x38, 0xbf, 0xac, 0xd7, 0x44, 0xee, 0x58, 0x11, 0x79, 0xc0,
+    0x53, 0x72, 0x5a, 0x71, 0xb0, 0x32, 0xac, 0x57, 0x77, 0xc4, 0x01, 0xdc, 0x1d, 0x51, 0xad, 0x49,
+    0xc9, 0x7a, 0xac, 0x4e, 0x25, 0xa0, 0x01, 0x1a, 0xf4, 0x1f, 0xc8, 0x46, 0xd7, 0x55, 0x00, 0x42,
+    0xaf, 0xa3, 0x75, 0x8e, 0x0f, 0xbd, 0x22, 0x5d, 0x81, 0x08, 0xef, 0xd4, 0x4a, 0x53, 0xbc, 0xe9,
+    0x31, 0xba, 0x45, 0x8a, 0x19, 0x4f, 0xcd, 0xf1, 0x2b, 0x07, 0xc1, 0x46, 0x59, 0xe6, 0x56, 0x75,
+    0xaa, 0x19, 0xb0, 0x08, 0x22, 0x47, 0xb5, 0x3d, 0x87, 0xcc, 0x4b, 0x5c, 0x2d, 0xd3, 0xa9, 0xe6,
+    0xa7, 0x18, 0x88, 0xf7, 0x38, 0x13, 0xaa, 0xc7, 0x63, 0x93, 0x90, 0x3e, 0x94, 0x11, 0x8a, 0x3f,
+    0xa0, 0x84, 0x84, 0x60, 0x84, 0x6a, 0x0a, 0x6a, 0x6e, 0x2e, 0x53, 0x49, 0xc8, 0xbf, 0xbd, 0xf9,
+    0xf1, 0x55, 0x9e, 0x2f, 0xde, 0xf3, 0xff, 0x58, 0x62, 0x60, 0x01, 0x70, 0xc1, 0xbb, 0x36, 0x66,
+    0x96, 0xaa, 0xcb, 0x38, 0xa4, 0xe0, 0x87, 0xae, 0x49, 0xc8, 0xbb, 0xb0, 0x9a, 0x35, 0xac, 0x0a,
+    0x33, 0xaf, 0x6c, 0xfc, 0x8a, 0xe2, 0x95, 0xf5, 0xda, 0xbf, 0xb5, 0x94, 0x40, 0x5a, 0x67, 0xaf,
+    0x9e, 0x89, 0x28, 0x85, 0x6c, 0x73, 0xb8, 0x41, 0x13, 0x71, 0xb3, 0x83, 0x34, 0x2c, 0x53, 0xf7,
+    0x25, 0xb0, 0x95, 0xe4, 0x22, 0x99, 0xab, 0x01, 0xe0, 0xcd, 0xe3, 0x84, 0x04, 0x8a, 0xa4, 0x47,
+    0xc2, 0x68, 0x89, 0x21, 0x4a, 0x9f, 0x95, 0x86, 0x39, 0xd2, 0x9b, 0xe3, 0xac, 0x6a, 0x8e, 0x54,
+    0x70, 0x28, 0x3d, 0x2e, 0x4c, 0x89, 0xe2, 0xa7, 0x39, 0x21, 0x3e, 0x66, 0xa4, 0x57, 0xcc, 0x97,
+    0x0f, 0xea, 0x69, 0x91, 0xca, 0x19, 0xef, 0x4b, 0x6c, 0x3a, 0x87, 0x62, 0xfa, 0x2a, 0xea, 0xe8,
+    0x39, 0x25, 0x81, 0x76, 0xb2, 0x78, 0xa1, 0x10, 0xa9, 0xa3, 0x64, 0xae, 0xc2, 0x23, 0xdc, 0x90,
+    0xe8, 0xac, 0xcc, 0x70, 0xb1, 0x9a, 0x3c, 0x9a, 0x10, 0x8b, 0x80, 0x71, 0x9b, 0x9d, 0xf0, 0xab,
+    0x38, 0xe4, 0xf8, 0x79, 0xc7, 0x94, 0x8f, 0x93, 0x24, 0xd7, 0x27, 0xb1, 0x1f, 0x61, 0x3a, 0xa1,
+    0x43, 0xbe, 0x9a, 0xf1, 0xfc, 0x76, 0xf7, 0xf9, 0xb3, 0x97, 0x83, 0x0e, 0x3a, 0x30, 0xde, 0x3c,
+    0x86, 0xd6, 0x29, 0x67, 0x4b, 0x76, 0x0f, 0x92, 0xd0, 0x33, 0xf0, 0xba, 0x66, 0x0b, 0xe5, 0x0e,
+    0xa5, 0x5c, 0xe6, 0x35, 0x13, 0x22, 0x09, 0xc4, 0xcb, 0xf7, 0xaa, 0xb4, 0x2e, 0x0e, 0x97, 0x76,
+    0x3b, 0xce, 0x49, 0xe8, 0xc7, 0xf4, 0x8d, 0xe9, 0xac, 0x60, 0xcf, 0xab, 0x38, 0x31, 0xfa, 0x37,
+    0x5f, 0x4b, 0xa4, 0xa6, 0xeb, 0xa2, 0xb4, 0xaf, 0x94, 0x90, 0xad, 0xf1, 0x55, 0x18, 0x61, 0xd1,
+    0x92, 0x3e, 0x76, 0x23, 0x3f, 0x6c, 0x2e, 0x9d, 0xac, 0xaf, 0xcf, 0x88, 0xb2, 0x67, 0x60, 0xb5,
+    0x95, 0x15, 0xb7, 0xa7, 0x87, 0x72, 0xdf, 0x3d, 0x32, 0x4d, 0xe9, 0x03, 0xfd, 0x14, 0xf9, 0x45,
+    0x0e, 0x6b, 0xd3, 0x06, 0x05, 0xa4, 0x6e, 0xda, 0x44, 0x34, 0x1e, 0xbf, 0xa9, 0x55, 0xe5, 0x5d,
+    0xf6, 0x27, 0xe6, 0xf5, 0x24, 0xfe, 0x92, 0x03, 0x1b, 0x0f, 0x7b, 0xe2, 0xf4, 0x79, 0xbb, 0x22,
+    0xcc, 0xff, 0xc0, 0x49, 0x0d, 0xaf, 0x6b, 0x5d, 0x07, 0x62, 0xed, 0x30, 0xa1, 0x2f, 0xd6, 0x10,
+    0x46, 0x71, 0x07, 0x8d, 0xc3, 0xf2, 0x6d, 0x1a, 0xcf, 0xa5, 0x33, 0x6f, 0x8c, 0x51, 0xb7, 0x23,
+    0x8a, 0xc3, 0xd9, 0xe5, 0x63, 0xef, 0x7a, 0xef, 0x61, 0x15, 0x91, 0xd2, 0xe2, 0xae, 0x71, 0x2b,
+    0x0d, 0xc8, 0xd6, 0xae, 0xc6, 0x7d, 0x21, 0xbb, 0x67, 0xcb, 0x9d, 0x54, 0x70, 0x66, 0x0a, 0x64,
+    0x47, 0xc1, 0x30, 0xc9, 0xdc, 0x3f, 0x21, 0x19, 0xae, 0x91, 0xe5, 0xbd, 0x32, 0xeb, 0x9b, 0x50,
+    0xbe, 0x82, 0xf6, 0xc7, 0xe6, 0xbf, 0x35, 0x70, 0x56, 0x25, 0xc1, 0x5d, 0x89, 0x72, 0x55, 0xa7,
+    0x50, 0xae, 0xbe, 0x55, 0x89, 0x9b, 0xe4, 0x5c, 0x89, 0x4b, 0xbb, 0xd6, 0x2a, 0x4b, 0x43, 0x80,
+    0xe2, 0x85, 0x1f, 0x48, 0xbc, 0x58, 0x0f, 0x40, 0x65, 0x0a, 0x13, 0x14, 0x89, 0x43, 0xdc, 0x3e,
+    0x7a, 0xf0, 0x04, 0x38, 0x02, 0x7b, 0x0b, 0x56, 0x76, 0x63, 0x78, 0x29, 0x34, 0xf3, 0xc3, 0xc3,
+    0x37, 0xe8, 0x3e, 0x44, 0x3f, 0xcc, 0x6a, 0x1b, 0xc1, 0x25, 0x78, 0xb3, 0x68, 0x5e, 0x95, 0xe8,
+    0x0a, 0xde, 0x7c, 0xc6, 0x75, 0x09, 0xfb, 0x5e, 0xe7, 0xa6, 0xd6, 0x65, 0x77, 0x94, 0x76, 0x75,
+    0xfa, 0x33, 0xa6, 0xbd, 0x6a, 0xd5, 0x8a, 0x80, 0x91, 0xfa, 0xb6, 0xd0, 0xfa, 0xab, 0x6f, 0x45,
+    0x5d, 0xe3, 0x02, 0x9c, 0x0b, 0xc0, 0xbc, 0x30, 0xf3, 0x8d, 0xc8, 0xea, 0x33, 0xc5, 0x13, 0x49,
+    0xea, 0x9e, 0x84, 0x6d, 0x19, 0xc2, 0x60, 0xfe, 0x56, 0xcc, 0x27, 0xd6, 0x49, 0x7b, 0x28, 0x5e,
+    0x4f, 0x0e, 0xd6, 0x2a, 0xdf, 0xc4, 0x83, 0xc2, 0x22, 0x1d, 0xf4, 0xca, 0xa6, 0x6e, 0x30, 0x49,
+    0x4e, 0x6c, 0xf2, 0xbb, 0x23, 0x2b, 0x5a, 0x53, 0x2f, 0xc8, 0xda, 0x2d, 0xb1, 0x5e, 0xa7, 0x3b,
+    0x38, 0x9a, 0xea, 0xf2, 0x95, 0x39, 0xe3, 0x9d, 0x6b, 0x7c, 0xf1, 0x18, 0x7f, 0x71, 0x69, 0x4e,
+    0x93, 0x5f, 0xb9, 0xf2, 0xc0, 0x2a, 0xa5, 0xca, 0xe6, 0xa5, 0x1e, 0x71, 0xc9, 0xa6, 0xfc, 0xba,
+    0xc2, 0x9c, 0x5a, 0x6c, 0xb7, 0x63, 0xe8, 0xca, 0xf4, 0xd5, 0xf9, 0x9b, 0x1f, 0x11, 0xd0, 0xd3,
+    0x64, 0x51, 0x1c, 0x4b, 0x3e, 0xda, 0xd6, 0xdf, 0x64, 0x09, 0x94, 0xac, 0xe8, 0xeb, 0x1f, 0xa2,
+    0xd2, 0x71, 0xed, 0xd0, 0x63, 0x23, 0x81, 0x84, 0xcd, 0x2d, 0xe4, 0x0a, 0xe6, 0xa5, 0x90, 0x68,
+    0x72, 0x92, 0xb8, 0x33, 0x21, 0x84, 0x45, 0x32, 0x9d, 0xe2, 0xeb, 0xf7, 0x3c, 0x13, 0x07, 0x8e,
+    0x36, 0xb3, 0xa8, 0x34, 0x25, 0x33, 0x41, 0xdf, 0xfd, 0x2e, 0x9b, 0x65, 0x66, 0x47, 0x58, 0x17,
+    0xcd, 0x2a, 0xc9, 0xf7, 0xa2, 0xad, 0xee, 0x3f, 0xe5, 0x59, 0xf9, 0x15, 0x4a, 0xe5, 0xfe, 0x5d,
+    0xa9, 0x51, 0x24, 0x28, 0x35, 0xb2, 0xca, 0x2b, 0xec, 0x92, 0xd0, 0xfe, 0x1f, 0x1f, 0x7a, 0x5e,
+    0xc5, 0x6b, 0xa5, 0x82, 0xbb, 0x4d, 0x14, 0xd0, 0x5a, 0x95, 0xf5, 0x1e, 0xac, 0x8c, 0x86, 0x73,
+    0xe4, 0x88, 0x58, 0xac, 0x2d, 0x8a, 0xe0, 0xb9, 0xf8, 0xe6, 0xcc, 0xce, 0x0e, 0x3b, 0x01, 0x11,
+    0x52, 0x20, 0x1b, 0x7d, 0x48, 0xf0, 0xd9, 0x53, 0x20, 0x35, 0x35, 0x43, 0xa6, 0x8f, 0x76, 0x23,
+    0x84, 0x3e, 0xc8, 0x28, 0x6b, 0x85, 0xdb, 0xa0, 0xb2, 0xde, 0x90, 0x04, 0x28, 0x34, 0x55, 0x1c,
+    0xa0, 0x41, 0x2a, 0x5f, 0xdc, 0xc4, 0x39, 0xe3, 0x41, 0x8a, 0xdf, 0xc2, 0x01, 0xae, 0x41, 0x46,
+    0x9a, 0x82, 0xcc, 0x48, 0x9a, 0x83, 0xf1, 0x00, 0xb2, 0xf9, 0x4a, 0x2c, 0xa5, 0x02, 0xb5, 0x5d,
+    0x28, 0x63, 0xe9, 0xf6, 0x3b, 0xb5, 0x23, 0xa1, 0x96, 0x18, 0xc6, 0x87, 0x1b, 0xa4, 0x25, 0x32,
+    0x54, 0x43, 0xa4, 0xfe, 0x96, 0xda, 0x01, 0x0e, 0xee, 0x42, 0xdd, 0xe6, 0x16, 0x4f, 0xfa, 0xc0,
+    0x99, 0x32, 0x55, 0x22, 0x09, 0x9b, 0x7c, 0x59, 0xfa, 0x8e, 0x83, 0x59, 0xeb, 0x8e, 0xd5, 0x8b,
+    0x02, 0x9c, 0xa3, 0xef, 0x18, 0xcc, 0xd0, 0x4d, 0x56, 0x14, 0xf2, 0x39, 0x1d, 0x21, 0x01, 0x48,
+    0x77, 0x8d, 0x9f, 0x5d, 0x13, 0x2a, 0x42, 0x4e, 0xcf, 0x2f, 0xe3, 0x69, 0x54, 0x17, 0xe8, 0xd4,
+    0xe7, 0x57, 0xaa, 0x54, 0xea, 0xe7, 0x97, 0xf4, 0x3d, 0x65, 0x39, 0x63, 0x3b, 0xa2, 0xba, 0xd3,
+    0x3a, 0xf6, 0x73, 0xb5, 0xc9, 0x50, 0xb7, 0x2d, 0xbf, 0xae, 0xd1, 0xd0, 0xf7, 0x81, 0x2b, 0xc7,
+    0xc2, 0x5b, 0xbd, 0x1e, 0x94, 0x89, 0xf2, 0xfe, 0x60, 0xb3, 0x76, 0x9f, 0x4b, 0xc2, 0xea, 0x6c,
+    0x13, 0xc2, 0x91, 0xa6, 0xe1, 0xbe, 0xe6, 0x1b, 0xbf, 0xab, 0x67, 0xb6, 0xff, 0xa7, 0x1a, 0xf1,
+    0x44, 0xb9, 0x4e, 0x42, 0xef, 0x0c, 0x23, 0xfe, 0x58, 0x73, 0x2a, 0xb7, 0x5c, 0x79, 0xb6, 0x81,
+    0x53, 0x88, 0xb5, 0xca, 0x53, 0x41, 0x70, 0xc5, 0x37, 0x98, 0x45, 0xa0, 0x96, 0xd1, 0x14, 0x8d,
+    0x88, 0x3d, 0x92, 0xae, 0x54, 0x1a, 0xa9, 0x82, 0x14, 0x9f, 0x10, 0x35, 0x32, 0xcf, 0xcb, 0xc2,
+    0x2c, 0x7a, 0x41, 0x48, 0xef, 0xcc, 0x0b, 0x41, 0xbc, 0xb3, 0x2f, 0x1a, 0x03, 0x90, 0xe2, 0xab,
+    0x9d, 0x5f, 0x5d, 0xe2, 0xea, 0x26, 0xe6, 0xda, 0xdd, 0x25, 0x82, 0xe2, 0xe6, 0xaf, 0x7c, 0x54,
+    0x8f, 0x21, 0xc4, 0x37, 0x3a, 0x89, 0xfe, 0x9a, 0x05, 0x88, 0xa8, 0x67, 0x74, 0xb7, 0xb8, 0x19,
+    0xeb, 0xe9, 0x3c, 0xcf, 0xed, 0x57, 0x8b, 0x49, 0xef, 0x25, 0x57, 0x8c, 0x17, 0xe0, 0x72, 0x52,
+    0x6d, 0x18, 0x97, 0xb6, 0xc6, 0x24, 0xa2, 0x8a, 0xd4, 0x15, 0xab, 0x7a, 0xda, 0x78, 0xe7, 0x0c,
+    0xb8, 0x73, 0x78, 0xa3, 0xdd, 0x70, 0x43, 0x1a, 0x15, 0xf5, 0x58, 0xf1, 0x81, 0xd6, 0x72, 0x13,
+    0x9f, 0x37, 0x5e, 0x7a, 0x5f, 0xe1, 0x8e, 0xdf, 0x7f, 0x6b, 0x83, 0xd6, 0xab, 0x4d, 0xea, 0x04,
+    0x6f, 0x36, 0x0c, 0xa5, 0x26, 0x4d, 0x2d, 0x7a, 0x9f, 0xc7, 0x84, 0x92, 0xb9, 0x57, 0x32, 0x0c,
+    0x72, 0x65, 0x79, 0x24, 0x73, 0xec, 0xab, 0xd2, 0x5f, 0x92, 0x71, 0xe1, 0x51, 0xc0, 0x0f, 0x73,
+    0xa7, 0x97, 0x26, 0x29, 0x1e, 0xa9, 0xcd, 0x5e, 0xb7, 0x97, 0x8b, 0x81, 0x45, 0x8a, 0x6c, 0xc4,
+    0xd5, 0xbe, 0x71, 0xb2, 0x64, 0x58, 0x89, 0x2a, 0x56, 0xc2, 0xb0, 0x36, 0x8c, 0x91, 0x9c, 0x62,
+    0xb3, 0x98, 0xb6, 0x17, 0x59, 0x31, 0x88, 0x4c, 0x65, 0xba, 0xcf, 0xbc, 0x92, 0x97, 0x14, 0xc2,
+    0xcd, 0x3e, 0x61, 0x51, 0x58, 0xd9, 0x68, 0x75, 0x46, 0x0a, 0xa4, 0x67, 0x12, 0xcf, 0x83, 0xe9,
+    0xf4, 0x56, 0x27, 0x4c, 0x58, 0x69, 0x15, 0x57, 0x6b, 0x3a, 0x2b, 0x04, 0xa5, 0x27, 0x96, 0xc2,
+    0x10, 0x40, 0x7f, 0x7e, 0x08, 0x62, 0xba, 0x8d, 0x21, 0x3e, 0x99, 0x68, 0x7f, 0xe8, 0x47, 0x77,
+    0xba, 0xf6, 0x4d, 0xab, 0x1d, 0x53, 0x8f, 0x56, 0xb8, 0x4e, 0xf7, 0x37, 0x85, 0xd3, 0xed, 0xfa,
+    0xae, 0x76, 0x8f, 0xc9, 0x0d, 0x2e, 0x40, 0xf1, 0x0b, 0x45, 0x5e, 0x45, 0x4f, 0x49, 0xbc, 0x18,
+    0xbe, 0x84, 0x61, 0xa2, 0x28, 0xc3, 0x96, 0x34, 0x1e, 0x9c, 0x49, 0xd3, 0xa9, 0x16, 0x1b, 0x9f,
+    0xc7, 0x21, 0xbc, 0xf2, 0x50, 0x4b, 0x5d, 0x1e, 0x6a, 0x11, 0x54, 0xd3, 0xe7, 0xe5, 0xe2, 0x90,
+    0xbe, 0x2d, 0xd7, 0x29, 0x6e, 0x12, 0x4f, 0xdd, 0xef, 0x15, 0xa9, 0x8e, 0x29, 0x3e, 0xce, 0x63,
+    0x7c, 0xb5, 0x05, 0x3c, 0xe1, 0x27, 0x4f, 0x04, 0x94, 0x3f, 0xb1, 0x01, 0x71, 0xdd, 0xb1, 0x8f,
+    0xa9, 0x97, 0xc6, 0x24, 0x30, 0xf1, 0x7d, 0x1c, 0x1d, 0xa1, 0x62, 0x00, 0xa1, 0x9e, 0x55, 0x8c,
+    0xb1, 0x36, 0x60, 0xdf, 0xbb, 0xa2, 0x67, 0x07, 0xc2, 0x93, 0xaf, 0x18, 0x99, 0x0d, 0x56, 0xfa,
+    0x40, 0x06, 0x96, 0x9a, 0x31, 0x42, 0xc9, 0xcf, 0x5d, 0xb1, 0x39, 0xd2, 0x10, 0x86, 0xac, 0x50,
+    0x90, 0x8f, 0x71, 0x84, 0x87, 0xc4, 0x34, 0x70, 0xfb, 0xfb, 0x4a, 0x28, 0x23, 0x8c, 0x11, 0x89,
+    0x6f, 0x9e, 0x94, 0x5b, 0xa2, 0xd9, 0x16, 0x87, 0x87, 0x24, 0x6a, 0x8f, 0x93, 0xe3, 0xa1, 0x51,
+    0x4f, 0xbb, 0xd7, 0x04, 0x8a, 0xbe, 0x62, 0x64, 0x81, 0x16, 0xbd, 0xff, 0x49, 0x1e, 0x0b, 0x17,
+    0x95, 0x40, 0xfe, 0xd5, 0x06, 0x09, 0xf5, 0xcb, 0x79, 0xa9, 0x56, 0x4c, 0x88, 0x4d, 0x80, 0x50,
+    0x44, 0x96, 0x93, 0x24, 0xfc, 0x8f, 0xf5, 0x08, 0x1e, 0xe4, 0x88, 0xfd, 0x4f, 0x9c, 0xd4, 0x57,
+    0xb9, 0x68, 0xc6, 0x3b, 0xd7, 0x8b, 0x0e, 0xec, 0x7c, 0x54, 0x16, 0x01, 0xe2, 0xa5, 0x88, 0x70,
+    0xc3, 0x62, 0x32, 0x12, 0xc9, 0x6d, 0xb3, 0x47, 0xa7, 0x9f, 0xfa, 0x3a, 0xf3, 0xb1, 0x9c, 0x19,
+    0xfe, 0xb9, 0x53, 0xb2, 0x2b, 0x1b, 0x71, 0x4d, 0xa9, 0xcd, 0xce, 0x2f, 0xb9, 0xda, 0x23, 0xc2,
+    0x2b, 0x18, 0x19, 0x7d, 0x6a, 0x54, 0xef, 0x0c, 0x62, 0x4e, 0xf1, 0x1c, 0x7f, 0xde, 0xa0, 0xad,
+    0x26, 0xa2, 0xda, 0xce, 0x0c, 0xee, 0x49, 0xff, 0xe3, 0xf9, 0xee, 0xa4, 0xbb, 0x43, 0xe6, 0xcf,
+    0x54, 0x65, 0x51, 0xec, 0x5c, 0x7a, 0x72, 0x19, 0xf0, 0x7b, 0x02, 0x85, 0xd3, 0xa0, 0x06, 0xfd,
+    0x43, 0x9d, 0x01, 0x79, 0x3b, 0xea, 0x5e, 0xbe, 0x40, 0xb9, 0xcd, 0xfd, 0x5d, 0x81, 0x95, 0x6b,
+    0xa0, 0x95, 0xe3, 0x03, 0x4f, 0xdd, 0x4a, 0x03, 0x56, 0x5e, 0x62, 0x16, 0xc1, 0x7d, 0xa4, 0xfb,
+    0x3e, 0x37, 0xb4, 0x8a, 0x96, 0x74, 0x83, 0x96, 0xa6, 0x85, 0x52, 0x6f, 0x94, 0x2e, 0x6a, 0xfd,
+    0x01, 0x7b, 0x12, 0xc2, 0x64, 0x94, 0x6a, 0x38, 0x82, 0x39, 0xd1, 0xef, 0xab, 0xed, 0x87, 0x55,
+    0x87, 0x78, 0x73, 0x4c, 0x47, 0x69, 0x4c, 0x17, 0x58, 0xef, 0x71, 0xe3, 0xac, 0x22, 0xcd, 0x5c,
+    0x79, 0x9c, 0x16, 0xd0, 0xf1, 0x33, 0x5c, 0x28, 0x74, 0x63, 0xe0, 0x52, 0x07, 0xd0, 0x17, 0xa9,
+    0xbf, 0xc6, 0x30, 0xec, 0x6e, 0x3e, 0x0c, 0x0d, 0x45, 0xc0, 0x1a, 0xb5, 0x87, 0x8e, 0xac, 0xa8,
+    0x24, 0xed, 0x0d, 0x86, 0x96, 0xa7, 0xd1, 0xfd, 0xc7, 0xd6, 0x2a, 0x6d, 0x92, 0x23, 0x6c, 0x73,
+    0x75, 0xc2, 0xd1, 0x86, 0x5d, 0xe1, 0x4f, 0x0e, 0x67, 0xb2, 0x50, 0x91, 0x1d, 0xee, 0x81, 0x0b,
+    0xf5, 0xea, 0x15, 0xad, 0x4e, 0x11, 0x57, 0xb5, 0x82, 0x15, 0x9f, 0xa8, 0xdb, 0x74, 0xfd, 0xfa,
+    0xd8, 0x2c, 0x70, 0x7e, 0x3c, 0x2b, 0xf3, 0xc0, 0xa1, 0x7b, 0x1e, 0xf1, 0xf1, 0xf2, 0xc2, 0xf7,
+    0x95, 0x78, 0x7a, 0x51, 0x7c, 0x73, 0xd0, 0xfc, 0xbc, 0x3c, 0xbd, 0xc2, 0x19, 0x54, 0x1c, 0xb8,
+    0x84, 0x77, 0x1f, 0x3f, 0x19, 0x6f, 0x90, 0xb2, 0xb4, 0xdc, 0x80, 0x36, 0xe2, 0xf0, 0x1d, 0xbc,
+    0x82, 0xc6, 0xbc, 0x3d, 0x4f, 0xae, 0x8b, 0x34, 0x5f, 0xa7, 0x3f, 0xbe, 0x3b, 0xff, 0xfc, 0xc3,
+    0x4f, 0x2f, 0x5f, 0xbe, 0x78, 0xff, 0xf9, 0xec, 0xf5, 0xbf, 0xbf, 0xc0, 0xcb, 0x22, 0x78, 0x21,
+    0x9c, 0xae, 0x78, 0xaa, 0xcc, 0x15, 0x14, 0x2a, 0xa7, 0x5c, 0xb7, 0x74, 0x6f, 0xf5, 0x0b, 0xe7,
+    0x0b, 0xb3, 0xf9, 0x87, 0xd7, 0x6f, 0x4f, 0xde, 0x7d, 0xf8, 0x7c, 0xf6, 0xe2, 0xf9, 0xbb, 0xb7,
+    0x27, 0x67, 0x02, 0x02, 0x45, 0xe1, 0xcf, 0x44, 0xb2, 0x33, 0x96, 0x4c, 0x04, 0x08, 0x31, 0xbc,
+    0x70, 0xb3, 0xdd, 0x6c, 0xfe, 0xd3, 0xe9, 0xc9, 0xb3, 0xf3, 0x17, 0x9f, 0xdf, 0xc3, 0x3f, 0xaa,
+    0x2d, 0x61, 0x9f, 0x65, 0x3a, 0xad, 0xc1, 0x62, 0x9a, 0xe4, 0x72, 0xdf, 0x3e, 0x33, 0x9b, 0x3e,
+    0x7f, 0xf7, 0xe3, 0xbb, 0xf7, 0x88, 0x51, 0x7f, 0x5a, 0x57, 0x25, 0xf6, 0x80, 0x71, 0xf3, 0x6d,
+    0x7f, 0x77, 0xb4, 0x1f, 0x8d, 0xc1, 0xff, 0x90, 0xef, 0x54, 0x7a, 0x07, 0x7c, 0xd7, 0xe3, 0x61,
+    0xb8, 0xd7, 0x85, 0x77, 0x76, 0xc6, 0x4d, 0x7c, 0xc5, 0xf7, 0x76, 0xc3, 0x7e, 0x58, 0xc3, 0xf4,
+    0x02, 0xe0, 0x6a, 0xa8, 0xfb, 0xa3, 0x45, 0x0b, 0x1a, 0x7c, 0xb8, 0x64, 0xb8, 0x48, 0x31, 0x33,
+    0x5b, 0xed, 0xdb, 0x49, 0x7f, 0x14, 0x76, 0x7b, 0xea, 0xcd, 0x09, 0x4f, 0xe3, 0x2b, 0xca, 0xfc,
+    0x8b, 0xef, 0x46, 0xe3, 0xc1, 0x68, 0x3c, 0x44, 0x1a, 0xc4, 0xc5, 0xf1, 0xd3, 0x0f, 0x6f, 0xde,
+    0x2d, 0x73, 0xe3, 0xcd, 0x96, 0xb9, 0x5c, 0x15, 0xb9, 0xf7, 0x4e, 0xb0, 0xdb, 0xf4, 0xe4, 0x65,
+    0x68, 0x8a, 0x38, 0x73, 0x9e, 0x2c, 0x64, 0x05, 0xd3, 0xa0, 0x61, 0x27, 0x17, 0xc5, 0xa5, 0x6f,
+    0xdd, 0x16, 0x20, 0x6d, 0xc5, 0x93, 0xb3, 0xcb, 0x2a, 0x3d, 0xa9, 0x9e, 0xca, 0xb0, 0x55, 0x91,
+    0x7d, 0xb0, 0xb4, 0xff, 0x9b, 0x2c, 0x18, 0xa1, 0xad, 0xad, 0x85, 0xb1, 0xee, 0xf4, 0xaa, 0x3e,
+    0xb6, 0x8a, 0x16, 0xe9, 0xc4, 0x1a, 0x20, 0x44, 0xa1, 0xa9, 0xfd, 0xe6, 0xfa, 0x56, 0x68, 0xcc,
+    0x29, 0x28, 0x4f, 0xd6, 0x2c, 0xe9, 0x9a, 0xfb, 0x7d, 0x19, 0x82, 0xab, 0x02, 0x06, 0x35, 0xf7,
+    0xbb, 0xc9, 0x5a, 0xe8, 0x25, 0x11, 0x2a, 0x93, 0xfa, 0x50, 0x31, 0xe1, 0x06, 0xeb, 0xa3, 0xe5,
+    0x94, 0x80, 0xb3, 0x1e, 0xad, 0x07, 0x50, 0xf8, 0x6c, 0x65, 0x20, 0x27, 0xc6, 0x74, 0x2c, 0xcf,
+    0x8d, 0x17, 0x82, 0x2d, 0x7f, 0x8a, 0xd8, 0x78, 0xe7, 0xf4, 0x80, 0xfa, 0xec, 0x70, 0x31, 0xc9,
+    0x94, 0xbb, 0xcc, 0x2b, 0x79, 0xc1, 0x84, 0x2d, 0x79, 0x42, 0x4a, 0x3d, 0x58, 0x88, 0xbe, 0x64,
+    0x02, 0x57, 0xea, 0xaf, 0xa1, 0x04, 0xc5, 0xcf, 0x13, 0xd9, 0x22, 0x77, 0x33, 0x38, 0x94, 0x5f,
+    0xaf, 0x3a, 0x11, 0x24, 0xa4, 0x2a, 0x2c, 0x63, 0xf9, 0x88, 0x8b, 0x4d, 0xab, 0xdc, 0x1e, 0x3b,
+    0xf4, 0x7c, 0x2d, 0xd9, 0x95, 0x0f, 0x46, 0x96, 0xcc, 0xef, 0xaf, 0x3d, 0xfe, 0xeb, 0xc7, 0x72,
+    0x2e, 0xce, 0x7e, 0x4a, 0x29, 0x33, 0xe6, 0xbd, 0x3e, 0x74, 0x1c, 0x49, 0xe5, 0x74, 0x3f, 0xd0,
+    0xa9, 0xdc, 0x14, 0xb0, 0xea, 0xd6, 0x87, 0x8c, 0x09, 0x4b, 0xe3, 0x51, 0xba, 0xf8, 0xdc, 0xf1,
+    0x65, 0xcb, 0x93, 0xa2, 0xf5, 0xe1, 0x66, 0x8d, 0xd1, 0xaa, 0x56, 0x7c, 0x1d, 0x39, 0x99, 0xdb,
+    0x12, 0x7e, 0x07, 0xc5, 0x9e, 0xda, 0xe6, 0x77, 0x8f, 0xed, 0x06, 0xfa, 0xfb, 0xc7, 0xa5, 0x36,
+    0xea, 0x0b, 0xc8, 0x6e, 0x8b, 0xe7, 0x58, 0xee, 0xa9, 0xaf, 0x0e, 0xbb, 0xba, 0xf5, 0x69, 0x9a,
+    0x79, 0xc8, 0xa7, 0xa4, 0xbd, 0xdf, 0x90, 0xfe, 0x0a, 0xa2, 0x07, 0xed, 0x14, 0xb8, 0x1e, 0x6e,
+    0x96, 0x5e, 0xc8, 0x2d, 0xc5, 0x3b, 0xff, 0x12, 0xcd, 0xa3, 0xf5, 0xda, 0xe8, 0xe8, 0xe2, 0xd2,
+    0x47, 0x0c, 0x9d, 0x55, 0x8c, 0xaa, 0xa7, 0x5c, 0x39, 0x47, 0xe0, 0x74, 0xfe, 0xf4, 0x4c, 0xc7,
+    0x0f, 0x8a, 0x17, 0xef, 0x4e, 0x5f, 0xbc, 0xd5, 0x06, 0xa5, 0x28, 0xce, 0x44, 0x44, 0x04, 0x4c,
+    0x91, 0xb0, 0x43, 0xce, 0x6b, 0xfd, 0x89, 0xf9, 0x0a, 0x2f, 0xed, 0xce, 0x0e, 0x05, 0x96, 0xb5,
+    0xae, 0xfc, 0xb1, 0x69, 0xf1, 0x05, 0x37, 0x0d, 0xa9, 0x30, 0xc1, 0x5f, 0xa5, 0x1b, 0x1f, 0xd3,
+    0x7d, 0xef, 0x97, 0x74, 0x6c, 0xa4, 0xe6, 0x13, 0x2c, 0x9d, 0x93, 0xf8, 0x3a, 0xa2, 0xc6, 0x4f,
+    0x3e, 0x37, 0xd6, 0x88, 0xae, 0xf4, 0x49, 0x6d, 0xd3, 0x3c, 0xca, 0x0b, 0xf2, 0x55, 0x1f, 0xd2,
+    0xd6, 0x1f, 0x48, 0xca, 0x61, 0x6e, 0x00, 0x74, 0x33, 0xe7, 0x9b, 0x5e, 0xc0, 0xca, 0xd6, 0xfa,
+    0x8f, 0xd1, 0xea, 0x5a, 0x4e, 0xfe, 0x77, 0x7f, 0xa5, 0xc2, 0x73, 0xac, 0xa8, 0x60, 0xf9, 0x90,
+    0xab, 0xea, 0x14, 0xde, 0x64, 0x15, 0xd5, 0xa6, 0x5f, 0x59, 0xfe, 0x60, 0x11, 0x2c, 0x44, 0x4e,
+    0xd4, 0x3c, 0x74, 0x8a, 0xf3, 0x94, 0x3e, 0x59, 0xeb, 0x7e, 0xf9, 0x43, 0x7c, 0x1b, 0xfb, 0xf5,
+    0x5c, 0xe4, 0x67, 0xa3, 0xce, 0x72, 0x3e, 0x55, 0x5c, 0x9f, 0xc5, 0x59, 0x86, 0xa3, 0x2e, 0xe5,
+    0xff, 0xb1, 0x8c, 0x61, 0x75, 0xce, 0xe8, 0xab, 0x45, 0x59, 0xc3, 0xfe, 0x32, 0xb3, 0x01, 0xed,
+    0xc5, 0xcd, 0x42, 0x2c, 0xef, 0x45, 0xc5, 0x03, 0xa6, 0xfb, 0xa0, 0xc9, 0x1c, 0x71, 0xbb, 0xb9,
+    0xef, 0x9b, 0xac, 0x10, 0xa2, 0x34, 0x6c, 0x4a, 0x5e, 0xf2, 0x67, 0x21, 0x1a, 0xa9, 0x3f, 0xf7,
+    0xfd, 0x62, 0x7a, 0xa1, 0xcd, 0x6b, 0x3e, 0x9a, 0xbe, 0x52, 0x37, 0xc9, 0xd2, 0xaf, 0x1d, 0xd7,
+    0x66, 0xb0, 0x43, 0x7f, 0x42, 0x1e, 0x3a, 0x2f, 0xe2, 0xea, 0x19, 0xc6, 0x4f, 0x46, 0x47, 0x6f,
+    0x7e, 0x07, 0x1f, 0xce, 0x58, 0x3e, 0x94, 0x57, 0xb0, 0x9e, 0x5a, 0x16, 0x13, 0x15, 0x17, 0x53,
+    0x8c, 0x11, 0x2e, 0xbe, 0x2e, 0x5e, 0xe9, 0xec, 0xdd, 0x99, 0x91, 0xd0, 0x55, 0xa2, 0x14, 0x9b,
+    0x68, 0x25, 0x51, 0xca, 0xee, 0x2b, 0x84, 0x49, 0x05, 0x5a, 0x8a, 0x8f, 0x13, 0x59, 0x31, 0x49,
+    0x15, 0x17, 0x36, 0xbc, 0x63, 0x86, 0x9e, 0x3c, 0x3e, 0x68, 0x7b, 0xb1, 0xcc, 0x2e, 0x8d, 0x1a,
+    0x86, 0xd8, 0x4b, 0xce, 0x1f, 0x3b, 0x2e, 0x2d, 0xb8, 0x7d, 0x10, 0xb3, 0xcb, 0x78, 0x22, 0x25,
+    0xb7, 0xc6, 0x5d, 0x05, 0x7e, 0xe5, 0xf1, 0x75, 0x11, 0xde, 0x37, 0xbb, 0xb3, 0x8c, 0xfd, 0x48,
+    0xec, 0xe1, 0xc9, 0xed, 0xc3, 0x8f, 0x3a, 0x59, 0xc1, 0x0c, 0xbc, 0xbd, 0xf7, 0x1c, 0xef, 0x8b,
+    0x9d, 0x6b, 0x1b, 0x59, 0xf2, 0x5f, 0x3f, 0x56, 0x00, 0x6d, 0xb1, 0xee, 0xa7, 0xc2, 0xb6, 0x16,
+    0xe7, 0x33, 0xd0, 0xa1, 0x14, 0xab, 0x9b, 0x23, 0x2f, 0x82, 0x16, 0xab, 0xfb, 0xa2, 0x07, 0xdf,
+    0x39, 0x07, 0x0f, 0x5d, 0xac, 0x22, 0xd1, 0x5b, 0x5d, 0x7c, 0x79, 0x07, 0xf4, 0x97, 0x1e, 0x0c,
+    0xdb, 0x7e, 0x7c, 0x64, 0xe2, 0xf6, 0x39, 0xf7, 0xc5, 0x6a, 0x42, 0xfe, 0x96, 0x16, 0x07, 0xcb,
+    0x8b, 0x15, 0x02, 0xe9, 0x85, 0x2a, 0x2a, 0xc3, 0xb0, 0xda, 0x14, 0x69, 0xc6, 0x03, 0x30, 0x9f,
+    0x9b, 0x7d, 0xeb, 0x13, 0x43, 0x1a, 0xc5, 0x7e, 0x4d, 0x98, 0x63, 0x7e, 0x29, 0xd1, 0x1c, 0xdb,
+    0x90, 0x82, 0xde, 0xe4, 0xf5, 0x5a, 0xcf, 0xd8, 0x1c, 0x93, 0x13, 0x9d, 0xdb, 0xe7, 0xc6, 0x14,
+    0x67, 0xf7, 0xb3, 0x5c, 0xb2, 0x3d, 0x27, 0xa8, 0x75, 0x40, 0xd1, 0x94, 0x18, 0xec, 0xcb, 0xd9,
+    0x95, 0x75, 0xa2, 0x34, 0xb8, 0xfe, 0x6b, 0x1a, 0x47, 0x4e, 0xb1, 0x3c, 0xbb, 0x03, 0x12, 0x7f,
+    0x1f, 0xcc, 0xc9, 0x5d, 0xae, 0xee, 0xc7, 0x35, 0x1a, 0x06, 0x34, 0x9b, 0xd9, 0x63, 0x2a, 0x74,
+    0x09, 0x0b, 0x56, 0x6b, 0x92, 0x26, 0xe6, 0xd0, 0xc9, 0x55, 0x9c, 0xe9, 0x4f, 0x14, 0x4f, 0x83,
+    0xfc, 0x4d, 0xb0, 0xa8, 0x47, 0xa8, 0x33, 0x1f, 0xa3, 0x76, 0x69, 0xf6, 0x89, 0x9c, 0x99, 0xfd,
+    0x93, 0x99, 0x82, 0xfb, 0x4d, 0x3c, 0x37, 0x13, 0x26, 0x80, 0xc1, 0xd3, 0x08, 0xac, 0x6a, 0xc1,
+    0x8d, 0xae, 0x16, 0xdc, 0x54, 0x56, 0x53, 0x62, 0x93, 0x2d, 0x5a, 0x0a, 0xc3, 0x6f, 0xbf, 0x89,
+    0x0b, 0xa5, 0x06, 0xbc, 0xf4, 0x82, 0x30, 0xeb, 0x46, 0xdf, 0xb1, 0x4e, 0xbb, 0x2b, 0x7a, 0xe6,
+    0x47, 0x98, 0xe2, 0xcd, 0x9e, 0x11, 0x53, 0x70, 0x93, 0xd5, 0x1c, 0xd6, 0x6a, 0x4d, 0x33, 0x56,
+    0x56, 0x62, 0x7c, 0x4b, 0x4b, 0xb7, 0x59, 0x88, 0xb1, 0xa9, 0x48, 0x6a, 0x15, 0x64, 0x34, 0x0b,
+    0x2a, 0x9e, 0xb0, 0x1e, 0x50, 0xa2, 0xdf, 0x34, 0x36, 0x23, 0x48, 0x85, 0xdf, 0xfc, 0x04, 0xa9,
+    0xb7, 0x7f, 0x04, 0x41, 0x76, 0x4f, 0x3b, 0xf4, 0x38, 0x6e, 0xc8, 0xd7, 0x23, 0xe7, 0xd9, 0x4d,
+    0x9c, 0xfd, 0x18, 0x8c, 0xc1, 0xed, 0xb2, 0x89, 0xaa, 0x51, 0xd0, 0xa2, 0x9e, 0x35, 0x70, 0xaf,
+    0x41, 0x3b, 0x96, 0x75, 0x91, 0x9e, 0xb7, 0x51, 0xf3, 0x99, 0x1f, 0xc3, 0x38, 0xdd, 0xc3, 0xf6,
+    0xd0, 0xb4, 0xf9, 0xff, 0x0d, 0xcf, 0xef, 0x6a, 0x78, 0x48, 0xc6, 0x95, 0x56, 0xc7, 0x74, 0x69,
+    0xa3, 0xb6, 0xe3, 0xd4, 0x46, 0xb6, 0x2f, 0x0f, 0x06, 0x68, 0x67, 0x47, 0x57, 0x2b, 0x9c, 0xdd,
+    0xc2, 0x30, 0xd1, 0x8b, 0xb2, 0x69, 0x12, 0x24, 0x38, 0xb5, 0x4a, 0x96, 0xc9, 0x57, 0x4b, 0x89,
+    0x55, 0x37, 0x69, 0x15, 0x38, 0xd0, 0x38, 0x39, 0x20, 0xa5, 0x71, 0x32, 0x9a, 0x6e, 0x62, 0x9e,
+    0x0a, 0x19, 0x38, 0x03, 0xcf, 0x10, 0x4e, 0xc5, 0xa0, 0xd3, 0xc4, 0xb4, 0x4c, 0x12, 0x9a, 0x26,
+    0x05, 0x62, 0xe8, 0x19, 0x6f, 0xd7, 0xd9, 0x02, 0xab, 0x13, 0x1c, 0x8a, 0xec, 0x0e, 0xfa, 0x03,
+    0x89, 0xb2, 0x14, 0xc1, 0xb5, 0x97, 0xe6, 0xbb, 0xdf, 0x81, 0xa8, 0x8d, 0xcc, 0x94, 0x58, 0xdb,
+    0x9e, 0xf3, 0x74, 0x96, 0xf9, 0x02, 0xb6, 0x9e, 0x51, 0x8d, 0x46, 0x21, 0xbf, 0x41, 0xf7, 0x6d,
+    0x7a, 0x86, 0xb7, 0xaa, 0xe9, 0x16, 0xf5, 0x84, 0xfe, 0x87, 0xb1, 0x45, 0xf9, 0xea, 0x3d, 0x1e,
+    0x0c, 0xc7, 0xc4, 0x83, 0xaa, 0x9d, 0xb8, 0xda, 0xaf, 0x7f, 0x5d, 0xf2, 0xf8, 0xe2, 0xd2, 0xf1,
+    0xea, 0xbc, 0xd6, 0x42, 0xa2, 0xcb, 0x40, 0x54, 0x5f, 0xb8, 0x81, 0xb0, 0x83, 0xff, 0x49, 0x84,
+    0x78, 0x49, 0xf8, 0x83, 0xcc, 0x1c, 0xd0, 0x35, 0xb2, 0x86, 0xdd, 0x88, 0xac, 0x61, 0x37, 0xec,
+    0xe9, 0x91, 0x45, 0x05, 0x16, 0x3d, 0xb1, 0x8b, 0xd8, 0x0e, 0x26, 0x2f, 0x93, 0xc8, 0xc6, 0x1c,
+    0xa4, 0x78, 0x0a, 0x63, 0x8c, 0x22, 0xdc, 0x50, 0x80, 0x7b, 0x8d, 0xe7, 0x09, 0x26, 0x8c, 0xeb,
+    0x34, 0x0a, 0x94, 0xa2, 0xc4, 0x65, 0xa8, 0xa0, 0x56, 0x3a, 0x9c, 0x8a, 0x9a, 0x5b, 0x41, 0xcd,
+    0xad, 0x41, 0x8d, 0x68, 0x84, 0x65, 0x4f, 0x9c, 0x32, 0xcc, 0xee, 0xb7, 0x8e, 0x1c, 0x90, 0xed,
+    0xad, 0x4d, 0x8e, 0x2d, 0xea, 0x5b, 0x0f, 0x35, 0x8e, 0xb8, 0xab, 0x14, 0x77, 0x91, 0x26, 0x0b,
+    0x9e, 0xc2, 0x24, 0x2e, 0xbe, 0xe4, 0xd2, 0x64, 0x7e, 0xed, 0xa4, 0xf3, 0x56, 0x6f, 0x50, 0x1f,
+    0xe9, 0x89, 0x4a, 0x1b, 0xc6, 0xad, 0x1e, 0x65, 0x95, 0x9f, 0x62, 0xe2, 0x34, 0x35, 0x61, 0x94,
+    0xbb, 0x53, 0x7e, 0x80, 0xd8, 0xed, 0xca, 0xde, 0x61, 0x99, 0x7d, 0x14, 0xe4, 0x24, 0x4e, 0xb3,
+    0xfc, 0x54, 0xac, 0x1b, 0xe4, 0xc6, 0x17, 0x09, 0x59, 0xb9, 0x5b, 0xf8, 0x42, 0xee, 0x54, 0x16,
+    0xb3, 0x2a, 0xea, 0x42, 0xbd, 0xee, 0x2e, 0x32, 0x5a, 0x05, 0x63, 0x98, 0x50, 0x51, 0xb3, 0x86,
+    0x39, 0x41, 0x2c, 0x8d, 0x91, 0x50, 0x6e, 0x99, 0xdb, 0x4f, 0xb0, 0xfa, 0x91, 0x60, 0x3f, 0x2a,
+    0xa1, 0x7d, 0x82, 0x42, 0x25, 0x19, 0x84, 0x6a, 0xca, 0xe6, 0xbb, 0x92, 0xbe, 0x88, 0xbc, 0x3e,
+    0x8a, 0x23, 0xd5, 0xe7, 0x85, 0xc6, 0x61, 0x2f, 0x5a, 0x1c, 0xbb, 0x17, 0x0c, 0x6c, 0x75, 0xbc,
+    0x95, 0xdd, 0x5c, 0x52, 0x43, 0xb3, 0xdb, 0xab, 0x4c, 0xc3, 0x0d, 0x15, 0x02, 0x10, 0xfa, 0xeb,
+    0x1f, 0xea, 0xc3, 0xe1, 0x50, 0x8d, 0xf3, 0x44, 0xac, 0xbc, 0xbb, 0xbd, 0xc5, 0x0d, 0x7b, 0x96,
+    0xc6, 0x60, 0x76, 0xc5, 0x0b, 0x74, 0x3c, 0x9e, 0x4d, 0xe3, 0x0b, 0x9c, 0x54, 0x6a, 0x21, 0x7d,
+    0x4b, 0xcb, 0x30, 0x0d, 0x98, 0x86, 0xa2, 0xae, 0x30, 0x39, 0x63, 0xb0, 0xd7, 0x2c, 0x89, 0x77,
+    0xa0, 0xb4, 0x38, 0xb8, 0xe2, 0x6a, 0x00, 0xe4, 0x69, 0x30, 0xcf, 0xa6, 0xf8, 0x89, 0xea, 0xee,
+    0xa0, 0x59, 0x1a, 0x38, 0x3d, 0x59, 0x4b, 0x7e, 0xc5, 0xba, 0x45, 0xb3, 0xe5, 0xe9, 0x6b, 0xe3,
+    0x8d, 0x26, 0xe3, 0x56, 0x92, 0xd1, 0x29, 0x46, 0x36, 0x1e, 0x1c, 0x4b, 0x52, 0x29, 0xb5, 0xa7,
+    0x3b, 0x59, 0x98, 0xc6, 0x8b, 0xfc, 0x18, 0x9e, 0xf0, 0xf0, 0x1b, 0xfe, 0xbd, 0xcc, 0x67, 0xd3,
+    0xe3, 0xad, 0xff, 0x0b, 0xac, 0xea, 0xcc, 0xf8, 0xb2, 0xdc, 0x00, 0x00,
+};
+
+// Size of the compressed blob as sent on the wire
+const size_t html_index_gz_size = 13100;
+
+// Size of the minified HTML after decompression
+const size_t html_index_size = 56482;
 
-// Size of the HTML content
-const size_t html_index_size = 81027;
+// Strong ETag: truncated SHA-256 of the compressed blob
+#define HTML_INDEX_ETAG "\"0821ef06e7eda113\""
 
 #endif // WEB_UI_H
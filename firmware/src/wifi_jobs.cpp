@@ -0,0 +1,348 @@
+#include "wifi_jobs.h"
+#include "wifi_manager.h"
+#include "event_bus.h"
+#include "api_response.h"
+#include "config.h"
+#include <esp_timer.h>
+
+// Recent jobs; the newest is at jobs[(nextJobId - 1) % WIFI_JOB_HISTORY]
+// Written only by the dispatcher task, except for the slot claimed in createWiFiJob()
+static WiFiJob jobs[WIFI_JOB_HISTORY] = {};
+static uint32_t nextJobId = 1;
+static portMUX_TYPE jobsLock = portMUX_INITIALIZER_UNLOCKED;
+
+// Set while a job owns the station interface; gates WiFi event forwarding
+static volatile bool jobActive = false;
+
+// Connection to restore when the job finishes (dispatcher task only)
+static WiFiMode_t previousMode = WIFI_OFF;
+static bool previousClientConnected = false;
+
+static esp_timer_handle_t jobTimeoutTimer = NULL;
+
+static const char* const jobTypeNames[] = { "test", "connect" };
+static const char* const jobStateNames[] = { "pending", "connecting", "succeeded", "failed" };
+static const char* const saveStateNames[] = { "pending", "saved", "failed" };
+
+static WiFiJob* findJob(uint32_t id) {
+    WiFiJob* job = &jobs[id % WIFI_JOB_HISTORY];
+    return job->id == id ? job : NULL;
+}
+
+static bool postJobSignal(WiFiJobSignal signal, uint8_t reason) {
+    return postEvent(EVENT_WIFI_JOB_SIGNAL, (uint32_t)signal | ((uint32_t)reason << 8));
+}
+
+/**
+ * Forward station events to the dispatcher while a job is running
+ * Runs in the WiFi event task
+ */
+static void onWiFiJobEvent(arduino_event_id_t event, arduino_event_info_t info) {
+    if (!jobActive) {
+        return;
+    }
+
+    if (event == ARDUINO_EVENT_WIFI_STA_GOT_IP) {
+        postJobSignal(WIFI_JOB_SIGNAL_GOT_IP, 0);
+    } else if (event == ARDUINO_EVENT_WIFI_STA_DISCONNECTED) {
+        postJobSignal(WIFI_JOB_SIGNAL_DISCONNECTED, info.wifi_sta_disconnected.reason);
+    }
+}
+
+static void jobTimeoutCallback(void* arg) {
+    // A lost timeout would leave the job connecting forever, so retry until it is queued
+    if (!postJobSignal(WIFI_JOB_SIGNAL_TIMEOUT, 0)) {
+        esp_timer_start_once(jobTimeoutTimer, WIFI_JOB_SIGNAL_RETRY_MS * 1000);
+    }
+}
+
+/**
+ * Disconnect reasons that will not resolve by waiting for the timeout
+ */
+static bool isFinalDisconnectReason(uint8_t reason) {
+    switch (reason) {
+        case WIFI_REASON_NO_AP_FOUND:
+        case WIFI_REASON_AUTH_FAIL:
+        case WIFI_REASON_4WAY_HANDSHAKE_TIMEOUT:
+        case WIFI_REASON_HANDSHAKE_TIMEOUT:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * Update a job's state and announce it
+ */
+static void setJobState(WiFiJob* job, WiFiJobState state, const char* error) {
+    portENTER_CRITICAL(&jobsLock);
+    job->state = state;
+    job->error = error;
+    if (state == WIFI_JOB_SUCCEEDED || state == WIFI_JOB_FAILED) {
+        job->finished_ms = millis();
+        memset(job->password, 0, sizeof(job->password));
+    }
+    portEXIT_CRITICAL(&jobsLock);
+
+    postEvent(EVENT_WIFI_JOB_UPDATED, job->id);
+}
+
+/**
+ * Begin connecting with the job's credentials without waiting for the result
+ */
+static void startJob(WiFiJob* job) {
+    previousMode = WiFi.getMode();
+    previousClientConnected = (currentWiFiState == WIFI_CONNECTED_CLIENT);
+
+    log_i("WiFi job %u: %s %s", job->id, jobTypeNames[job->type], job->ssid);
+
+    WiFi.mode(WIFI_AP_STA);
+    resetWiFiClientConfig();
+    WiFi.begin(job->ssid, job->password);
+
+    esp_timer_start_once(jobTimeoutTimer, (uint64_t)config.wifi_connection_timeout * 1000000);
+    setJobState(job, WIFI_JOB_CONNECTING, NULL);
+}
+
+/**
+ * Record the outcome, save credentials for a successful connect, and restore the previous connection
+ */
+static void finishJob(WiFiJob* job, bool success, const char* error) {
+    esp_timer_stop(jobTimeoutTimer);
+    jobActive = false;
+
+    if (success && job->type == WIFI_JOB_CONNECT) {
+        strlcpy(config.wifi_ssid, job->ssid, sizeof(config.wifi_ssid));
+        strlcpy(config.wifi_password, job->password, sizeof(config.wifi_password));
+        config.wifi_client_enabled = true;
+        clearWiFiCache(config);         // Learned again on the next startWiFiClient()
+        job->save_generation = requestConfigSave();
+    }
+
+    WiFi.disconnect();
+    WiFi.mode(previousMode);
+    if (previousClientConnected) {
+        beginWiFiClient(true);
+    }
+
+    if (success) {
+        log_i("WiFi job %u succeeded", job->id);
+        setJobState(job, WIFI_JOB_SUCCEEDED, NULL);
+    } else {
+        log_w("WiFi job %u failed: %s (reason %u)", job->id, error, job->reason);
+        setJobState(job, WIFI_JOB_FAILED, error);
+    }
+}
+
+/**
+ * Job state machine; runs in the dispatcher task
+ */
+static void onWiFiJobSignal(const Event& event) {
+    WiFiJobSignal signal = (WiFiJobSignal)(event.arg & 0xFF);
+    uint8_t reason = (event.arg >> 8) & 0xFF;
+
+    WiFiJob* job = findJob(nextJobId - 1);
+    if (!job) {
+        return;
+    }
+
+    switch (job->state) {
+        case WIFI_JOB_PENDING:
+            if (signal == WIFI_JOB_SIGNAL_START) {
+                startJob(job);
+            }
+            break;
+
+        case WIFI_JOB_CONNECTING:
+            if (signal == WIFI_JOB_SIGNAL_GOT_IP) {
+                finishJob(job, true, NULL);
+            } else if (signal == WIFI_JOB_SIGNAL_TIMEOUT) {
+                finishJob(job, false, "Connection timed out");
+            } else if (signal == WIFI_JOB_SIGNAL_DISCONNECTED) {
+                // Leaving the previous network also reports a disconnect; keep waiting unless the
+                // reason shows these credentials cannot work
+                job->reason = reason;
+                if (isFinalDisconnectReason(reason)) {
+                    finishJob(job, false, reason == WIFI_REASON_NO_AP_FOUND ? "Network not found" : "Authentication failed");
+                }
+            }
+            break;
+
+        case WIFI_JOB_SUCCEEDED:
+        case WIFI_JOB_FAILED:
+            // Late events from the finished job
+            break;
+    }
+}
+
+/**
+ * Claim a slot for a new job unless one is already running
+ * Returns the job id, or 0 with the running job's id in busyId
+ */
+static uint32_t createWiFiJob(WiFiJobType type, const char* ssid, const char* password, uint32_t& busyId) {
+    portENTER_CRITICAL(&jobsLock);
+    if (jobActive) {
+        busyId = nextJobId - 1;
+        portEXIT_CRITICAL(&jobsLock);
+        return 0;
+    }
+
+    uint32_t id = nextJobId++;
+    WiFiJob& job = jobs[id % WIFI_JOB_HISTORY];
+    job.id = id;
+    job.type = type;
+    job.state = WIFI_JOB_PENDING;
+    job.reason = 0;
+    job.error = NULL;
+    strlcpy(job.ssid, ssid, sizeof(job.ssid));
+    strlcpy(job.password, password, sizeof(job.password));
+    job.started_ms = millis();
+    job.finished_ms = 0;
+    job.save_generation = 0;
+    jobActive = true;
+    portEXIT_CRITICAL(&jobsLock);
+
+    if (!postJobSignal(WIFI_JOB_SIGNAL_START, 0)) {
+        // The dispatcher will never start this job; fail it so later requests are not locked out
+        log_w("WiFi job %u not started: event queue full", id);
+        portENTER_CRITICAL(&jobsLock);
+        job.state = WIFI_JOB_FAILED;
+        job.error = "Event queue full";
+        job.finished_ms = millis();
+        memset(job.password, 0, sizeof(job.password));
+        jobActive = false;
+        portEXIT_CRITICAL(&jobsLock);
+    }
+    return id;
+}
+
+/**
+ * True while a job owns the station interface (it may be on some other network)
+ */
+bool isWiFiJobActive() {
+    return jobActive;
+}
+
+/**
+ * Copy a job by id (0 selects the most recent job)
+ */
+bool getWiFiJob(uint32_t id, WiFiJob& job) {
+    bool found = false;
+
+    portENTER_CRITICAL(&jobsLock);
+    if (id == 0) {
+        id = nextJobId - 1;
+    }
+    WiFiJob* slot = id ? findJob(id) : NULL;
+    if (slot) {
+        job = *slot;
+        found = true;
+    }
+    portEXIT_CRITICAL(&jobsLock);
+
+    return found;
+}
+
+/**
+ * Write a job's public fields (never the password)
+ */
+void writeWiFiJobJson(JsonObject obj, const WiFiJob& job) {
+    obj["id"] = job.id;
+    obj["kind"] = jobTypeNames[job.type];
+    obj["state"] = jobStateNames[job.state];
+    obj["ssid"] = job.ssid;
+    if (job.reason) {
+        obj["reason"] = job.reason;
+    }
+    if (job.error) {
+        obj["error"] = job.error;
+    }
+    if (job.save_generation) {
+        obj["save"] = saveStateNames[getConfigSaveState(job.save_generation)];
+    }
+    uint32_t end_ms = job.finished_ms ? job.finished_ms : millis();
+    obj["elapsedMs"] = end_ms - job.started_ms;
+}
+
+/**
+ * Shared handler for /api/wifi/test and /api/wifi/connect: queue a job and answer 202 right away
+ */
+static void handleWiFiJobRequest(AsyncWebServerRequest *request, WiFiJobType type) {
+    const char* ssid = getParamValue(request, "ssid");
+    const char* password = getParamValue(request, "password");
+    if (!ssid || !password) {
+        sendText(request, 400, "Missing ssid or password parameter");
+        return;
+    }
+    if (strlen(ssid) == 0 || strlen(ssid) > 32 || strlen(password) > 64) {
+        sendText(request, 400, "Invalid ssid or password length");
+        return;
+    }
+
+    JsonResponseSlot *slot = beginJsonResponse(request);
+    if (!slot) return;
+    JsonDocument &doc = slot->doc;
+
+    uint32_t busyId = 0;
+    uint32_t id = createWiFiJob(type, ssid, password, busyId);
+    if (!id) {
+        doc["error"] = "WiFi job already running";
+        doc["id"] = busyId;
+        sendJsonSlot(request, slot, 409);
+        return;
+    }
+
+    WiFiJob job;
+    getWiFiJob(id, job);
+    writeWiFiJobJson(doc.to<JsonObject>(), job);
+    sendJsonSlot(request, slot, 202);
+}
+
+/**
+ * Register the WiFi job endpoints and state machine
+ * Must be called before webServer.begin()
+ */
+void setupWiFiJobs() {
+    esp_timer_create_args_t job_timer_config = {};
+    job_timer_config.callback = &jobTimeoutCallback;
+    job_timer_config.name = "wifi_job_timer";
+    ESP_ERROR_CHECK(esp_timer_create(&job_timer_config, &jobTimeoutTimer));
+
+    WiFi.onEvent(onWiFiJobEvent, ARDUINO_EVENT_WIFI_STA_GOT_IP);
+    WiFi.onEvent(onWiFiJobEvent, ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+    registerEventHandler(EVENT_WIFI_JOB_SIGNAL, onWiFiJobSignal);
+
+    // Test WiFi credentials (result via /api/wifi/job or the status socket)
+    webServer.on("/api/wifi/test", HTTP_POST, [](AsyncWebServerRequest *request) {
+        log_i("WiFi test API access");
+        handleWiFiJobRequest(request, WIFI_JOB_TEST);
+    });
+
+    // Test WiFi credentials and save them on success
+    webServer.on("/api/wifi/connect", HTTP_POST, [](AsyncWebServerRequest *request) {
+        log_i("WiFi connect API access");
+        handleWiFiJobRequest(request, WIFI_JOB_CONNECT);
+    });
+
+    // Poll a job (?id=N, default most recent)
+    webServer.on("/api/wifi/job", HTTP_GET, [](AsyncWebServerRequest *request) {
+        int32_t id = 0;
+        if (getParamValue(request, "id", false) && (!getParamInt32(request, "id", id, false) || id <= 0)) {
+            sendText(request, 400, "Invalid 'id' parameter");
+            return;
+        }
+
+        WiFiJob job;
+        if (!getWiFiJob((uint32_t)id, job)) {
+            sendText(request, 404, "No such WiFi job");
+            return;
+        }
+
+        JsonResponseSlot *slot = beginJsonResponse(request);
+        if (!slot) return;
+        writeWiFiJobJson(slot->doc.to<JsonObject>(), job);
+        sendJsonSlot(request, slot);
+    });
+
+    log_i("WiFi job handlers setup complete");
+}
@@ -0,0 +1,51 @@
+#ifndef WIFI_JOBS_H
+#define WIFI_JOBS_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// WiFi job configuration
+#define WIFI_JOB_HISTORY 4            // Finished jobs kept for polling
+#define WIFI_JOB_SIGNAL_RETRY_MS 100  // Timeout re-posted this often while the event queue is full
+
+enum WiFiJobType : uint8_t {
+    WIFI_JOB_TEST,                    // Try the credentials, then restore the previous connection
+    WIFI_JOB_CONNECT                  // Try the credentials and save them on success
+};
+
+enum WiFiJobState : uint8_t {
+    WIFI_JOB_PENDING,
+    WIFI_JOB_CONNECTING,
+    WIFI_JOB_SUCCEEDED,
+    WIFI_JOB_FAILED
+};
+
+// Inputs to the job state machine, posted as EVENT_WIFI_JOB_SIGNAL
+// (arg = signal | reason << 8)
+enum WiFiJobSignal : uint8_t {
+    WIFI_JOB_SIGNAL_START,
+    WIFI_JOB_SIGNAL_GOT_IP,
+    WIFI_JOB_SIGNAL_DISCONNECTED,
+    WIFI_JOB_SIGNAL_TIMEOUT
+};
+
+struct WiFiJob {
+    uint32_t id;                      // 0 marks an unused slot
+    WiFiJobType type;
+    WiFiJobState state;
+    uint8_t reason;                   // Last station disconnect reason (0 if none)
+    const char* error;                // Static failure description, NULL if none
+    char ssid[33];
+    char password[65];                // Cleared once the job finishes
+    uint32_t started_ms;
+    uint32_t finished_ms;
+    uint32_t save_generation;         // Credentials save of a successful connect job (0 if none)
+};
+
+// Function prototypes
+void setupWiFiJobs();
+bool getWiFiJob(uint32_t id, WiFiJob& job);
+bool isWiFiJobActive();
+void writeWiFiJobJson(JsonObject obj, const WiFiJob& job);
+
+#endif // WIFI_JOBS_H
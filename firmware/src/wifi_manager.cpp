@@ -1,24 +1,43 @@
 #include "wifi_manager.h"
 #include "main.h"
-#include "web_ui.h"  // Include the compiled HTML
+#include "web_ui.h"  // Include the compiled, gzipped HTML
 #include "build_info.h"
+#include "event_bus.h"
+#include "status_push.h"
+#include "debug_stream.h"
+#include "api_response.h"
+#include "alloc_stats.h"
+#include "batch_api.h"
+#include "wifi_jobs.h"
+#include "metrics.h"
+#include "http_trace.h"
+#include "deferred_log.h"
+#include "captive_dns.h"
+#include "config_schema.h"
+#include "boot_profile.h"
+#include "telemetry.h"
+#include "ota_update.h"
+#include "ota_delta.h"
+#include "history.h"
 #include "ESPmDNS.h"
+#include <esp_timer.h>
 
 // Global web server instance
 AsyncWebServer webServer(80);
-AsyncWebSocket debugWebSocket("/ws/debug");
-DNSServer dnsServer;
-
-// For tracking if OTA is in progress
-bool otaInProgress = false;
-
-// Debug WebSocket state
-bool debugStreamActive = false;
-unsigned long lastDebugSend = 0;
 
 // WiFi state management
 WiFiState currentWiFiState = WIFI_DISCONNECTED;
 
+// Set while the station is pinned to the cached BSSID/channel; cleared when that AP cannot be found
+static volatile bool stationLocked = false;
+
+// Set while startWiFiClient() owns the connection attempt
+static volatile bool clientConnectPending = false;
+
+static void rememberStation();
+
+static WiFiConnectStats connectStats = { -1, 0, false, 0, 0 };
+
 /**
  * Start WiFi in Access Point mode
  */
@@ -44,7 +63,7 @@ bool startWiFiAP() {
  * Setup captive portal DNS server
  */
 void setupCaptivePortal() {
-    dnsServer.start(DNS_PORT, "*", WiFi.softAPIP());
+    setupCaptiveDns();
     
     // Add handler for captive portal detection
     webServer.on("/generate_204", HTTP_GET, [](AsyncWebServerRequest *request) {
@@ -67,378 +86,318 @@ void setupCaptivePortal() {
         request->redirect("/");
     });
     
-    log_i("Captive portal DNS server started");
-}
-
-/**
- * Process DNS requests for captive portal
- */
-void handleDNS() {
-    dnsServer.processNextRequest();
-}
-
-/**
- * Handle WebSocket events for debug interface
- */
-void onDebugWebSocketEvent(AsyncWebSocket *server, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len) {
-    switch (type) {
-        case WS_EVT_CONNECT:
-            log_i("Debug WebSocket client #%u connected from %s", client->id(), client->remoteIP().toString().c_str());
-            break;
-            
-        case WS_EVT_DISCONNECT:
-            log_i("Debug WebSocket client #%u disconnected", client->id());
-            // If no clients connected, stop debug streaming
-            if (debugWebSocket.count() == 0) {
-                debugStreamActive = false;
-                log_i("Debug streaming stopped - no clients connected");
-            }
-            break;
-            
-        case WS_EVT_DATA: {
-            AwsFrameInfo *info = (AwsFrameInfo*)arg;
-            if (info->final && info->index == 0 && info->len == len && info->opcode == WS_TEXT) {
-                // Parse incoming message
-                String message = String((char*)data, len);
-                log_i("Debug WebSocket received: %s", message.c_str());
-                
-                if (message == "start") {
-                    debugStreamActive = true;
-                    lastDebugSend = 0; // Force immediate send
-                    log_i("Debug streaming started");
-                } else if (message == "stop") {
-                    debugStreamActive = false;
-                    log_i("Debug streaming stopped");
-                }
-            }
-            break;
-        }
-        
-        case WS_EVT_PONG:
-        case WS_EVT_ERROR:
-            break;
-    }
-}
-
-/**
- * Setup WebSocket handlers
- */
-void setupWebSockets() {
-    debugWebSocket.onEvent(onDebugWebSocketEvent);
-    webServer.addHandler(&debugWebSocket);
-    log_i("Debug WebSocket handler setup complete");
-}
-
-/**
- * Send debug data to connected WebSocket clients
- * This should be called from the debug timer at 10Hz
- */
-void sendDebugData() {
-    if (!debugStreamActive || debugWebSocket.count() == 0) {
-        return;
-    }
-    
-    unsigned long currentTime = millis();
-    if (currentTime - lastDebugSend < DEBUG_SEND_INTERVAL_MS) {
-        return;
-    }
-    
-    // Get motion control information
-    MotionControlInfo motionInfo = get_motion_control_info();
-    
-    // Create JSON debug data
-    StaticJsonDocument<256> doc;
-    doc["timestamp"] = currentTime;
-    doc["currentPosition"] = get_current_position();
-    doc["currentVelocity"] = motionInfo.velocity;
-    doc["targetPosition"] = motionInfo.target_position;
-    doc["motionActive"] = motionInfo.motion_active;
-    
-    // Add real motion control debug data
-    doc["speedError"] = motionInfo.speed_error;
-    doc["errorIntegral"] = motionInfo.speed_error_integral;  
-    doc["errorDerivative"] = motionInfo.speed_error_derivative;
-    doc["controlPWMOut"] = motionInfo.pwm_control_out;
-    
-    String jsonString;
-    serializeJson(doc, jsonString);
-    
-    debugWebSocket.textAll(jsonString);
-    lastDebugSend = currentTime;
+    log_i("Captive portal setup complete");
 }
 
 /**
  * Setup the web server routes and handlers
  */
 void setupWebServer() {
-    // Serve the root index page from compiled HTML (PROGMEM)
+    // Preallocate the JSON response buffers used by the /api handlers
+    setupJsonResponsePool();
+
+    // Request timing hook; must precede every route
+    setupHttpTrace();
+
+    // Serve the root index page from the pre-gzipped blob compiled into flash
     webServer.on("/", HTTP_GET, [](AsyncWebServerRequest *request) {
-        log_i("Root http access");
-        request->send(200, "text/html", html_index);
+        dlog_i(LOG_MODULE_API, "Root http access");
+        AsyncWebServerResponse *response;
+
+        // The blob only changes with a firmware update, so a matching ETag means the
+        // browser's cached copy is current
+        if (request->hasHeader("If-None-Match") &&
+            request->header("If-None-Match").indexOf(HTML_INDEX_ETAG) >= 0) {
+            response = request->beginResponse(304);
+        } else {
+            response = request->beginResponse(200, "text/html", html_index_gz, html_index_gz_size);
+            response->addHeader("Content-Encoding", "gzip");
+        }
+
+        // no-cache: browsers may store the page but must revalidate with If-None-Match
+        response->addHeader("ETag", HTML_INDEX_ETAG);
+        response->addHeader("Cache-Control", "no-cache");
+        request->send(response);
     });
     
     // API endpoint for getting current status
+    // Browsers normally subscribe to /ws/status instead of polling this
     webServer.on("/api/status", HTTP_GET, [](AsyncWebServerRequest *request) {
-        AsyncResponseStream *response = request->beginResponseStream("application/json");
-        StaticJsonDocument<256> doc;  // Smaller document for just status
-        
-        doc["currentPosition"] = get_current_position();
-        doc["currentAngle"] = positionToAngle(get_current_position());
-        doc["autoRotationEnabled"] = config.auto_rotation_enabled;
-        doc["autoRotateForward"] = config.auto_rotate_forward;
-
-        // Current color based on angle (rounded to nearest 90)
-        int currentAngle = positionToAngle(get_current_position());
-        int currentAngleSnapped = ((currentAngle + 45) / 90) * 90;
-        if (currentAngleSnapped >= 360) currentAngleSnapped = 0;
-        switch(currentAngleSnapped) {
-            case 0: doc["currentColor"] = config.color_0; break;
-            case 90: doc["currentColor"] = config.color_90; break;
-            case 180: doc["currentColor"] = config.color_180; break;
-            case 270: doc["currentColor"] = config.color_270; break;
-        }
-        doc["motionActive"] = is_motion_active();
+        JsonResponseSlot *slot = beginJsonResponse(request);
+        if (!slot) return;
+        JsonDocument &doc = slot->doc;
+
+        StatusSnapshot snapshot;
+        captureStatus(snapshot);
+        writeStatusJson(doc.to<JsonObject>(), snapshot, nullptr);
         
-        serializeJson(doc, *response);
-        log_i("Status API access");
-        request->send(response);
+        dlog_d(LOG_MODULE_API, "Status API access");
+        sendJsonSlot(request, slot);
+    });
+    
+    // API endpoint for exporting the settings as JSON that /api/settings accepts back
+    // Registered before /api/config, which would otherwise match it as a prefix
+    webServer.on("/api/config/export", HTTP_GET, [](AsyncWebServerRequest *request) {
+        JsonResponseSlot *slot = beginJsonResponse(request);
+        if (!slot) return;
+        writeSettingsJson(slot->doc.to<JsonObject>(), config);
+        
+        dlog_i(LOG_MODULE_API, "Config export API access");
+        sendJsonSlot(request, slot);
     });
     
     // API endpoint for getting configuration
     webServer.on("/api/config", HTTP_GET, [](AsyncWebServerRequest *request) {
-        AsyncResponseStream *response = request->beginResponseStream("application/json");
-        StaticJsonDocument<768> doc;  // Increased size for motion control params
-        
-        // Position calibration
-        doc["pos_0_degrees"] = config.pos_0_degrees;
-        doc["pos_90_degrees"] = config.pos_90_degrees;
-        doc["pos_180_degrees"] = config.pos_180_degrees;
-        doc["pos_270_degrees"] = config.pos_270_degrees;
-
-        doc["full_rotation_count"] = config.full_rotation_count;
-        
-        // Colors
-        doc["color_0"] = config.color_0;
-        doc["color_90"] = config.color_90;
-        doc["color_180"] = config.color_180;
-        doc["color_270"] = config.color_270;
-
-        // WiFi settings
-        doc["ap_ssid"] = config.ap_ssid;
-        doc["ap_password"] = config.ap_password;
-        doc["mdns_name"] = config.mdns_name;
+        JsonResponseSlot *slot = beginJsonResponse(request);
+        if (!slot) return;
+        JsonDocument &doc = slot->doc;
         
-        // Rotation settings
-        doc["rotation_interval"] = config.rotation_interval;
-        
-        // Motion control parameters
-        doc["position_hysteresis"] = config.position_hysteresis;
-        doc["max_speed"] = config.max_speed;
-        doc["acceleration"] = config.acceleration;
-        doc["vel_loop_p"] = config.vel_loop_p;
-        doc["vel_loop_i"] = config.vel_loop_i;
-        doc["vel_loop_d"] = config.vel_loop_d;
-        doc["vel_filter_persistence"] = config.vel_filter_persistence;
-        doc["spd_err_persistence"] = config.spd_err_persistence;
-        
-        serializeJson(doc, *response);
-        log_i("Config API access");
-        request->send(response);
+        writeSettingsJson(doc.to<JsonObject>(), config);
+        doc["control_auth"] = (config.control_key[0] != '\0');  // The key itself is write-only
+        
+        dlog_i(LOG_MODULE_API, "Config API access");
+        sendJsonSlot(request, slot);
     });
 
     // API endpoint for build information
     webServer.on("/api/buildinfo", HTTP_GET, [](AsyncWebServerRequest *request) {
-        AsyncResponseStream *response = request->beginResponseStream("application/json");
-        StaticJsonDocument<256> doc;
+        JsonResponseSlot *slot = beginJsonResponse(request);
+        if (!slot) return;
+        JsonDocument &doc = slot->doc;
 
         doc["gitHash"] = BUILD_GIT_HASH;
         doc["gitBranch"] = BUILD_GIT_BRANCH;
         doc["buildTimestamp"] = BUILD_TIMESTAMP;
 
-        serializeJson(doc, *response);
-        log_i("Build info API access");
-        request->send(response);
+        dlog_i(LOG_MODULE_API, "Build info API access");
+        sendJsonSlot(request, slot);
     });
 
-    // API endpoint for updating settings
-    AsyncCallbackJsonWebHandler* settingsHandler = new AsyncCallbackJsonWebHandler("/api/settings", 
-        [](AsyncWebServerRequest *request, JsonVariant &json) {
-            JsonObject jsonObj = json.as<JsonObject>();
-            
-            // WiFi settings if present
-            if (jsonObj.containsKey("ap_ssid")) {
-                strlcpy(config.ap_ssid, jsonObj["ap_ssid"], sizeof(config.ap_ssid));
-            }
-            
-            if (jsonObj.containsKey("ap_password")) {
-                strlcpy(config.ap_password, jsonObj["ap_password"], sizeof(config.ap_password));
-            }
-            
-            if (jsonObj.containsKey("mdns_name")) {
-                strlcpy(config.mdns_name, jsonObj["mdns_name"], sizeof(config.mdns_name));
-            }
-            
-            // Position calibration if present
-            if (jsonObj.containsKey("pos_0_degrees")) {
-                config.pos_0_degrees = jsonObj["pos_0_degrees"];
-            }
-            
-            if (jsonObj.containsKey("pos_90_degrees")) {
-                config.pos_90_degrees = jsonObj["pos_90_degrees"];
-            }
-            
-            if (jsonObj.containsKey("pos_180_degrees")) {
-                config.pos_180_degrees = jsonObj["pos_180_degrees"];
-            }
-            
-            if (jsonObj.containsKey("pos_270_degrees")) {
-                config.pos_270_degrees = jsonObj["pos_270_degrees"];
-            }
+    // API endpoint for event dispatcher instrumentation
+    webServer.on("/api/events", HTTP_GET, [](AsyncWebServerRequest *request) {
+        JsonResponseSlot *slot = beginJsonResponse(request);
+        if (!slot) return;
+        JsonDocument &doc = slot->doc;
+        EventBusStats stats;
+        getEventBusStats(stats);
+
+        doc["queueDepth"] = stats.queue_depth;
+        doc["maxQueueDepth"] = stats.max_queue_depth;
+        doc["queueCapacity"] = stats.queue_capacity;
+
+        JsonObject types = doc.createNestedObject("types");
+        for (int i = 0; i < EVENT_TYPE_COUNT; i++) {
+            const EventTypeStats& typeStats = stats.types[i];
+            JsonObject entry = types.createNestedObject(eventTypeName((EventType)i));
+            entry["posted"] = typeStats.posted;
+            entry["dispatched"] = typeStats.dispatched;
+            entry["dropped"] = typeStats.dropped;
+            entry["maxLatencyUs"] = typeStats.max_latency_us;
+            entry["avgLatencyUs"] = typeStats.dispatched ? (uint32_t)(typeStats.total_latency_us / typeStats.dispatched) : 0;
+            entry["maxHandlerUs"] = typeStats.max_handler_us;
+            entry["avgHandlerUs"] = typeStats.dispatched ? (uint32_t)(typeStats.total_handler_us / typeStats.dispatched) : 0;
+        }
 
-            if (jsonObj.containsKey("full_rotation_count")) {
-                config.full_rotation_count = jsonObj["full_rotation_count"];
-            }
-            
-            // Colors if present
-            if (jsonObj.containsKey("color_0")) {
-                config.color_0 = jsonObj["color_0"];
-            }
-            
-            if (jsonObj.containsKey("color_90")) {
-                config.color_90 = jsonObj["color_90"];
-            }
-            
-            if (jsonObj.containsKey("color_180")) {
-                config.color_180 = jsonObj["color_180"];
-            }
-            
-            if (jsonObj.containsKey("color_270")) {
-                config.color_270 = jsonObj["color_270"];
-            }
-            
-            // Rotation settings if present
-            if (jsonObj.containsKey("rotation_interval")) {
-                config.rotation_interval = jsonObj["rotation_interval"];
-            }
-            
-            if (jsonObj.containsKey("auto_rotation_enabled")) {
-                config.auto_rotation_enabled = jsonObj["auto_rotation_enabled"];
-            }
+        sendJsonSlot(request, slot);
+    });
 
-            if (jsonObj.containsKey("auto_rotate_forward")) {
-                config.auto_rotate_forward = jsonObj["auto_rotate_forward"];
-            }
-            
-            // Motion control parameters if present
-            if (jsonObj.containsKey("position_hysteresis")) {
-                config.position_hysteresis = jsonObj["position_hysteresis"];
-            }
-            
-            if (jsonObj.containsKey("max_speed")) {
-                config.max_speed = jsonObj["max_speed"];
-            }
-            
-            if (jsonObj.containsKey("acceleration")) {
-                config.acceleration = jsonObj["acceleration"];
-            }
-            
-            if (jsonObj.containsKey("vel_loop_p")) {
-                config.vel_loop_p = jsonObj["vel_loop_p"];
-            }
-            
-            if (jsonObj.containsKey("vel_loop_i")) {
-                config.vel_loop_i = jsonObj["vel_loop_i"];
+    // API endpoint for heap and response pool diagnostics (used by tools/api_bench.py)
+    webServer.on("/api/diagnostics/heap", HTTP_GET, [](AsyncWebServerRequest *request) {
+        JsonResponseSlot *slot = beginJsonResponse(request);
+        if (!slot) return;
+        JsonDocument &doc = slot->doc;
+        HeapStats heap;
+        JsonResponsePoolStats pool;
+        getHeapStats(heap);
+        getJsonResponsePoolStats(pool);
+
+        doc["freeHeap"] = heap.free_heap;
+        doc["minFreeHeap"] = heap.min_free_heap;
+        doc["largestFreeBlock"] = heap.largest_free_block;
+        doc["freePsram"] = heap.free_psram;
+        doc["minFreePsram"] = heap.min_free_psram;
+        doc["allocationTracking"] = heap.allocation_tracking;
+        doc["allocations"] = heap.allocation_count;
+        doc["poolInUse"] = pool.in_use;
+        doc["poolMaxInUse"] = pool.max_in_use;
+        doc["poolExhausted"] = pool.exhausted;
+        doc["poolOverflows"] = pool.overflows;
+
+        sendJsonSlot(request, slot);
+    });
+
+    // API endpoint for deferred configuration saving
+    webServer.on("/api/diagnostics/config", HTTP_GET, [](AsyncWebServerRequest *request) {
+        JsonResponseSlot *slot = beginJsonResponse(request);
+        if (!slot) return;
+        JsonDocument &doc = slot->doc;
+        ConfigStoreStats stats;
+        getConfigStoreStats(stats);
+
+        doc["dirty"] = stats.dirty;
+        doc["saveRequests"] = stats.save_requests;
+        doc["flushes"] = stats.flushes;
+        doc["failures"] = stats.failures;
+        doc["lastFlushUs"] = stats.last_flush_us;
+        doc["maxFlushUs"] = stats.max_flush_us;
+
+        sendJsonSlot(request, slot);
+    });
+
+    // API endpoint for the boot timeline (setup phases and readiness milestones)
+    webServer.on("/api/diagnostics/boot", HTTP_GET, [](AsyncWebServerRequest *request) {
+        JsonResponseSlot *slot = beginJsonResponse(request);
+        if (!slot) return;
+        JsonDocument &doc = slot->doc;
+
+        static const char* const milestoneKeys[BOOT_MILESTONE_COUNT] = {
+            "motorReadyUs", "networkReadyUs", "startupDoneUs"
+        };
+        static const char* const spiffsStates[] = { "pending", "mounted", "formatted", "failed" };
+        doc["spiffs"] = spiffsStates[get_spiffs_mount_state()];
+        for (int i = 0; i < BOOT_MILESTONE_COUNT; i++) {
+            int64_t at_us = getBootMilestoneUs((BootMilestone)i);
+            if (at_us >= 0) {
+                doc[milestoneKeys[i]] = at_us;
             }
-            
-            if (jsonObj.containsKey("vel_loop_d")) {
-                config.vel_loop_d = jsonObj["vel_loop_d"];
+        }
+
+        JsonArray phases = doc.createNestedArray("phases");
+        for (uint8_t i = 0; i < getBootPhaseCount(); i++) {
+            const BootPhase* phase = getBootPhase(i);
+            JsonObject entry = phases.createNestedObject();
+            entry["name"] = phase->name;
+            entry["core"] = phase->core;
+            entry["startUs"] = phase->start_us;
+            if (phase->end_us) {
+                entry["durationUs"] = phase->end_us - phase->start_us;
             }
-            
-            if (jsonObj.containsKey("vel_filter_persistence")) {
-                config.vel_filter_persistence = jsonObj["vel_filter_persistence"];
+        }
+
+        sendJsonSlot(request, slot);
+    });
+
+    webServer.on("/api/diagnostics/scheduler", HTTP_GET, [](AsyncWebServerRequest *request) {
+        JsonResponseSlot *slot = beginJsonResponse(request);
+        if (!slot) return;
+        JsonDocument &doc = slot->doc;
+
+        TickSchedulerStats stats;
+        get_tick_scheduler_stats(stats);
+        doc["tickMs"] = CONTROL_TICK_MS;
+        doc["wakeups"] = stats.ticks;
+        doc["wakeupsPerSecond"] = 1000 / CONTROL_TICK_MS;
+        doc["overruns"] = stats.overruns;
+        doc["maxTickUs"] = stats.max_tick_us;
+
+        JsonArray tasks = doc.createNestedArray("tasks");
+        for (uint8_t i = 0; i < get_tick_task_count(); i++) {
+            TickTaskStats task;
+            get_tick_task_stats(i, task);
+            JsonObject entry = tasks.createNestedObject();
+            entry["name"] = task.name;
+            entry["periodMs"] = task.divisor * CONTROL_TICK_MS;
+            entry["phase"] = task.phase;
+            entry["runs"] = task.runs;
+            entry["maxRunUs"] = task.max_run_us;
+        }
+
+        sendJsonSlot(request, slot);
+    });
+
+    // API endpoint for updating settings
+    AsyncCallbackJsonWebHandler* settingsHandler = new AsyncCallbackJsonWebHandler("/api/settings", 
+        [](AsyncWebServerRequest *request, JsonVariant &json) {
+            JsonObject jsonObj = json.as<JsonObject>();
+            if (jsonObj.isNull()) {
+                sendText(request, 400, "Body must be a JSON object");
+                return;
             }
             
-            if (jsonObj.containsKey("spd_err_persistence")) {
-                config.spd_err_persistence = jsonObj["spd_err_persistence"];
+            // Reject the whole request if any value is out of range, so nothing is half-applied
+            const char* invalid = findInvalidSetting(jsonObj);
+            if (invalid) {
+                char message[64];
+                snprintf(message, sizeof(message), "Invalid value for '%s'", invalid);
+                request->send(400, "text/plain", message);  // Copied; sendText() needs a literal
+                return;
             }
+            applySettingsJson(jsonObj, config);
             
-            // Save the updated configuration
-            saveConfiguration();
-            
-            // Update runtime motion control parameters
-            setMotionControlConfig(config.position_hysteresis, config.max_speed, config.acceleration,
-                                  config.vel_loop_p, config.vel_loop_i, config.vel_loop_d,
-                                  config.vel_filter_persistence, config.spd_err_persistence);
+            // Saved in the background once the changes settle
+            requestConfigSave();
             
-            // Update calibration-based parameters
-            updateMotionControlCalibration();
+            // Update runtime motion control and calibration parameters
+            applyRuntimeConfig();
             
-            request->send(200, "text/plain", "Settings updated");
+            sendText(request, 200, "Settings updated");
         }
     );
     webServer.addHandler(settingsHandler);
+
+    // API endpoint for applying several operations in one request
+    setupBatchApi();
     
     // API endpoint for commanding a rotation
     webServer.on("/api/rotate", HTTP_POST, [](AsyncWebServerRequest *request) {
-        log_i("Rotate API access");
-        if (!request->hasParam("angle", true)) {
-            request->send(400, "text/plain", "Missing 'angle' parameter");
+        dlog_i(LOG_MODULE_API, "Rotate API access");
+        int32_t angle;
+        if (!getParamInt32(request, "angle", angle)) {
+            sendText(request, 400, "Missing or invalid 'angle' parameter");
             return;
         }
         
-        int angle = request->getParam("angle", true)->value().toInt();
         if (angle != 0 && angle != 90 && angle != 180 && angle != 270) {
-            request->send(400, "text/plain", "Angle must be 0, 90, 180, or 270");
+            sendText(request, 400, "Angle must be 0, 90, 180, or 270");
             return;
         }
         
         // Command the rotation
         rotateToAngle(angle);
-        request->send(200, "text/plain", "Rotation commanded");
+        sendText(request, 200, "Rotation commanded");
     });
     
     // API endpoint for setting the current position as the new zero reference point
     webServer.on("/api/set-zero", HTTP_POST, [](AsyncWebServerRequest *request) {
-        log_i("Set Zero API access");
+        dlog_i(LOG_MODULE_API, "Set Zero API access");
         
         reset_motor_control();
-        log_i("Zero position set. Offset applied)");
+        dlog_i(LOG_MODULE_API, "Zero position set. Offset applied)");
         
-        request->send(200, "text/plain", "Zero position set successfully");
+        sendText(request, 200, "Zero position set successfully");
     });
     
     // API endpoint for going to a specific encoder position
     webServer.on("/api/goto", HTTP_POST, [](AsyncWebServerRequest *request) {
-        log_i("Goto API access");
-        if (!request->hasParam("position", true)) {
-            request->send(400, "text/plain", "Missing 'position' parameter");
+        dlog_i(LOG_MODULE_API, "Goto API access");
+        int64_t targetPosition;
+        if (!getParamInt64(request, "position", targetPosition)) {
+            sendText(request, 400, "Missing or invalid 'position' parameter");
             return;
         }
 
-        int64_t targetPosition = strtoll(request->getParam("position", true)->value().c_str(), NULL, 10);
-
         // Command the movement using default speed and acceleration
         move_to_position(targetPosition);
 
-        log_i("Commanded movement to position: %lld", targetPosition);
-        request->send(200, "text/plain", "Movement commanded");
+        dlog_i(LOG_MODULE_API, "Commanded movement to position: %lld", targetPosition);
+        sendText(request, 200, "Movement commanded");
     });
     
     // Endpoint for resetting to default settings
     webServer.on("/api/reset", HTTP_POST, [](AsyncWebServerRequest *request) {
-        log_i("Reset API Access");
+        dlog_i(LOG_MODULE_API, "Reset API Access");
         resetToDefaultConfig();
-        request->send(200, "text/plain", "Settings reset to defaults");
+        sendText(request, 200, "Settings reset to defaults");
     });
     
     // WiFi management API endpoints
     // Scan for available networks
     webServer.on("/api/wifi/scan", HTTP_GET, [](AsyncWebServerRequest *request) {
-        log_i("WiFi scan API access");
+        dlog_i(LOG_MODULE_API, "WiFi scan API access");
         
         // Check if scan is already running
         if (WiFi.scanComplete() == WIFI_SCAN_RUNNING) {
-            request->send(409, "text/plain", "Scan already in progress");
+            sendText(request, 409, "Scan already in progress");
             return;
         }
         
@@ -446,27 +405,28 @@ void setupWebServer() {
         WiFi.scanNetworks(true);
         
         // Return immediately with scan started message
-        request->send(202, "text/plain", "Scan started");
+        sendText(request, 202, "Scan started");
     });
     
     // Get scan results
     webServer.on("/api/wifi/scan-results", HTTP_GET, [](AsyncWebServerRequest *request) {
-        log_i("WiFi scan results API access");
+        dlog_i(LOG_MODULE_API, "WiFi scan results API access");
         
         int n = WiFi.scanComplete();
         
         if (n == WIFI_SCAN_RUNNING) {
-            request->send(202, "text/plain", "Scan in progress");
+            sendText(request, 202, "Scan in progress");
             return;
         }
         
         if (n == WIFI_SCAN_FAILED) {
-            request->send(500, "text/plain", "Scan failed");
+            sendText(request, 500, "Scan failed");
             return;
         }
         
-        AsyncResponseStream *response = request->beginResponseStream("application/json");
-        StaticJsonDocument<2048> doc;
+        JsonResponseSlot *slot = beginJsonResponse(request);
+        if (!slot) return;
+        JsonDocument &doc = slot->doc;
         JsonArray networks = doc.createNestedArray("networks");
         
         if (n > 0) {
@@ -478,85 +438,35 @@ void setupWebServer() {
             }
         }
         
-        serializeJson(doc, *response);
-        request->send(response);
+        sendJsonSlot(request, slot);
     });
     
-    // Test WiFi connection
-    webServer.on("/api/wifi/test", HTTP_POST, [](AsyncWebServerRequest *request) {
-        log_i("WiFi test API access");
-        
-        if (!request->hasParam("ssid", true) || !request->hasParam("password", true)) {
-            request->send(400, "text/plain", "Missing ssid or password parameter");
-            return;
-        }
-        
-        String ssid = request->getParam("ssid", true)->value();
-        String password = request->getParam("password", true)->value();
-        
-        if (testWiFiConnection(ssid.c_str(), password.c_str())) {
-            request->send(200, "text/plain", "Connection test successful");
-        } else {
-            request->send(400, "text/plain", "Connection test failed");
-        }
-    });
-    
-    // Connect to WiFi and save credentials
-    webServer.on("/api/wifi/connect", HTTP_POST, [](AsyncWebServerRequest *request) {
-        log_i("WiFi connect API access");
-        
-        if (!request->hasParam("ssid", true) || !request->hasParam("password", true)) {
-            request->send(400, "text/plain", "Missing ssid or password parameter");
-            return;
-        }
-        
-        String ssid = request->getParam("ssid", true)->value();
-        String password = request->getParam("password", true)->value();
-        
-        // Test connection first
-        if (!testWiFiConnection(ssid.c_str(), password.c_str())) {
-            request->send(400, "text/plain", "Connection test failed");
-            return;
-        }
-        
-        // Save credentials
-        strlcpy(config.wifi_ssid, ssid.c_str(), sizeof(config.wifi_ssid));
-        strlcpy(config.wifi_password, password.c_str(), sizeof(config.wifi_password));
-        config.wifi_client_enabled = true;
-        
-        // Save configuration
-        if (saveConfiguration()) {
-            request->send(200, "text/plain", "WiFi credentials saved successfully");
-        } else {
-            request->send(500, "text/plain", "Failed to save configuration");
-        }
-    });
+    // Credential test and connect run as jobs so this task never waits on the radio
+    setupWiFiJobs();
     
     // Disconnect and clear WiFi credentials
     webServer.on("/api/wifi/disconnect", HTTP_POST, [](AsyncWebServerRequest *request) {
-        log_i("WiFi disconnect API access");
+        dlog_i(LOG_MODULE_API, "WiFi disconnect API access");
         
         // Clear credentials
         strlcpy(config.wifi_ssid, "", sizeof(config.wifi_ssid));
         strlcpy(config.wifi_password, "", sizeof(config.wifi_password));
         config.wifi_client_enabled = false;
         
-        // Save configuration
-        if (saveConfiguration()) {
-            // Switch to AP mode
-            switchToAPMode();
-            request->send(200, "text/plain", "WiFi disconnected and credentials cleared");
-        } else {
-            request->send(500, "text/plain", "Failed to save configuration");
-        }
+        requestConfigSave();
+        
+        // Switch to AP mode
+        switchToAPMode();
+        sendText(request, 200, "WiFi disconnected and credentials cleared");
     });
     
     // Get WiFi status
     webServer.on("/api/wifi/status", HTTP_GET, [](AsyncWebServerRequest *request) {
-        log_i("WiFi status API access");
+        dlog_i(LOG_MODULE_API, "WiFi status API access");
         
-        AsyncResponseStream *response = request->beginResponseStream("application/json");
-        StaticJsonDocument<256> doc;
+        JsonResponseSlot *slot = beginJsonResponse(request);
+        if (!slot) return;
+        JsonDocument &doc = slot->doc;
         
         doc["state"] = (int)getWiFiState();
         doc["status"] = getWiFiStatus();
@@ -564,6 +474,26 @@ void setupWebServer() {
         doc["client_enabled"] = config.wifi_client_enabled;
         doc["mdns_name"] = config.mdns_name;
         doc["rssi"] = WiFi.RSSI();
+
+        CaptiveDnsStats dns;
+        getCaptiveDnsStats(dns);
+        JsonObject captiveDns = doc.createNestedObject("captiveDns");
+        captiveDns["listening"] = dns.listening;
+        captiveDns["answered"] = dns.answered;
+        captiveDns["empty"] = dns.empty;
+        captiveDns["ignored"] = dns.ignored;
+
+        WiFiConnectStats stats;
+        getWiFiConnectStats(stats);
+        JsonObject connect = doc.createNestedObject("connect");
+        if (stats.boot_to_online_ms >= 0) {
+            connect["bootToOnlineMs"] = stats.boot_to_online_ms;
+        }
+        connect["lastConnectMs"] = stats.last_connect_ms;
+        connect["usedCache"] = stats.last_used_cache;
+        connect["cachedAttempts"] = stats.cached_attempts;
+        connect["cachedFailures"] = stats.cached_failures;
+        connect["cachedChannel"] = config.wifi_channel;
         
         if (WiFi.getMode() == WIFI_STA && WiFi.status() == WL_CONNECTED) {
             doc["ip"] = WiFi.localIP().toString();
@@ -571,12 +501,20 @@ void setupWebServer() {
             doc["ip"] = WiFi.softAPIP().toString();
         }
         
-        serializeJson(doc, *response);
-        request->send(response);
+        sendJsonSlot(request, slot);
     });
     
     // Setup WebSocket handlers
-    setupWebSockets();
+    setupDebugStream();
+    setupStatusPush();
+    setupMetrics();
+    setupTelemetry();
+    setupLogStream();
+
+    // Firmware update and move history routes (history answers 503 until SPIFFS is indexed)
+    setupOTA();
+    setupDeltaOTA();
+    setupHistoryApi();
     
     // Start the web server
     webServer.begin();
@@ -584,56 +522,35 @@ void setupWebServer() {
 }
 
 /**
- * Setup OTA update handler
+ * Follow the station link after the initial connection; the core reconnects on its own
  */
-void setupOTA() {
-    // OTA update endpoint
-    webServer.on("/update", HTTP_POST, 
-        [](AsyncWebServerRequest *request) {
-            bool shouldReboot = !Update.hasError();
-            AsyncWebServerResponse *response = request->beginResponse(200, "text/plain", 
-                shouldReboot ? "Update complete, rebooting..." : "Update failed!");
-            response->addHeader("Connection", "close");
-            request->send(response);
-            
-            if (shouldReboot) {
-                delay(1000);
-                ESP.restart();
-            }
-        },
-        [](AsyncWebServerRequest *request, const String& filename, size_t index, uint8_t *data, size_t len, bool final) {
-            // Handle the actual OTA update
-            if (!index) {
-                log_i("OTA update started: %s", filename.c_str());
-                otaInProgress = true;
-                
-                // Check if the update is possible
-                if (!Update.begin(UPDATE_SIZE_UNKNOWN)) {
-                    log_e("OTA update not possible: %s", Update.errorString());
-                    request->send(400, "text/plain", "OTA update not possible");
-                    return;
-                }
-            }
-            
-            // Write the data to flash
-            if (Update.write(data, len) != len) {
-                log_e("OTA update error: %s", Update.errorString());
-                return;
-            }
-            
-            // When the update is complete
-            if (final) {
-                if (Update.end(true)) {
-                    log_i("OTA update successful");
-                } else {
-                    log_e("OTA update failed: %s", Update.errorString());
-                }
-                otaInProgress = false;
+static void onWiFiStateEvent(arduino_event_id_t event, arduino_event_info_t info) {
+    if (event == ARDUINO_EVENT_WIFI_STA_DISCONNECTED) {
+        // The core retries the pinned BSSID forever; if that AP is gone, rejoin by scanning
+        if (stationLocked && info.wifi_sta_disconnected.reason == WIFI_REASON_NO_AP_FOUND) {
+            stationLocked = false;
+            if (!clientConnectPending && currentWiFiState != WIFI_CONNECTED_AP) {
+                dlog_w(LOG_MODULE_WIFI, "Cached access point not found, scanning");
+                beginWiFiClient(false);
             }
         }
-    );
-    
-    log_i("OTA update handler setup complete");
+        if (currentWiFiState == WIFI_CONNECTED_CLIENT) {
+            setWiFiState(WIFI_CONNECTING_CLIENT);
+        }
+    } else if (event == ARDUINO_EVENT_WIFI_STA_GOT_IP) {
+        if (connectStats.boot_to_online_ms < 0) {
+            connectStats.boot_to_online_ms = esp_timer_get_time() / 1000;
+            dlog_i(LOG_MODULE_WIFI, "Online %d ms after boot", connectStats.boot_to_online_ms);
+        }
+        if (currentWiFiState == WIFI_CONNECTING_CLIENT) {
+            setWiFiState(WIFI_CONNECTED_CLIENT);
+        }
+        // An access point joined after startWiFiClient() returned (roaming, rescan) is learned here;
+        // during a credentials job the station is on the job's network, not the saved one
+        if (!clientConnectPending && !isWiFiJobActive()) {
+            rememberStation();
+        }
+    }
 }
 
 /**
@@ -641,59 +558,174 @@ void setupOTA() {
  * Attempts client connection first, falls back to AP mode
  */
 bool initializeWiFi() {
+    WiFi.onEvent(onWiFiStateEvent, ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+    WiFi.onEvent(onWiFiStateEvent, ARDUINO_EVENT_WIFI_STA_GOT_IP);
+
     // Check if client mode is enabled and credentials exist
     if (config.wifi_client_enabled && strlen(config.wifi_ssid) > 0) {
         log_i("Attempting WiFi client connection to: %s", config.wifi_ssid);
-        currentWiFiState = WIFI_CONNECTING_CLIENT;
+        setWiFiState(WIFI_CONNECTING_CLIENT);
         
         if (startWiFiClient()) {
-            currentWiFiState = WIFI_CONNECTED_CLIENT;
+            setWiFiState(WIFI_CONNECTED_CLIENT);
             log_i("WiFi client connected successfully");
             return true;
         } else {
-            currentWiFiState = WIFI_CONNECTION_FAILED;
+            setWiFiState(WIFI_CONNECTION_FAILED);
             log_w("WiFi client connection failed, falling back to AP mode");
         }
     }
     
     // Fall back to AP mode
     log_i("Starting WiFi in AP mode");
-    currentWiFiState = WIFI_CONNECTING_AP;
+    setWiFiState(WIFI_CONNECTING_AP);
     
     if (startWiFiAP()) {
-        currentWiFiState = WIFI_CONNECTED_AP;
+        setWiFiState(WIFI_CONNECTED_AP);
         log_i("WiFi AP started successfully");
         return true;
     } else {
-        currentWiFiState = WIFI_CONNECTION_FAILED;
+        setWiFiState(WIFI_CONNECTION_FAILED);
         log_e("Failed to start WiFi AP");
         return false;
     }
 }
 
+/**
+ * Parse a dotted quad setting; empty or malformed strings fail
+ */
+static bool parseAddress(const char* text, IPAddress& address) {
+    return text[0] != '\0' && address.fromString(text);
+}
+
+/**
+ * Pick the station address: the configured static IP, otherwise DHCP
+ */
+static void configureStationAddress() {
+    IPAddress ip, gateway, subnet, dns;
+
+    if (config.wifi_static_ip[0] != '\0') {
+        if (parseAddress(config.wifi_static_ip, ip) && parseAddress(config.wifi_static_gateway, gateway)) {
+            if (!parseAddress(config.wifi_static_subnet, subnet)) {
+                subnet = IPAddress(255, 255, 255, 0);
+            }
+            if (!parseAddress(config.wifi_static_dns, dns)) {
+                dns = gateway;
+            }
+            WiFi.config(ip, gateway, subnet, dns);
+            return;
+        }
+        log_w("Invalid static IP settings, using DHCP");
+    }
+
+    WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);
+}
+
+/**
+ * Start joining the configured network without waiting
+ * With useCache, associate straight to the cached BSSID/channel (no scan)
+ */
+void beginWiFiClient(bool useCache) {
+    configureStationAddress();
+
+    if (useCache && config.wifi_channel) {
+        stationLocked = true;
+        WiFi.begin(config.wifi_ssid, config.wifi_password, config.wifi_channel, config.wifi_bssid);
+    } else {
+        stationLocked = false;
+        WiFi.begin(config.wifi_ssid, config.wifi_password);
+    }
+}
+
+/**
+ * Drop the static/cached station setup before joining some other network (credential jobs)
+ */
+void resetWiFiClientConfig() {
+    stationLocked = false;
+    WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);
+}
+
+/**
+ * Remember the access point that worked so the next connection can skip the scan
+ */
+static void rememberStation() {
+    bool changed = false;
+
+    const uint8_t* bssid = WiFi.BSSID();
+    uint8_t channel = WiFi.channel();
+    if (bssid && channel && (channel != config.wifi_channel || memcmp(bssid, config.wifi_bssid, sizeof(config.wifi_bssid)) != 0)) {
+        memcpy(config.wifi_bssid, bssid, sizeof(config.wifi_bssid));
+        config.wifi_channel = channel;
+        changed = true;
+    }
+
+    // Only write flash when the network actually changed
+    if (changed) {
+        requestConfigSave();
+    }
+}
+
+/**
+ * Wait for the station to come up; a cached attempt also gives up as soon as its AP is reported missing
+ */
+static bool waitForConnection(uint32_t timeout_ms, bool cached) {
+    unsigned long startTime = millis();
+
+    while (WiFi.status() != WL_CONNECTED && (millis() - startTime) < timeout_ms) {
+        if (cached && !stationLocked) {
+            break;
+        }
+        delay(WIFI_CONNECT_POLL_MS);
+    }
+    return WiFi.status() == WL_CONNECTED;
+}
+
 /**
  * Start WiFi in client mode
+ * Tries the cached access point first, then falls back to a full scan
  */
 bool startWiFiClient() {
+    int64_t start_us = esp_timer_get_time();
+    clientConnectPending = true;
     WiFi.mode(WIFI_STA);
-    WiFi.begin(config.wifi_ssid, config.wifi_password);
-    
-    // Wait for connection with timeout
-    unsigned long startTime = millis();
-    unsigned long timeout = config.wifi_connection_timeout * 1000; // Convert to milliseconds
-    
-    while (WiFi.status() != WL_CONNECTED && (millis() - startTime) < timeout) {
-        delay(500);
-        log_d("Connecting to WiFi...");
+
+    bool connected = false;
+    bool usedCache = false;
+
+    if (config.wifi_channel) {
+        connectStats.cached_attempts++;
+        beginWiFiClient(true);
+        connected = waitForConnection(WIFI_FAST_CONNECT_TIMEOUT_MS, true);
+        usedCache = connected;
+        if (!connected) {
+            connectStats.cached_failures++;
+            log_w("Cached WiFi connection failed, scanning");
+            WiFi.disconnect();
+        }
+    }
+
+    if (!connected) {
+        beginWiFiClient(false);
+        connected = waitForConnection(config.wifi_connection_timeout * 1000, false);
     }
+
+    connectStats.last_connect_ms = (esp_timer_get_time() - start_us) / 1000;
+    connectStats.last_used_cache = usedCache;
+    clientConnectPending = false;
     
-    if (WiFi.status() == WL_CONNECTED) {
-        log_i("WiFi client connected to: %s", config.wifi_ssid);
+    if (connected) {
+        log_i("WiFi client connected to: %s in %u ms%s", config.wifi_ssid, connectStats.last_connect_ms,
+              usedCache ? " (cached)" : "");
         log_i("IP address: %s", WiFi.localIP().toString().c_str());
         
+        rememberStation();
+        
         // Start mDNS
         startMDNS();
         
+        // Keep the clock set for move history timestamps (SNTP runs in the background)
+        configTime(0, 0, WIFI_NTP_SERVER);
+        
         return true;
     } else {
         log_e("WiFi client connection failed");
@@ -702,43 +734,11 @@ bool startWiFiClient() {
     }
 }
 
-
-/**
- * Test WiFi connection with given credentials
- */
-bool testWiFiConnection(const char* ssid, const char* password) {
-    log_i("Testing WiFi connection to: %s", ssid);
-    
-    // Save current mode
-    WiFiMode_t currentMode = WiFi.getMode();
-    
-    // Switch to STA mode for testing
-    WiFi.mode(WIFI_AP_STA);
-    WiFi.begin(ssid, password);
-    
-    // Wait for connection with shorter timeout for testing
-    unsigned long startTime = millis();
-    unsigned long timeout = config.wifi_connection_timeout * 1000; 
-    
-    while (WiFi.status() != WL_CONNECTED && (millis() - startTime) < timeout) {
-        delay(500);
-    }
-    
-    bool connected = (WiFi.status() == WL_CONNECTED);
-    
-    if (connected) {
-        log_i("WiFi test connection successful");
-        WiFi.disconnect();
-    } else {
-        log_w("WiFi test connection failed");
-    }
-    
-    // Restore previous mode
-    WiFi.mode(currentMode);
-    
-    return connected;
+void getWiFiConnectStats(WiFiConnectStats& stats) {
+    stats = connectStats;
 }
 
+
 /**
  * Switch to AP mode
  */
@@ -748,11 +748,10 @@ void switchToAPMode() {
     delay(100);
     
     if (startWiFiAP()) {
-        currentWiFiState = WIFI_CONNECTED_AP;
-        setupCaptivePortal();
+        setWiFiState(WIFI_CONNECTED_AP);
         log_i("Switched to AP mode successfully");
     } else {
-        currentWiFiState = WIFI_CONNECTION_FAILED;
+        setWiFiState(WIFI_CONNECTION_FAILED);
         log_e("Failed to switch to AP mode");
     }
 }
@@ -764,10 +763,10 @@ void switchToClientMode() {
     log_i("Switching to client mode");
     
     if (startWiFiClient()) {
-        currentWiFiState = WIFI_CONNECTED_CLIENT;
+        setWiFiState(WIFI_CONNECTED_CLIENT);
         log_i("Switched to client mode successfully");
     } else {
-        currentWiFiState = WIFI_CONNECTION_FAILED;
+        setWiFiState(WIFI_CONNECTION_FAILED);
         log_e("Failed to switch to client mode");
         // Fall back to AP mode
         switchToAPMode();
@@ -797,6 +796,16 @@ WiFiState getWiFiState() {
     return currentWiFiState;
 }
 
+/**
+ * Record a WiFi state change; the LED follows it from the event dispatcher
+ */
+void setWiFiState(WiFiState state) {
+    if (state != currentWiFiState) {
+        currentWiFiState = state;
+        postEvent(EVENT_WIFI_STATE_CHANGED, state);
+    }
+}
+
 /**
  * Get WiFi status string for display
  */
@@ -6,17 +6,12 @@
 #include <ESPAsyncWebServer.h>
 #include <AsyncJson.h>
 #include <ArduinoJson.h>
-#include <DNSServer.h>
 #include <SPIFFS.h>
-#include <Update.h>
 #include "config.h"
 #include "rotator.h"
 #include "neopixel.h"
 #include "main.h"
 
-// Constants
-const int DNS_PORT = 53;
-
 // WARNING: Performance Consideration
 // --------------------------------
 // When serving static files, avoid serving the entire SPIFFS filesystem at the root path ("/").
@@ -32,6 +27,11 @@ const int DNS_PORT = 53;
 // 4. "coalescing polls" and "throttling" warnings in AsyncTCP
 // 5. Overall reduced web server performance
 
+// Station connection timing
+#define WIFI_FAST_CONNECT_TIMEOUT_MS 3000   // Budget for the cached BSSID/channel attempt before a full scan
+#define WIFI_CONNECT_POLL_MS 20             // Connection status poll while startWiFiClient waits
+#define WIFI_NTP_SERVER "pool.ntp.org"      // Wall-clock time for the move history (station mode only)
+
 // Enums and types
 enum WiFiMode {
     AP_MODE,
@@ -47,36 +47,39 @@ enum WiFiState {
     WIFI_CONNECTION_FAILED
 };
 
+// Station connection timing for /api/wifi/status and /metrics
+struct WiFiConnectStats {
+    int32_t boot_to_online_ms;          // First station IP after boot; -1 until then
+    uint32_t last_connect_ms;           // Duration of the last startWiFiClient()
+    bool last_used_cache;               // Last startWiFiClient() connected on the cached attempt
+    uint32_t cached_attempts;
+    uint32_t cached_failures;           // Cached attempts that fell back to a full scan
+};
+
 // Function declarations
 bool startWiFiAP();
 void setupCaptivePortal();
-void handleDNS();
 void setupWebServer();
-void setupWebSockets();
-void setupOTA();
 void handleWiFiEvents();
-void sendDebugData();
-void onDebugWebSocketEvent(AsyncWebSocket *server, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len);
 
 // WiFi management functions
 bool initializeWiFi();
 bool startWiFiClient();
-bool testWiFiConnection(const char* ssid, const char* password);
+void beginWiFiClient(bool useCache);
+void resetWiFiClientConfig();
+void getWiFiConnectStats(WiFiConnectStats& stats);
 void switchToAPMode();
 void switchToClientMode();
 void startMDNS();
 WiFiState getWiFiState();
+void setWiFiState(WiFiState state);
 String getWiFiStatus();
 
 // External declarations
 extern AsyncWebServer webServer;
-extern AsyncWebSocket debugWebSocket;
-extern DNSServer dnsServer;
-extern bool otaInProgress;
-extern bool debugStreamActive;
 extern WiFiState currentWiFiState;
 
 // External function declarations from rotator.h and config.h
 extern int positionToAngle(int64_t position);
-extern void rotateToAngle(int angle);
+extern bool rotateToAngle(int angle);
 extern int64_t get_current_position();
\ No newline at end of file
@@ -0,0 +1,212 @@
+#!/usr/bin/env python3
+"""
+HTTP API load benchmark for the rotator firmware
+
+Hammers the /api handlers of a running device and reports, per endpoint:
+  - requests/s and latency percentiles
+  - allocations per request (needs the esp32dev_bench build, which counts
+    every malloc/calloc/realloc)
+  - internal heap free and high-water mark (minimum free) before and after
+
+Results can be saved and compared against a previous run, e.g. before and
+after a firmware change:
+
+    python3 tools/api_bench.py --host 192.168.4.1 --save before.json
+    python3 tools/api_bench.py --host 192.168.4.1 --compare before.json
+
+Only the Python standard library is used.
+"""
+
+import argparse
+import http.client
+import json
+import statistics
+import sys
+import threading
+import time
+
+DEFAULT_ENDPOINTS = [
+    '/api/status',
+    '/api/config',
+    '/api/buildinfo',
+    '/api/wifi/status',
+]
+
+DIAGNOSTICS_PATH = '/api/diagnostics/heap'
+
+def http_get(host, port, path, timeout):
+    """Issue one GET on a fresh connection (the server closes after each response)"""
+    conn = http.client.HTTPConnection(host, port, timeout=timeout)
+    try:
+        conn.request('GET', path)
+        response = conn.getresponse()
+        body = response.read()
+        return response.status, body
+    finally:
+        conn.close()
+
+def read_diagnostics(host, port, timeout):
+    status, body = http_get(host, port, DIAGNOSTICS_PATH, timeout)
+    if status != 200:
+        return None
+    return json.loads(body)
+
+def diagnostics_overhead(host, port, timeout, samples=5):
+    """Allocations caused by the diagnostics request itself"""
+    counts = []
+    previous = read_diagnostics(host, port, timeout)
+    if previous is None or not previous.get('allocationTracking'):
+        return 0
+    for _ in range(samples):
+        current = read_diagnostics(host, port, timeout)
+        counts.append(current['allocations'] - previous['allocations'])
+        previous = current
+    return min(counts)
+
+def run_load(host, port, path, total, concurrency, timeout):
+    """Run `total` GETs across `concurrency` worker threads"""
+    latencies = []
+    errors = [0]
+    lock = threading.Lock()
+    remaining = [total]
+
+    def worker():
+        while True:
+            with lock:
+                if remaining[0] <= 0:
+                    return
+                remaining[0] -= 1
+            start = time.perf_counter()
+            try:
+                status, _ = http_get(host, port, path, timeout)
+                ok = 200 <= status < 300
+            except (OSError, http.client.HTTPException):
+                ok = False
+            elapsed = time.perf_counter() - start
+            with lock:
+                if ok:
+                    latencies.append(elapsed)
+                else:
+                    errors[0] += 1
+
+    threads = [threading.Thread(target=worker) for _ in range(concurrency)]
+    start = time.perf_counter()
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    duration = time.perf_counter() - start
+
+    return latencies, errors[0], duration
+
+def percentile(values, fraction):
+    if not values:
+        return 0.0
+    ordered = sorted(values)
+    index = min(len(ordered) - 1, int(round(fraction * (len(ordered) - 1))))
+    return ordered[index]
+
+def bench_endpoint(args, path, overhead):
+    before = read_diagnostics(args.host, args.port, args.timeout)
+    latencies, errors, duration = run_load(args.host, args.port, path,
+                                           args.requests, args.concurrency, args.timeout)
+    after = read_diagnostics(args.host, args.port, args.timeout)
+
+    result = {
+        'endpoint': path,
+        'requests': args.requests,
+        'concurrency': args.concurrency,
+        'errors': errors,
+        'requests_per_s': len(latencies) / duration if duration > 0 else 0.0,
+        'latency_ms_p50': percentile(latencies, 0.50) * 1000,
+        'latency_ms_p95': percentile(latencies, 0.95) * 1000,
+        'latency_ms_mean': (statistics.mean(latencies) * 1000) if latencies else 0.0,
+    }
+
+    if before and after:
+        result['free_heap_before'] = before['freeHeap']
+        result['free_heap_after'] = after['freeHeap']
+        result['min_free_heap_before'] = before['minFreeHeap']
+        result['min_free_heap_after'] = after['minFreeHeap']
+        if before.get('allocationTracking'):
+            allocations = after['allocations'] - before['allocations'] - overhead
+            result['allocs_per_request'] = allocations / max(1, len(latencies) + errors)
+
+    return result
+
+def print_results(results, baseline=None):
+    baseline_by_path = {r['endpoint']: r for r in (baseline or [])}
+
+    header = f"{'endpoint':<22} {'req/s':>8} {'p50 ms':>8} {'p95 ms':>8} {'allocs/req':>11} {'minFree before':>15} {'minFree after':>14}"
+    print(header)
+    print('-' * len(header))
+    for r in results:
+        allocs = r.get('allocs_per_request')
+        allocs_text = f"{allocs:11.1f}" if allocs is not None else f"{'n/a':>11}"
+        print(f"{r['endpoint']:<22} {r['requests_per_s']:8.1f} {r['latency_ms_p50']:8.1f} "
+              f"{r['latency_ms_p95']:8.1f} {allocs_text} "
+              f"{r.get('min_free_heap_before', 0):15d} {r.get('min_free_heap_after', 0):14d}")
+        if r['errors']:
+            print(f"{'':<22} {r['errors']} failed requests")
+
+        base = baseline_by_path.get(r['endpoint'])
+        if base:
+            delta_rps = r['requests_per_s'] - base['requests_per_s']
+            line = f"{'  vs baseline':<22} {delta_rps:+8.1f} req/s"
+            if 'allocs_per_request' in r and 'allocs_per_request' in base:
+                line += f", {r['allocs_per_request'] - base['allocs_per_request']:+.1f} allocs/req"
+            if 'min_free_heap_after' in r and 'min_free_heap_after' in base:
+                line += f", {r['min_free_heap_after'] - base['min_free_heap_after']:+d} B min free heap"
+            print(line)
+
+def main():
+    parser = argparse.ArgumentParser(description='Load benchmark for the rotator HTTP API')
+    parser.add_argument('--host', default='192.168.4.1', help='Device address (default: AP mode IP)')
+    parser.add_argument('--port', type=int, default=80)
+    parser.add_argument('--requests', type=int, default=200, help='Requests per endpoint')
+    parser.add_argument('--concurrency', type=int, default=4, help='Parallel connections')
+    parser.add_argument('--timeout', type=float, default=5.0, help='Per-request timeout in seconds')
+    parser.add_argument('--endpoint', action='append', help='Endpoint to test (repeatable)')
+    parser.add_argument('--save', help='Write results as JSON to this file')
+    parser.add_argument('--compare', help='Baseline JSON from a previous --save run')
+    args = parser.parse_args()
+
+    endpoints = args.endpoint or DEFAULT_ENDPOINTS
+
+    try:
+        diagnostics = read_diagnostics(args.host, args.port, args.timeout)
+    except OSError as e:
+        print(f"Cannot reach {args.host}:{args.port}: {e}")
+        return 1
+
+    if diagnostics is None:
+        print(f"{DIAGNOSTICS_PATH} not available; reporting throughput only")
+        overhead = 0
+    elif not diagnostics.get('allocationTracking'):
+        print("Allocation tracking is off; flash the esp32dev_bench environment to count allocations")
+        overhead = 0
+    else:
+        overhead = diagnostics_overhead(args.host, args.port, args.timeout)
+
+    results = []
+    for path in endpoints:
+        print(f"Benchmarking {path} ({args.requests} requests, concurrency {args.concurrency})...")
+        results.append(bench_endpoint(args, path, overhead))
+
+    baseline = None
+    if args.compare:
+        with open(args.compare) as f:
+            baseline = json.load(f)['results']
+
+    print()
+    print_results(results, baseline)
+
+    if args.save:
+        with open(args.save, 'w') as f:
+            json.dump({'host': args.host, 'timestamp': time.time(), 'results': results}, f, indent=2)
+        print(f"\nSaved results to {args.save}")
+
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,320 @@
+/*
+ * Host benchmark for the configuration field table (src/config_schema.cpp)
+ *
+ * Times the table-driven JSON paths against the hand-written code they replaced,
+ * which is reproduced below as legacy*():
+ *
+ *   read     legacy /config.json import: parse, then copy every field
+ *   write    /api/config serialization
+ *   apply    /api/settings carrying every settable key
+ *   record   binary NVS record load (memcpy + sanitizeConfig), for reference
+ *
+ * It also lists fields where the two read paths disagree (the hand-written
+ * import never read auto_rotate_forward).
+ *
+ * tools/config_bench.sh builds and runs it and sums the code size per path.
+ * By hand (ArduinoJson is header-only; use the copy PlatformIO downloads):
+ *
+ *   cd firmware
+ *   g++ -std=gnu++11 -O2 -Isrc -I.pio/libdeps/esp32dev/ArduinoJson/src \
+ *       tools/config_bench.cpp src/config_schema.cpp -o /tmp/config_bench
+ *   /tmp/config_bench 20000
+ *
+ * Code size per path (host x86-64, so compare the ratio rather than bytes):
+ *
+ *   nm -C -S --size-sort /tmp/config_bench | grep -E 'legacy|ConfigJson|SettingsJson|Setting|storeField|writeField|sanitize'
+ */
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "config_schema.h"
+
+#define BENCH_JSON_SIZE 4096
+
+static size_t legacyCopy(char* dest, const char* src, size_t size) {
+    size_t length = strlen(src);
+    size_t copied = length < size - 1 ? length : size - 1;
+    memcpy(dest, src, copied);
+    dest[copied] = '\0';
+    return length;
+}
+
+// ---------------------------------------------------------------------------
+// The hand-written versions, as they were before the field table
+
+#define LEGACY_READ_STRING(field, def) legacyCopy(target.field, doc[#field] | def, sizeof(target.field))
+#define LEGACY_READ_VALUE(field, def) target.field = doc[#field] | def
+
+__attribute__((noinline)) static void legacyReadConfigJson(JsonObjectConst doc, RotatorConfig& target) {
+    LEGACY_READ_STRING(ap_ssid, DEFAULT_AP_SSID);
+    LEGACY_READ_STRING(ap_password, DEFAULT_AP_PASSWORD);
+    LEGACY_READ_STRING(wifi_ssid, DEFAULT_WIFI_SSID);
+    LEGACY_READ_STRING(wifi_password, DEFAULT_WIFI_PASSWORD);
+    LEGACY_READ_VALUE(wifi_client_enabled, DEFAULT_WIFI_CLIENT_ENABLED);
+    LEGACY_READ_VALUE(wifi_connection_timeout, DEFAULT_WIFI_CONNECTION_TIMEOUT);
+
+    const char* saved_mdns = doc["mdns_name"];
+    if (saved_mdns && strlen(saved_mdns) > 0) {
+        legacyCopy(target.mdns_name, saved_mdns, sizeof(target.mdns_name));
+    }
+
+    LEGACY_READ_STRING(wifi_static_ip, DEFAULT_WIFI_STATIC_IP);
+    LEGACY_READ_STRING(wifi_static_gateway, "");
+    LEGACY_READ_STRING(wifi_static_subnet, "");
+    LEGACY_READ_STRING(wifi_static_dns, "");
+
+    memset(target.wifi_bssid, 0, sizeof(target.wifi_bssid));
+    target.wifi_channel = 0;
+    const char* bssid = doc["wifi_bssid"];
+    uint8_t channel = doc["wifi_channel"] | 0;
+    if (bssid && channel && sscanf(bssid, "%hhx:%hhx:%hhx:%hhx:%hhx:%hhx",
+                                   &target.wifi_bssid[0], &target.wifi_bssid[1], &target.wifi_bssid[2],
+                                   &target.wifi_bssid[3], &target.wifi_bssid[4], &target.wifi_bssid[5]) == 6) {
+        target.wifi_channel = channel;
+    }
+
+    LEGACY_READ_STRING(fleet_groups, DEFAULT_FLEET_GROUPS);
+    LEGACY_READ_STRING(control_key, DEFAULT_CONTROL_KEY);
+
+    LEGACY_READ_VALUE(pos_0_degrees, POS_0_DEGREES);
+    LEGACY_READ_VALUE(pos_90_degrees, POS_90_DEGREES);
+    LEGACY_READ_VALUE(pos_180_degrees, POS_180_DEGREES);
+    LEGACY_READ_VALUE(pos_270_degrees, POS_270_DEGREES);
+    LEGACY_READ_VALUE(full_rotation_count, FULL_ROTATION_COUNT);
+    LEGACY_READ_VALUE(color_0, DEFAULT_COLOR_0);
+    LEGACY_READ_VALUE(color_90, DEFAULT_COLOR_90);
+    LEGACY_READ_VALUE(color_180, DEFAULT_COLOR_180);
+    LEGACY_READ_VALUE(color_270, DEFAULT_COLOR_270);
+    LEGACY_READ_VALUE(rotation_interval, DEFAULT_ROTATION_INTERVAL);
+    LEGACY_READ_VALUE(auto_rotation_enabled, false);
+    LEGACY_READ_VALUE(position_hysteresis, DEFAULT_POSITION_HYSTERESIS);
+    LEGACY_READ_VALUE(max_speed, DEFAULT_MAX_SPEED);
+    LEGACY_READ_VALUE(acceleration, DEFAULT_ACCELERATION);
+    LEGACY_READ_VALUE(vel_loop_p, DEFAULT_VEL_LOOP_P);
+    LEGACY_READ_VALUE(vel_loop_i, DEFAULT_VEL_LOOP_I);
+    LEGACY_READ_VALUE(vel_loop_d, DEFAULT_VEL_LOOP_D);
+    LEGACY_READ_VALUE(vel_filter_persistence, DEFAULT_VEL_FILTER_PERSISTENCE);
+    LEGACY_READ_VALUE(spd_err_persistence, DEFAULT_SPD_ERR_PERSISTENCE);
+}
+
+#define LEGACY_WRITE(field) json[#field] = source.field
+
+__attribute__((noinline)) static void legacyWriteSettingsJson(JsonObject json, const RotatorConfig& source) {
+    LEGACY_WRITE(ap_ssid);
+    LEGACY_WRITE(ap_password);
+    LEGACY_WRITE(mdns_name);
+    LEGACY_WRITE(wifi_static_ip);
+    LEGACY_WRITE(wifi_static_gateway);
+    LEGACY_WRITE(wifi_static_subnet);
+    LEGACY_WRITE(wifi_static_dns);
+    LEGACY_WRITE(fleet_groups);
+    LEGACY_WRITE(pos_0_degrees);
+    LEGACY_WRITE(pos_90_degrees);
+    LEGACY_WRITE(pos_180_degrees);
+    LEGACY_WRITE(pos_270_degrees);
+    LEGACY_WRITE(full_rotation_count);
+    LEGACY_WRITE(color_0);
+    LEGACY_WRITE(color_90);
+    LEGACY_WRITE(color_180);
+    LEGACY_WRITE(color_270);
+    LEGACY_WRITE(rotation_interval);
+    LEGACY_WRITE(auto_rotation_enabled);
+    LEGACY_WRITE(auto_rotate_forward);
+    LEGACY_WRITE(position_hysteresis);
+    LEGACY_WRITE(max_speed);
+    LEGACY_WRITE(acceleration);
+    LEGACY_WRITE(vel_loop_p);
+    LEGACY_WRITE(vel_loop_i);
+    LEGACY_WRITE(vel_loop_d);
+    LEGACY_WRITE(vel_filter_persistence);
+    LEGACY_WRITE(spd_err_persistence);
+}
+
+#define LEGACY_APPLY_STRING(field) \
+    if (json[#field].is<const char*>()) { legacyCopy(target.field, json[#field], sizeof(target.field)); }
+#define LEGACY_APPLY_VALUE(field) \
+    if (json.containsKey(#field)) { target.field = json[#field]; }
+
+__attribute__((noinline)) static void legacyApplySettingsJson(JsonObject json, RotatorConfig& target) {
+    LEGACY_APPLY_STRING(ap_ssid);
+    LEGACY_APPLY_STRING(ap_password);
+    LEGACY_APPLY_STRING(mdns_name);
+    LEGACY_APPLY_STRING(wifi_static_ip);
+    LEGACY_APPLY_STRING(wifi_static_gateway);
+    LEGACY_APPLY_STRING(wifi_static_subnet);
+    LEGACY_APPLY_STRING(wifi_static_dns);
+    LEGACY_APPLY_STRING(fleet_groups);
+    LEGACY_APPLY_STRING(control_key);
+    LEGACY_APPLY_VALUE(pos_0_degrees);
+    LEGACY_APPLY_VALUE(pos_90_degrees);
+    LEGACY_APPLY_VALUE(pos_180_degrees);
+    LEGACY_APPLY_VALUE(pos_270_degrees);
+    LEGACY_APPLY_VALUE(full_rotation_count);
+    LEGACY_APPLY_VALUE(color_0);
+    LEGACY_APPLY_VALUE(color_90);
+    LEGACY_APPLY_VALUE(color_180);
+    LEGACY_APPLY_VALUE(color_270);
+    LEGACY_APPLY_VALUE(rotation_interval);
+    LEGACY_APPLY_VALUE(auto_rotation_enabled);
+    LEGACY_APPLY_VALUE(auto_rotate_forward);
+    LEGACY_APPLY_VALUE(position_hysteresis);
+    LEGACY_APPLY_VALUE(max_speed);
+    LEGACY_APPLY_VALUE(acceleration);
+    LEGACY_APPLY_VALUE(vel_loop_p);
+    LEGACY_APPLY_VALUE(vel_loop_i);
+    LEGACY_APPLY_VALUE(vel_loop_d);
+    LEGACY_APPLY_VALUE(vel_filter_persistence);
+    LEGACY_APPLY_VALUE(spd_err_persistence);
+}
+
+// ---------------------------------------------------------------------------
+
+// Keeps the optimizer from discarding benchmarked work
+static volatile uint32_t sink;
+
+template <typename Body>
+static double nsPerOp(int iterations, Body body) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        body();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+}
+
+static void report(const char* path, double legacy_ns, double table_ns) {
+    printf("%-8s %12.0f %12.0f %8.2fx\n", path, legacy_ns, table_ns, table_ns / legacy_ns);
+}
+
+/**
+ * A configuration with every field away from its default
+ */
+static void makeSample(RotatorConfig& sample) {
+    applyConfigDefaults(sample);
+    strcpy(sample.ap_ssid, "BenchAP");
+    strcpy(sample.wifi_ssid, "bench-network");
+    strcpy(sample.wifi_password, "bench-password");
+    strcpy(sample.mdns_name, "rotator-bench");
+    strcpy(sample.wifi_static_ip, "192.168.1.50");
+    strcpy(sample.wifi_static_gateway, "192.168.1.1");
+    strcpy(sample.fleet_groups, "lobby,north");
+    const uint8_t bssid[6] = { 0x24, 0x0a, 0xc4, 0x12, 0x34, 0x56 };
+    memcpy(sample.wifi_bssid, bssid, sizeof(bssid));
+    sample.wifi_channel = 6;
+    sample.pos_90_degrees = 7400;
+    sample.color_0 = 0x123456;
+    sample.rotation_interval = 120;
+    sample.auto_rotation_enabled = true;
+    sample.auto_rotate_forward = false;
+    sample.max_speed = 5000.0f;
+    sample.vel_loop_p = 3e-4f;
+}
+
+/**
+ * Print the fields where two configurations differ
+ */
+static void compareConfigs(const RotatorConfig& a, const RotatorConfig& b) {
+    int differences = 0;
+    for (size_t i = 0; i < configFieldCount; i++) {
+        const ConfigField& field = configFields[i];
+        if (memcmp((const uint8_t*)&a + field.offset, (const uint8_t*)&b + field.offset, field.size) != 0) {
+            printf("  %s differs between the legacy and table imports\n", field.name);
+            differences++;
+        }
+    }
+    if (!differences) {
+        printf("  legacy and table imports agree on every field\n");
+    }
+}
+
+int main(int argc, char** argv) {
+    int iterations = argc > 1 ? atoi(argv[1]) : 20000;
+
+    RotatorConfig sample;
+    makeSample(sample);
+
+    // The legacy file format held every field
+    static char legacyFile[BENCH_JSON_SIZE];
+    {
+        DynamicJsonDocument doc(BENCH_JSON_SIZE);
+        writeConfigJson(doc.to<JsonObject>(), sample, 0);
+        serializeJson(doc, legacyFile, sizeof(legacyFile));
+    }
+
+    // Every settable key, as /api/settings would receive them
+    static char settingsBody[BENCH_JSON_SIZE];
+    {
+        DynamicJsonDocument doc(BENCH_JSON_SIZE);
+        writeConfigJson(doc.to<JsonObject>(), sample, CONFIG_FIELD_SETTABLE);
+        serializeJson(doc, settingsBody, sizeof(settingsBody));
+    }
+
+    printf("%zu fields, RotatorConfig %zu bytes, %d iterations\n\n", configFieldCount, sizeof(RotatorConfig), iterations);
+    printf("Import check:\n");
+    {
+        DynamicJsonDocument doc(BENCH_JSON_SIZE);
+        deserializeJson(doc, (const char*)legacyFile);
+        RotatorConfig legacy, table;
+        applyConfigDefaults(legacy);
+        applyConfigDefaults(table);
+        legacyReadConfigJson(doc.as<JsonObjectConst>(), legacy);
+        readConfigJson(doc.as<JsonObjectConst>(), table);
+        compareConfigs(legacy, table);
+    }
+
+    printf("\n%-8s %12s %12s %9s\n", "path", "legacy ns", "table ns", "ratio");
+
+    DynamicJsonDocument doc(BENCH_JSON_SIZE);
+    RotatorConfig target;
+    applyConfigDefaults(target);
+
+    double legacy_ns = nsPerOp(iterations, [&]() {
+        deserializeJson(doc, (const char*)legacyFile);
+        legacyReadConfigJson(doc.as<JsonObjectConst>(), target);
+        sink += target.color_0;
+    });
+    double table_ns = nsPerOp(iterations, [&]() {
+        deserializeJson(doc, (const char*)legacyFile);
+        readConfigJson(doc.as<JsonObjectConst>(), target);
+        sink += target.color_0;
+    });
+    report("read", legacy_ns, table_ns);
+
+    static char output[BENCH_JSON_SIZE];
+    legacy_ns = nsPerOp(iterations, [&]() {
+        doc.clear();
+        legacyWriteSettingsJson(doc.to<JsonObject>(), sample);
+        sink += serializeJson(doc, output, sizeof(output));
+    });
+    table_ns = nsPerOp(iterations, [&]() {
+        doc.clear();
+        writeSettingsJson(doc.to<JsonObject>(), sample);
+        sink += serializeJson(doc, output, sizeof(output));
+    });
+    report("write", legacy_ns, table_ns);
+
+    legacy_ns = nsPerOp(iterations, [&]() {
+        deserializeJson(doc, (const char*)settingsBody);
+        legacyApplySettingsJson(doc.as<JsonObject>(), target);
+        sink += target.color_0;
+    });
+    table_ns = nsPerOp(iterations, [&]() {
+        deserializeJson(doc, (const char*)settingsBody);
+        if (!findInvalidSetting(doc.as<JsonObjectConst>())) {
+            applySettingsJson(doc.as<JsonObject>(), target);
+        }
+        sink += target.color_0;
+    });
+    report("apply", legacy_ns, table_ns);
+
+    // What boot does now: no JSON at all
+    table_ns = nsPerOp(iterations, [&]() {
+        memcpy(&target, &sample, sizeof(target));
+        sink += sanitizeConfig(target);
+    });
+    printf("%-8s %12s %12.0f\n", "record", "-", table_ns);
+
+    return 0;
+}
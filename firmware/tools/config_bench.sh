@@ -0,0 +1,41 @@
+#!/bin/sh
+# Build and run tools/config_bench.cpp on the host, then compare code size
+#
+#   cd firmware
+#   tools/config_bench.sh [iterations]
+#
+# ArduinoJson is header-only. The copy PlatformIO downloads is used when present
+# (run `pio pkg install` once), otherwise set ARDUINOJSON_SRC to its src directory.
+# Prints the timing table, then the bytes of host code behind each path
+# (x86-64, so compare the ratio rather than the bytes).
+
+set -e
+
+cd "$(dirname "$0")/.."
+ARDUINOJSON_SRC=${ARDUINOJSON_SRC:-.pio/libdeps/esp32dev/ArduinoJson/src}
+if [ ! -f "$ARDUINOJSON_SRC/ArduinoJson.h" ]; then
+    echo "ArduinoJson not found in $ARDUINOJSON_SRC; run 'pio pkg install' or set ARDUINOJSON_SRC" >&2
+    exit 1
+fi
+
+BIN=${TMPDIR:-/tmp}/config_bench
+g++ -std=gnu++11 -O2 -Isrc -I"$ARDUINOJSON_SRC" tools/config_bench.cpp src/config_schema.cpp -o "$BIN"
+"$BIN" "${1:-20000}"
+
+echo
+echo "Code size (host bytes):"
+nm -C -S -t d --size-sort "$BIN" | awk '
+    $3 ~ /^[tTwW]$/ {
+        size = $2 + 0
+        name = $0
+        sub(/^[^ ]+ [^ ]+ [^ ]+ /, "", name)
+        if (name ~ /legacy/) {
+            legacy += size
+        } else if (name ~ /ConfigJson|SettingsJson|Setting|storeField|writeField|sanitize/) {
+            table += size
+        }
+    }
+    END {
+        printf "  legacy %6d\n  table  %6d\n", legacy, table
+        if (legacy) printf "  ratio  %6.2f\n", table / legacy
+    }'
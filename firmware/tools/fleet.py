@@ -0,0 +1,313 @@
+#!/usr/bin/env python3
+"""
+Fleet control client and stand-in device for the rotator firmware
+
+Rotators listen on UDP multicast 239.255.42.1:42420 for small JSON requests and
+reply unicast to the sender:
+
+    {"type":"discover","seq":1,"group":"north"}
+        -> {"type":"announce","seq":1,"id":"a0b1c2d3e4f5","name":"rotator-E4F5",
+            "groups":"north","currentPosition":...,"currentAngle":90,"state":"idle",...}
+    {"type":"move","seq":2,"group":"north","angle":180,"delayMs":1500}
+        -> {"type":"ack","seq":2,"id":"a0b1c2d3e4f5","ok":true,"startsInMs":1497}
+
+A request addresses one unit with "id" (device id or mDNS name), a group with
+"group", or every unit when neither is given. A move starts delayMs after it is
+received. On a retry the client resends the same seq with delayMs recomputed to
+the same start time; units that already have it just ack again.
+
+    python3 tools/fleet.py discover
+    python3 tools/fleet.py move --group north --angle 180 --delay 1500
+    python3 tools/fleet.py groups --host 192.168.1.42 north,lobby
+
+Without hardware, run stand-in devices (on Linux, multicast over loopback):
+
+    python3 tools/fleet.py sim --count 5 --groups north --iface 127.0.0.1
+    python3 tools/fleet.py move --group north --angle 90 --iface 127.0.0.1
+
+Only the Python standard library is used.
+"""
+
+import argparse
+import json
+import random
+import socket
+import struct
+import sys
+import threading
+import time
+import urllib.request
+
+MULTICAST_ADDR = '239.255.42.1'
+PORT = 42420
+MAX_PACKET_SIZE = 384
+FULL_ROTATION_COUNT = 29555    # Encoder counts per turn (firmware default)
+
+def now_ms():
+    return time.monotonic() * 1000.0
+
+def make_client_socket(iface):
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM, socket.IPPROTO_UDP)
+    sock.setsockopt(socket.IPPROTO_IP, socket.IP_MULTICAST_TTL, 1)
+    sock.setsockopt(socket.IPPROTO_IP, socket.IP_MULTICAST_LOOP, 1)
+    if iface:
+        sock.setsockopt(socket.IPPROTO_IP, socket.IP_MULTICAST_IF, socket.inet_aton(iface))
+    sock.bind(('', 0))
+    return sock
+
+def send_request(sock, request):
+    sock.sendto(json.dumps(request, separators=(',', ':')).encode(), (MULTICAST_ADDR, PORT))
+
+def receive_replies(sock, seq, until_ms, reply_type):
+    """Yield (reply, address) for replies to seq until the deadline passes"""
+    while True:
+        remaining = until_ms - now_ms()
+        if remaining <= 0:
+            return
+        sock.settimeout(remaining / 1000.0)
+        try:
+            data, address = sock.recvfrom(MAX_PACKET_SIZE)
+        except socket.timeout:
+            return
+        try:
+            reply = json.loads(data)
+        except ValueError:
+            continue
+        if reply.get('type') == reply_type and reply.get('seq') == seq:
+            yield reply, address
+
+def add_target(request, args):
+    if args.id:
+        request['id'] = args.id
+    elif args.group:
+        request['group'] = args.group
+
+def discover(sock, args, attempts=3):
+    """Multicast a discovery request a few times and collect announcements by id"""
+    seq = random.randint(1, 0xFFFFFFFF)
+    request = {'type': 'discover', 'seq': seq}
+    add_target(request, args)
+
+    units = {}
+    interval = args.timeout * 1000.0 / attempts
+    for _ in range(attempts):
+        send_request(sock, request)
+        for reply, address in receive_replies(sock, seq, now_ms() + interval, 'announce'):
+            reply['address'] = address[0]
+            units[reply['id']] = reply
+    return units
+
+def cmd_discover(sock, args):
+    units = discover(sock, args)
+    if args.json:
+        print(json.dumps(sorted(units.values(), key=lambda u: u['id']), indent=2))
+        return 0
+
+    print(f"{'id':12s}  {'name':16s}  {'address':15s}  {'angle':>5s}  {'position':>9s}  {'state':9s}  groups")
+    for unit in sorted(units.values(), key=lambda u: u['id']):
+        print(f"{unit['id']:12s}  {unit.get('name', ''):16s}  {unit['address']:15s}  "
+              f"{unit.get('currentAngle', 0):5d}  {unit.get('currentPosition', 0):9d}  "
+              f"{unit.get('state', ''):9s}  {unit.get('groups', '')}")
+    print(f"{len(units)} unit(s)")
+    return 0
+
+def cmd_move(sock, args):
+    expected = set(discover(sock, args)) if not args.no_discover else set()
+    if not expected and not args.no_discover:
+        print("No units answered discovery", file=sys.stderr)
+        return 1
+
+    seq = random.randint(1, 0xFFFFFFFF)
+    sent_ms = now_ms()
+    start_ms = sent_ms + args.delay
+    acks = {}
+
+    # Resend until every discovered unit has acked; each resend carries the delay
+    # remaining to the same start time
+    deadline_ms = sent_ms + args.timeout * 1000.0
+    while now_ms() < deadline_ms:
+        request = {'type': 'move', 'seq': seq, 'angle': args.angle,
+                   'delayMs': max(0, int(start_ms - now_ms()))}
+        add_target(request, args)
+        send_request(sock, request)
+
+        until_ms = min(deadline_ms, now_ms() + args.retry_interval)
+        for reply, address in receive_replies(sock, seq, until_ms, 'ack'):
+            if reply['id'] not in acks:
+                reply['address'] = address[0]
+                reply['rtt_ms'] = now_ms() - sent_ms
+                acks[reply['id']] = reply
+        if expected and expected <= set(acks):
+            break
+
+    failed = 0
+    for unit_id in sorted(set(acks) | expected):
+        ack = acks.get(unit_id)
+        if not ack:
+            print(f"{unit_id:12s}  no ack")
+            failed += 1
+        elif not ack.get('ok'):
+            print(f"{unit_id:12s}  rejected: {ack.get('error')}")
+            failed += 1
+        else:
+            print(f"{unit_id:12s}  ack in {ack['rtt_ms']:6.1f} ms, starts in {ack.get('startsInMs')} ms")
+    print(f"{len(acks)} ack(s), {failed} failed")
+    return 1 if failed else 0
+
+def cmd_groups(sock, args):
+    body = json.dumps({'fleet_groups': args.groups}).encode()
+    request = urllib.request.Request(f"http://{args.host}/api/settings", data=body,
+                                     headers={'Content-Type': 'application/json'})
+    with urllib.request.urlopen(request, timeout=args.timeout) as response:
+        print(response.read().decode())
+    return 0
+
+class StandInDevice:
+    """Host-side stand-in for a rotator, speaking the same protocol"""
+
+    def __init__(self, index, groups, iface, speed):
+        self.id = f"5ee0000000{index:02x}"
+        self.name = f"rotator-SIM{index}"
+        self.groups = groups
+        self.speed = speed
+        self.lock = threading.Lock()
+        self.position = 0.0
+        self.target = 0
+        self.pending = None          # (angle, due_ms)
+        self.last_move = (0, None)   # (seq, sender)
+
+        self.sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM, socket.IPPROTO_UDP)
+        self.sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+        if hasattr(socket, 'SO_REUSEPORT'):
+            self.sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEPORT, 1)
+        self.sock.bind(('', PORT))
+        membership = struct.pack('4s4s', socket.inet_aton(MULTICAST_ADDR),
+                                 socket.inet_aton(iface or '0.0.0.0'))
+        self.sock.setsockopt(socket.IPPROTO_IP, socket.IP_ADD_MEMBERSHIP, membership)
+
+    def angle(self):
+        return int(round(self.position * 360.0 / FULL_ROTATION_COUNT)) % 360
+
+    def state(self):
+        if self.pending:
+            return 'scheduled'
+        return 'moving' if self.position != self.target else 'idle'
+
+    def addressed(self, request):
+        if 'id' in request:
+            return request['id'] in (self.id, self.name)
+        group = request.get('group')
+        return group in (None, '*') or group in [g.strip() for g in self.groups.split(',')]
+
+    def step(self, dt):
+        with self.lock:
+            if self.pending and now_ms() >= self.pending[1]:
+                angle = self.pending[0]
+                self.pending = None
+                # Shortest path, like rotateToAngle()
+                target = angle * FULL_ROTATION_COUNT // 360
+                distance = (target - self.position) % FULL_ROTATION_COUNT
+                if distance > FULL_ROTATION_COUNT / 2:
+                    distance -= FULL_ROTATION_COUNT
+                self.target = round(self.position + distance)
+                print(f"[{self.id}] move to {angle}° started")
+            delta = self.target - self.position
+            step = self.speed * dt
+            self.position = self.target if abs(delta) <= step else self.position + step * (1 if delta > 0 else -1)
+
+    def handle(self, request, sender):
+        seq = request.get('seq', 0)
+        with self.lock:
+            if request.get('type') == 'discover':
+                reply = {'type': 'announce', 'seq': seq, 'id': self.id, 'name': self.name,
+                         'groups': self.groups, 'fw': 'sim',
+                         'currentPosition': int(self.position), 'targetPosition': self.target,
+                         'currentAngle': self.angle(), 'motionActive': self.position != self.target,
+                         'state': self.state()}
+                if self.pending:
+                    reply['scheduledAngle'] = self.pending[0]
+                    reply['startsInMs'] = max(0, int(self.pending[1] - now_ms()))
+            elif request.get('type') == 'move':
+                reply = {'type': 'ack', 'seq': seq, 'id': self.id}
+                angle = request.get('angle')
+                delay = request.get('delayMs', 0)
+                if not isinstance(angle, int) or not 0 <= angle < 360:
+                    reply.update(ok=False, error='Invalid angle')
+                elif not isinstance(delay, int) or not 0 <= delay <= 60000:
+                    reply.update(ok=False, error='Invalid delay')
+                else:
+                    if seq == 0 or (seq, sender[0]) != self.last_move:
+                        self.pending = (angle, now_ms() + delay)
+                        self.last_move = (seq, sender[0])
+                    reply.update(ok=True, startsInMs=max(0, int(self.pending[1] - now_ms())) if self.pending else 0)
+            else:
+                return
+        self.sock.sendto(json.dumps(reply, separators=(',', ':')).encode(), sender)
+
+    def serve(self, drop_rate):
+        while True:
+            data, sender = self.sock.recvfrom(MAX_PACKET_SIZE)
+            if random.random() < drop_rate:
+                continue
+            try:
+                request = json.loads(data)
+            except ValueError:
+                continue
+            if isinstance(request, dict) and self.addressed(request):
+                self.handle(request, sender)
+
+def cmd_sim(sock, args):
+    devices = [StandInDevice(i, args.groups, args.iface, args.speed) for i in range(args.count)]
+    for device in devices:
+        threading.Thread(target=device.serve, args=(args.drop,), daemon=True).start()
+    print(f"{len(devices)} stand-in device(s) on {MULTICAST_ADDR}:{PORT}, groups '{args.groups}'")
+
+    last = time.monotonic()
+    try:
+        while True:
+            time.sleep(0.01)
+            now = time.monotonic()
+            for device in devices:
+                device.step(now - last)
+            last = now
+    except KeyboardInterrupt:
+        return 0
+
+def main():
+    common = argparse.ArgumentParser(add_help=False)
+    common.add_argument('--iface', help='Local IPv4 address of the interface to use for multicast')
+    common.add_argument('--timeout', type=float, default=1.5, help='Seconds to wait for replies')
+
+    parser = argparse.ArgumentParser(description='Discover and command a fleet of rotators over UDP multicast')
+    sub = parser.add_subparsers(dest='command', required=True)
+
+    p = sub.add_parser('discover', parents=[common], help='List units and their position/state')
+    p.add_argument('--group', help='Only units in this group')
+    p.add_argument('--id', help='Only this unit (device id or mDNS name)')
+    p.add_argument('--json', action='store_true', help='Print the raw announcements')
+
+    p = sub.add_parser('move', parents=[common], help='Move a group (or one unit) to an angle at a common start time')
+    p.add_argument('--group', help='Target group (default: all units)')
+    p.add_argument('--id', help='Target one unit (device id or mDNS name)')
+    p.add_argument('--angle', type=int, required=True, help='Target angle in degrees (0-359)')
+    p.add_argument('--delay', type=int, default=1000, help='Milliseconds from now until the move starts')
+    p.add_argument('--retry-interval', type=float, default=200, help='Milliseconds between resends to units that have not acked')
+    p.add_argument('--no-discover', action='store_true', help='Send once per interval without waiting for specific units')
+
+    p = sub.add_parser('groups', parents=[common], help='Set the fleet groups of one unit (HTTP)')
+    p.add_argument('--host', required=True, help='Unit address')
+    p.add_argument('groups', help='Comma-separated group names ("" to clear)')
+
+    p = sub.add_parser('sim', parents=[common], help='Run stand-in devices on this host')
+    p.add_argument('--count', type=int, default=3, help='Number of stand-in devices')
+    p.add_argument('--groups', default='', help='Comma-separated groups for every stand-in')
+    p.add_argument('--speed', type=float, default=4000.0, help='Counts per second')
+    p.add_argument('--drop', type=float, default=0.0, help='Fraction of requests to ignore (tests retries)')
+
+    args = parser.parse_args()
+    commands = {'discover': cmd_discover, 'move': cmd_move, 'groups': cmd_groups, 'sim': cmd_sim}
+    sock = make_client_socket(args.iface) if args.command in ('discover', 'move') else None
+    return commands[args.command](sock, args)
+
+if __name__ == '__main__':
+    sys.exit(main())
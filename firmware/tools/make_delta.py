@@ -0,0 +1,196 @@
+#!/usr/bin/env python3
+"""
+Delta OTA patch generator for the rotator firmware
+
+Builds a compressed patch that turns the firmware image currently running on a
+device (old.bin) into a new build (new.bin). The device rebuilds the new image in
+its inactive OTA slot by reading the running partition and applying the patch,
+then checks the result against the new image's SHA-256.
+
+    python3 tools/make_delta.py old.bin new.bin -o update.delta
+    curl -F patch=@update.delta http://192.168.4.1/update/delta
+
+Patch format (all integers little-endian):
+
+    header (80 bytes, uncompressed)
+        magic "RDLT", u16 version, u16 flags (0),
+        u32 old_size, u32 new_size, old_sha256[32], new_sha256[32]
+    zlib stream of operations
+        ADD    u8 1, u32 length, u32 old_offset, length diff bytes
+               new[i] = old[old_offset + i] + diff[i] (mod 256)
+        INSERT u8 2, u32 length, length literal bytes
+
+ADD covers both exact copies (diff all zero) and code that only moved, where
+relocated addresses leave sparse byte differences; both compress to very little.
+
+Only the Python standard library is used.
+"""
+
+import argparse
+import hashlib
+import struct
+import sys
+import zlib
+
+MAGIC = b'RDLT'
+VERSION = 1
+HEADER = struct.Struct('<4sHHII32s32s')
+
+OP_ADD = 1
+OP_INSERT = 2
+
+SEED_LENGTH = 16     # Bytes that must match exactly to start an ADD
+INDEX_STRIDE = 4     # Old-image offsets indexed (every 4th keeps the index small)
+GIVE_UP_SCORE = 32   # Stop extending once this far below the best match score
+MIN_ADD_LENGTH = 24  # Shorter matches are cheaper as literals
+
+def build_index(old):
+    index = {}
+    for offset in range(0, len(old) - SEED_LENGTH + 1, INDEX_STRIDE):
+        index.setdefault(old[offset:offset + SEED_LENGTH], offset)
+    return index
+
+def extend_forward(old, new, old_pos, new_pos):
+    """Length of the best approximate match, bsdiff style: maximise matches - mismatches"""
+    score = best_score = best_length = 0
+    length = 0
+    limit = min(len(old) - old_pos, len(new) - new_pos)
+    while length < limit:
+        if old[old_pos + length] == new[new_pos + length]:
+            score += 1
+            if score > best_score:
+                best_score = score
+                best_length = length + 1
+        else:
+            score -= 1
+            if score < best_score - GIVE_UP_SCORE:
+                break
+        length += 1
+    return best_length
+
+def diff_ops(old, new):
+    """Yield (OP_ADD, old_offset, new_start, length) and (OP_INSERT, new_start, length)"""
+    index = build_index(old)
+    pos = literal_start = 0
+    displacement = None
+
+    while pos + SEED_LENGTH <= len(new):
+        seed = new[pos:pos + SEED_LENGTH]
+
+        # Prefer continuing the previous alignment, then any indexed match
+        candidate = None
+        if displacement is not None:
+            guess = pos + displacement
+            if 0 <= guess and old[guess:guess + SEED_LENGTH] == seed:
+                candidate = guess
+        if candidate is None:
+            candidate = index.get(seed)
+        if candidate is None:
+            pos += 1
+            continue
+
+        old_pos, new_pos = candidate, pos
+        while new_pos > literal_start and old_pos > 0 and new[new_pos - 1] == old[old_pos - 1]:
+            new_pos -= 1
+            old_pos -= 1
+
+        length = extend_forward(old, new, old_pos, new_pos)
+        if length < MIN_ADD_LENGTH:
+            pos += 1
+            continue
+
+        if new_pos > literal_start:
+            yield (OP_INSERT, literal_start, new_pos - literal_start)
+        yield (OP_ADD, old_pos, new_pos, length)
+
+        displacement = old_pos - new_pos
+        pos = literal_start = new_pos + length
+
+    if literal_start < len(new):
+        yield (OP_INSERT, literal_start, len(new) - literal_start)
+
+def encode_ops(old, new, ops):
+    stream = bytearray()
+    stats = {'add': 0, 'add_bytes': 0, 'insert': 0, 'insert_bytes': 0}
+    for op in ops:
+        if op[0] == OP_ADD:
+            _, old_pos, new_pos, length = op
+            stream += struct.pack('<BII', OP_ADD, length, old_pos)
+            stream += bytes((new[new_pos + i] - old[old_pos + i]) & 0xFF for i in range(length))
+            stats['add'] += 1
+            stats['add_bytes'] += length
+        else:
+            _, new_pos, length = op
+            stream += struct.pack('<BI', OP_INSERT, length)
+            stream += new[new_pos:new_pos + length]
+            stats['insert'] += 1
+            stats['insert_bytes'] += length
+    return bytes(stream), stats
+
+def make_patch(old, new, level=9):
+    stream, stats = encode_ops(old, new, diff_ops(old, new))
+    header = HEADER.pack(MAGIC, VERSION, 0, len(old), len(new),
+                         hashlib.sha256(old).digest(), hashlib.sha256(new).digest())
+    return header + zlib.compress(stream, level), stats
+
+def apply_patch(old, patch):
+    """Reference implementation of the device side, used by --verify"""
+    magic, version, _, old_size, new_size, old_sha, new_sha = HEADER.unpack_from(patch)
+    if magic != MAGIC or version != VERSION:
+        raise ValueError('not a delta patch')
+    if old_size != len(old) or hashlib.sha256(old).digest() != old_sha:
+        raise ValueError('patch does not match the old image')
+
+    stream = zlib.decompress(patch[HEADER.size:])
+    out = bytearray()
+    pos = 0
+    while pos < len(stream):
+        op = stream[pos]
+        if op == OP_ADD:
+            length, old_pos = struct.unpack_from('<II', stream, pos + 1)
+            pos += 9
+            out += bytes((old[old_pos + i] + stream[pos + i]) & 0xFF for i in range(length))
+        elif op == OP_INSERT:
+            (length,) = struct.unpack_from('<I', stream, pos + 1)
+            pos += 5
+            out += stream[pos:pos + length]
+        else:
+            raise ValueError(f'unknown op {op} at {pos}')
+        pos += length
+
+    if len(out) != new_size or hashlib.sha256(out).digest() != new_sha:
+        raise ValueError('reconstructed image does not match')
+    return bytes(out)
+
+def main():
+    parser = argparse.ArgumentParser(description='Build a delta OTA patch between two firmware images')
+    parser.add_argument('old', help='Firmware image currently on the device')
+    parser.add_argument('new', help='Firmware image to install')
+    parser.add_argument('-o', '--output', required=True, help='Patch file to write')
+    parser.add_argument('--verify', action='store_true', help='Apply the patch locally and check the result')
+    args = parser.parse_args()
+
+    with open(args.old, 'rb') as f:
+        old = f.read()
+    with open(args.new, 'rb') as f:
+        new = f.read()
+
+    patch, stats = make_patch(old, new)
+
+    with open(args.output, 'wb') as f:
+        f.write(patch)
+
+    print(f"old image:  {len(old):9d} bytes")
+    print(f"new image:  {len(new):9d} bytes")
+    print(f"patch:      {len(patch):9d} bytes ({100.0 * len(patch) / max(1, len(new)):.1f}% of new image)")
+    print(f"operations: {stats['add']} add ({stats['add_bytes']} bytes), "
+          f"{stats['insert']} insert ({stats['insert_bytes']} bytes)")
+
+    if args.verify:
+        apply_patch(old, patch)
+        print("verify:     OK")
+
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,331 @@
+#!/usr/bin/env python3
+"""
+Client library and CLI for the rotator's binary UDP control protocol
+
+Requests go to UDP port 42421 of a unit. All integers are little-endian:
+
+    request   "RC", u8 version (1), u8 command, u32 seq, payload [, tag]
+        STATUS  1   no payload
+        GOTO    2   i64 encoder position
+        ROTATE  3   i16 angle (0-359)
+        STOP    4   no payload
+    response  "RC", u8 version, u8 command | 0x80, u32 seq, u8 result, u8 flags,
+              i16 angle, i64 position, i64 target, f32 velocity [, tag]
+        result  0 ok, 1 busy, 2 bad request, 3 auth failed, 4 stale
+        flags   bit 0 motion active, bit 1 auto-rotation enabled
+
+When the unit has a control_key set, every request and response carries the first
+16 bytes of HMAC-SHA256(key, packet) and an authenticated seq must be newer than
+the last one the unit executed. A "stale" response carries that last seq in its
+target field; this client then continues after it, so several controllers can
+share a unit.
+
+Retries are idempotent: a request is resent with the same seq, and the unit
+answers a repeat of the last seq it ran from that sender with the saved response
+instead of running the command again.
+
+    from rotator_udp import RotatorClient
+    rotator = RotatorClient('192.168.1.42', key='secret')
+    rotator.rotate(90)
+    print(rotator.status())
+
+    python3 tools/rotator_udp.py --host 192.168.1.42 status
+    python3 tools/rotator_udp.py --host 192.168.1.42 goto 1000
+    python3 tools/rotator_udp.py sim        # stand-in unit on 127.0.0.1:42421
+
+Only the Python standard library is used.
+"""
+
+import argparse
+import collections
+import hashlib
+import hmac
+import random
+import socket
+import struct
+import sys
+import threading
+import time
+
+PORT = 42421
+VERSION = 1
+HEADER = struct.Struct('<2sBBI')
+RESPONSE = struct.Struct('<2sBBIBBhqqf')
+TAG_SIZE = 16
+RESPONSE_FLAG = 0x80
+
+CMD_STATUS = 1
+CMD_GOTO = 2
+CMD_ROTATE = 3
+CMD_STOP = 4
+
+RESULT_OK = 0
+RESULT_BUSY = 1
+RESULT_BAD_REQUEST = 2
+RESULT_AUTH_FAILED = 3
+RESULT_STALE = 4
+RESULT_NAMES = {RESULT_OK: 'ok', RESULT_BUSY: 'busy', RESULT_BAD_REQUEST: 'bad request',
+                RESULT_AUTH_FAILED: 'auth failed', RESULT_STALE: 'stale'}
+
+FLAG_MOTION_ACTIVE = 0x01
+FLAG_AUTO_ROTATION = 0x02
+
+FULL_ROTATION_COUNT = 29555    # Encoder counts per turn (firmware default)
+
+Status = collections.namedtuple('Status', 'result motion_active auto_rotation angle position target velocity')
+
+class ControlError(Exception):
+    """The unit answered with a result other than ok"""
+    def __init__(self, status):
+        super().__init__(RESULT_NAMES.get(status.result, f"result {status.result}"))
+        self.status = status
+
+class ControlTimeout(Exception):
+    """No (valid) response after all retries"""
+
+def make_tag(key, data):
+    return hmac.new(key, data, hashlib.sha256).digest()[:TAG_SIZE]
+
+class RotatorClient:
+    def __init__(self, host, port=PORT, key=None, timeout=0.05, retries=5):
+        self.address = (host, port)
+        self.key = key.encode() if isinstance(key, str) else key
+        self.timeout = timeout
+        self.retries = retries
+        self.seq = int(time.time() * 1000) & 0xFFFFFFFF
+        self.resends = 0       # Requests sent again because no response arrived in time
+        self.sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        self.sock.connect(self.address)
+
+    def close(self):
+        self.sock.close()
+
+    def request(self, command, payload=b''):
+        """Send one command (retrying with the same seq) and return its Status; raises on non-ok"""
+        try:
+            return self.send_once(command, payload)
+        except ControlError as e:
+            if e.status.result != RESULT_STALE:
+                raise
+            # Another controller got ahead of our counter; continue after the unit's last seq
+            self.seq = e.status.target & 0xFFFFFFFF
+            return self.send_once(command, payload)
+
+    def send_once(self, command, payload):
+        self.seq = (self.seq + 1) & 0xFFFFFFFF
+        packet = HEADER.pack(b'RC', VERSION, command, self.seq) + payload
+        if self.key:
+            packet += make_tag(self.key, packet)
+
+        for attempt in range(self.retries + 1):
+            if attempt:
+                self.resends += 1
+            self.sock.send(packet)
+            deadline = time.monotonic() + self.timeout
+            while True:
+                remaining = deadline - time.monotonic()
+                if remaining <= 0:
+                    break
+                self.sock.settimeout(remaining)
+                try:
+                    data = self.sock.recv(RESPONSE.size + TAG_SIZE)
+                except socket.timeout:
+                    break
+                except ConnectionRefusedError:
+                    continue
+                status = self.parse_response(data, command)
+                if status is None:
+                    continue
+                if status.result != RESULT_OK:
+                    raise ControlError(status)
+                return status
+        raise ControlTimeout(f"no response from {self.address[0]}:{self.address[1]}")
+
+    def parse_response(self, data, command):
+        if len(data) < RESPONSE.size:
+            return None
+        magic, version, response_command, seq, result, flags, angle, position, target, velocity = \
+            RESPONSE.unpack_from(data)
+        if magic != b'RC' or version != VERSION or seq != self.seq or response_command != command | RESPONSE_FLAG:
+            return None
+        # An auth failure is reported unsigned; anything else must carry a valid tag
+        if self.key and result != RESULT_AUTH_FAILED:
+            if len(data) != RESPONSE.size + TAG_SIZE or \
+               not hmac.compare_digest(make_tag(self.key, data[:RESPONSE.size]), data[RESPONSE.size:]):
+                return None
+        return Status(result, bool(flags & FLAG_MOTION_ACTIVE), bool(flags & FLAG_AUTO_ROTATION),
+                      angle, position, target, velocity)
+
+    def status(self):
+        return self.request(CMD_STATUS)
+
+    def goto(self, position):
+        return self.request(CMD_GOTO, struct.pack('<q', position))
+
+    def rotate(self, angle):
+        return self.request(CMD_ROTATE, struct.pack('<h', angle))
+
+    def stop(self):
+        return self.request(CMD_STOP)
+
+class StandInUnit:
+    """Host-side stand-in for a rotator's UDP control endpoint"""
+
+    def __init__(self, bind, port, key, speed, drop_rate):
+        self.key = key.encode() if key else None
+        self.speed = speed
+        self.drop_rate = drop_rate
+        self.lock = threading.Lock()
+        self.position = 0.0
+        self.target = 0
+        self.moving = False
+        self.last = {}             # sender -> (seq, response)
+        self.last_auth_seq = None
+        self.dropped = 0
+        self.sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        self.sock.bind((bind, port))
+
+    def response(self, command, seq, result, sign):
+        with self.lock:
+            packet = RESPONSE.pack(b'RC', VERSION, command | RESPONSE_FLAG, seq, result,
+                                   FLAG_MOTION_ACTIVE if self.moving else 0,
+                                   int(round(self.position * 360.0 / FULL_ROTATION_COUNT)) % 360,
+                                   int(self.position), self.target, 0.0)
+        return packet + make_tag(self.key, packet) if sign else packet
+
+    def execute(self, command, payload):
+        with self.lock:
+            if command == CMD_STATUS and not payload:
+                return RESULT_OK
+            if command == CMD_STOP and not payload:
+                self.target = int(self.position)
+                self.moving = False
+                return RESULT_OK
+            if command == CMD_GOTO and len(payload) == 8:
+                target = struct.unpack('<q', payload)[0]
+            elif command == CMD_ROTATE and len(payload) == 2:
+                angle = struct.unpack('<h', payload)[0]
+                if not 0 <= angle < 360:
+                    return RESULT_BAD_REQUEST
+                distance = (angle * FULL_ROTATION_COUNT // 360 - self.position) % FULL_ROTATION_COUNT
+                if distance > FULL_ROTATION_COUNT / 2:
+                    distance -= FULL_ROTATION_COUNT
+                target = round(self.position + distance)
+            else:
+                return RESULT_BAD_REQUEST
+            if self.moving:
+                return RESULT_BUSY
+            self.target = target
+            self.moving = True
+            return RESULT_OK
+
+    def handle(self, data, sender):
+        if len(data) < HEADER.size:
+            return
+        magic, version, command, seq = HEADER.unpack_from(data)
+        if magic != b'RC' or version != VERSION or command & RESPONSE_FLAG:
+            return
+        payload = data[HEADER.size:]
+        if self.key:
+            if len(payload) < TAG_SIZE or not hmac.compare_digest(make_tag(self.key, data[:-TAG_SIZE]), data[-TAG_SIZE:]):
+                self.sock.sendto(self.response(command, seq, RESULT_AUTH_FAILED, False), sender)
+                return
+            payload = payload[:-TAG_SIZE]
+
+        last = self.last.get(sender)
+        if last and last[0] == seq:
+            self.sock.sendto(last[1], sender)
+            return
+        if self.key and self.last_auth_seq is not None and not 0 < (seq - self.last_auth_seq) & 0xFFFFFFFF < 0x80000000:
+            packet = bytearray(self.response(command, seq, RESULT_STALE, False))
+            struct.pack_into('<q', packet, 20, self.last_auth_seq)
+            self.sock.sendto(bytes(packet) + make_tag(self.key, bytes(packet)), sender)
+            return
+
+        result = self.execute(command, payload)
+        response = self.response(command, seq, result, bool(self.key))
+        if self.key:
+            self.last_auth_seq = seq
+        self.last[sender] = (seq, response)
+        self.sock.sendto(response, sender)
+
+    def step(self, dt):
+        with self.lock:
+            if not self.moving:
+                return
+            delta = self.target - self.position
+            step = self.speed * dt
+            if abs(delta) <= step:
+                self.position = self.target
+                self.moving = False
+            else:
+                self.position += step if delta > 0 else -step
+
+    def serve(self):
+        while True:
+            data, sender = self.sock.recvfrom(256)
+            if random.random() < self.drop_rate:
+                self.dropped += 1
+                continue
+            self.handle(data, sender)
+
+def cmd_sim(args):
+    unit = StandInUnit(args.bind, args.port, args.key, args.speed, args.drop)
+    threading.Thread(target=unit.serve, daemon=True).start()
+    print(f"Stand-in unit on {args.bind}:{args.port}" + (" (authenticated)" if args.key else ""))
+    last = time.monotonic()
+    try:
+        while True:
+            time.sleep(0.01)
+            now = time.monotonic()
+            unit.step(now - last)
+            last = now
+    except KeyboardInterrupt:
+        return 0
+
+def main():
+    parser = argparse.ArgumentParser(description='Command a rotator over the binary UDP control protocol')
+    parser.add_argument('--host', default='127.0.0.1', help='Unit address')
+    parser.add_argument('--port', type=int, default=PORT)
+    parser.add_argument('--key', help='control_key configured on the unit')
+    parser.add_argument('--timeout', type=float, default=0.05, help='Seconds to wait before resending')
+    parser.add_argument('--retries', type=int, default=5)
+    sub = parser.add_subparsers(dest='command', required=True)
+    sub.add_parser('status', help='Print position and motion state')
+    p = sub.add_parser('goto', help='Move to an encoder position')
+    p.add_argument('position', type=int)
+    p = sub.add_parser('rotate', help='Rotate to an angle (0-359)')
+    p.add_argument('angle', type=int)
+    sub.add_parser('stop', help='Stop the current move')
+    p = sub.add_parser('sim', help='Run a stand-in unit on this host')
+    p.add_argument('--bind', default='127.0.0.1')
+    p.add_argument('--speed', type=float, default=4000.0, help='Counts per second')
+    p.add_argument('--drop', type=float, default=0.0, help='Fraction of requests to ignore (tests retries)')
+    args = parser.parse_args()
+
+    if args.command == 'sim':
+        return cmd_sim(args)
+
+    rotator = RotatorClient(args.host, args.port, args.key, args.timeout, args.retries)
+    try:
+        if args.command == 'status':
+            status = rotator.status()
+        elif args.command == 'goto':
+            status = rotator.goto(args.position)
+        elif args.command == 'rotate':
+            status = rotator.rotate(args.angle)
+        else:
+            status = rotator.stop()
+    except ControlError as e:
+        print(f"{args.command}: {e}", file=sys.stderr)
+        return 1
+    except ControlTimeout as e:
+        print(f"{args.command}: {e}", file=sys.stderr)
+        return 2
+
+    print(f"angle {status.angle}°, position {status.position}, target {status.target}, "
+          f"velocity {status.velocity:.0f}, {'moving' if status.motion_active else 'idle'}")
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+"""
+Fetch and decode the rotator's telemetry rollups (GET /api/telemetry)
+
+The firmware keeps min/max/mean of position, velocity, PWM and speed error in
+1 s (last hour), 1 min (last day) and 1 h (last 30 days) buckets. The response
+is binary, all integers little-endian:
+
+    header   "RTLM", u8 version (1), u8 tier, u8 channels (4), u8 stats (3),
+             u32 bucket seconds, u32 first bucket, u32 bucket count,
+             u32 epoch (Unix time at uptime 0, 0 if the clock is not set),
+             f32 scale per channel
+    columns  samples, then min, max, mean of each channel, count values each
+
+Each column is delta coded from 0. A token is a varint: low bit 1 means the
+value stays the same for (token >> 1) buckets, low bit 0 means add the zigzag
+delta (token >> 1). Values are multiples of the channel scale. Buckets with 0
+samples have no data and repeat the previous value.
+
+    python3 tools/telemetry_fetch.py --host 192.168.1.42 --tier 1m > day.csv
+    python3 tools/telemetry_fetch.py --host 192.168.1.42 --tier 1s --since 5400
+
+Only the Python standard library is used.
+"""
+
+import argparse
+import http.client
+import struct
+import sys
+import time
+
+MAGIC = b'RTLM'
+CHANNELS = ['position', 'velocity', 'pwm', 'speed_error']
+STATS = ['min', 'max', 'mean']
+
+def read_varint(data, offset):
+    value = 0
+    shift = 0
+    while True:
+        byte = data[offset]
+        offset += 1
+        value |= (byte & 0x7F) << shift
+        shift += 7
+        if byte < 0x80:
+            return value, offset
+
+def decode_column(data, offset, count):
+    """Return the count values of one column and the offset after it"""
+    values = []
+    value = 0
+    while len(values) < count:
+        token, offset = read_varint(data, offset)
+        if token & 1:
+            values.extend([value] * (token >> 1))
+        else:
+            zigzag = token >> 1
+            value += (zigzag >> 1) ^ -(zigzag & 1)
+            values.append(value)
+    return values, offset
+
+def decode(data):
+    if data[:4] != MAGIC:
+        raise ValueError('not a telemetry response')
+    version, tier, channels, stats = struct.unpack_from('<4B', data, 4)
+    if version != 1:
+        raise ValueError(f'unsupported version {version}')
+    seconds, first, count, epoch = struct.unpack_from('<4I', data, 8)
+    scales = struct.unpack_from(f'<{channels}f', data, 24)
+
+    offset = 24 + 4 * channels
+    samples, offset = decode_column(data, offset, count)
+    columns = {}
+    for c in range(channels):
+        for s in range(stats):
+            values, offset = decode_column(data, offset, count)
+            columns[(c, s)] = [v * scales[c] for v in values]
+
+    buckets = []
+    for i in range(count):
+        start = (first + i) * seconds
+        bucket = {
+            'bucket': first + i,
+            'uptime': start,
+            'time': epoch + start if epoch else None,
+            'samples': samples[i],
+        }
+        for c in range(channels):
+            for s in range(stats):
+                bucket[f'{CHANNELS[c]}_{STATS[s]}'] = columns[(c, s)][i] if samples[i] else None
+        buckets.append(bucket)
+    return buckets, len(data)
+
+def main():
+    parser = argparse.ArgumentParser(description='Fetch rotator telemetry rollups as CSV')
+    parser.add_argument('--host', required=True)
+    parser.add_argument('--port', type=int, default=80)
+    parser.add_argument('--tier', choices=['1s', '1m', '1h'], default='1m')
+    parser.add_argument('--since', type=int, help='Only buckets after this bucket number')
+    parser.add_argument('--count', type=int, help='Only the newest COUNT buckets')
+    args = parser.parse_args()
+
+    path = f'/api/telemetry?tier={args.tier}'
+    if args.since is not None:
+        path += f'&since={args.since}'
+    if args.count is not None:
+        path += f'&count={args.count}'
+
+    conn = http.client.HTTPConnection(args.host, args.port, timeout=10)
+    conn.request('GET', path)
+    response = conn.getresponse()
+    data = response.read()
+    conn.close()
+    if response.status != 200:
+        print(f'{path}: HTTP {response.status} {data.decode(errors="replace")}', file=sys.stderr)
+        return 1
+
+    buckets, size = decode(data)
+    columns = ['bucket', 'uptime', 'time', 'samples'] + \
+              [f'{c}_{s}' for c in CHANNELS for s in STATS]
+    print(','.join(columns))
+    for bucket in buckets:
+        row = []
+        for name in columns:
+            value = bucket[name]
+            if value is None:
+                row.append('')
+            elif name == 'time':
+                row.append(time.strftime('%Y-%m-%dT%H:%M:%SZ', time.gmtime(value)))
+            elif isinstance(value, float):
+                row.append(f'{value:g}')
+            else:
+                row.append(str(value))
+        print(','.join(row))
+    print(f'{len(buckets)} buckets in {size} bytes', file=sys.stderr)
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,131 @@
+#!/usr/bin/env python3
+"""
+Command latency benchmark: binary UDP control vs the HTTP API
+
+Measures the round trip of a status query and of a move command over both
+paths, and reports latency percentiles and (for UDP) how many requests had to
+be resent:
+
+    UDP  status   STATUS command                    HTTP  status   GET /api/status
+    UDP  goto     GOTO to the current position      HTTP  goto     POST /api/goto
+
+The goto tests target the position the unit is already at, so nothing moves.
+
+    python3 tools/udp_bench.py --host 192.168.1.42 --count 500
+    python3 tools/udp_bench.py --host 192.168.1.42 --key secret --no-http
+
+Against the stand-in unit from rotator_udp.py (UDP only):
+
+    python3 tools/rotator_udp.py sim &
+    python3 tools/udp_bench.py --host 127.0.0.1 --no-http
+
+Only the Python standard library is used.
+"""
+
+import argparse
+import http.client
+import os
+import statistics
+import sys
+import time
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from rotator_udp import RotatorClient, ControlError, ControlTimeout, PORT, RESULT_BUSY
+
+def percentile(sorted_values, fraction):
+    index = min(len(sorted_values) - 1, int(round(fraction * (len(sorted_values) - 1))))
+    return sorted_values[index]
+
+def report(name, latencies_ms, failures, extra=''):
+    if not latencies_ms:
+        print(f"{name:12s}  no successful requests ({failures} failed)")
+        return
+    values = sorted(latencies_ms)
+    print(f"{name:12s}  n={len(values):5d}  p50={percentile(values, 0.50):7.2f}  "
+          f"p90={percentile(values, 0.90):7.2f}  p99={percentile(values, 0.99):7.2f}  "
+          f"max={values[-1]:7.2f}  mean={statistics.mean(values):7.2f} ms  failed={failures}{extra}")
+
+def bench_udp(rotator, count, operation):
+    """A busy answer (the previous no-op move has not finished yet) still counts as a round trip"""
+    latencies = []
+    failures = 0
+    resends_before = rotator.resends
+    for _ in range(count):
+        start = time.perf_counter()
+        try:
+            operation()
+        except ControlError as e:
+            if e.status.result != RESULT_BUSY:
+                failures += 1
+                continue
+        except ControlTimeout:
+            failures += 1
+            continue
+        latencies.append((time.perf_counter() - start) * 1000.0)
+    return latencies, failures, rotator.resends - resends_before
+
+def http_request(host, port, method, path, body, timeout):
+    conn = http.client.HTTPConnection(host, port, timeout=timeout)
+    try:
+        headers = {'Content-Type': 'application/x-www-form-urlencoded'} if body else {}
+        conn.request(method, path, body, headers)
+        response = conn.getresponse()
+        response.read()
+        return response.status
+    finally:
+        conn.close()
+
+def bench_http(host, port, count, method, path, body, timeout):
+    latencies = []
+    failures = 0
+    for _ in range(count):
+        start = time.perf_counter()
+        try:
+            status = http_request(host, port, method, path, body, timeout)
+        except (OSError, http.client.HTTPException):
+            failures += 1
+            continue
+        if status != 200:
+            failures += 1
+            continue
+        latencies.append((time.perf_counter() - start) * 1000.0)
+    return latencies, failures
+
+def main():
+    parser = argparse.ArgumentParser(description='Compare command latency of the UDP control protocol and the HTTP API')
+    parser.add_argument('--host', required=True, help='Unit address')
+    parser.add_argument('--udp-port', type=int, default=PORT)
+    parser.add_argument('--http-port', type=int, default=80)
+    parser.add_argument('--key', help='control_key configured on the unit')
+    parser.add_argument('--count', type=int, default=200, help='Requests per test')
+    parser.add_argument('--timeout', type=float, default=0.05, help='UDP resend timeout in seconds')
+    parser.add_argument('--no-http', action='store_true', help='Only run the UDP tests')
+    parser.add_argument('--no-move', action='store_true', help='Skip the goto tests')
+    args = parser.parse_args()
+
+    rotator = RotatorClient(args.host, args.udp_port, args.key, timeout=args.timeout)
+    try:
+        position = rotator.status().position
+    except (ControlError, ControlTimeout) as e:
+        print(f"UDP status failed: {e}", file=sys.stderr)
+        return 1
+
+    latencies, failures, resends = bench_udp(rotator, args.count, rotator.status)
+    report('UDP status', latencies, failures, f"  resent={resends}")
+    if not args.no_move:
+        latencies, failures, resends = bench_udp(rotator, args.count, lambda: rotator.goto(position))
+        report('UDP goto', latencies, failures, f"  resent={resends}")
+
+    if not args.no_http:
+        latencies, failures = bench_http(args.host, args.http_port, args.count, 'GET', '/api/status', None, 5.0)
+        report('HTTP status', latencies, failures)
+        if not args.no_move:
+            latencies, failures = bench_http(args.host, args.http_port, args.count, 'POST', '/api/goto',
+                                             f"position={position}", 5.0)
+            report('HTTP goto', latencies, failures)
+
+    rotator.close()
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())